@@ -198,3 +198,16 @@ bool HttpResponse::isConnected() const
 {
     return socket->isOpen();
 }
+
+
+bool HttpResponse::waitForBytesWritten(int msecs)
+{
+    while (socket->isOpen() && socket->bytesToWrite()>0)
+    {
+        if (!socket->waitForBytesWritten(msecs))
+        {
+            return false;
+        }
+    }
+    return socket->isOpen();
+}
@@ -122,6 +122,15 @@ public:
      */
     bool isConnected() const;
 
+    /**
+     * Wait until the output buffer has been sent to the web client. Used by request handlers
+     * that stream data without returning to the event loop. A lost connection is detected
+     * while waiting and reported by isConnected() afterwards.
+     * @param msecs Timeout in milliseconds
+     * @return false if the data could not be sent before the timeout or the connection was lost
+     */
+    bool waitForBytesWritten(int msecs);
+
 private:
 
     /** Request headers */
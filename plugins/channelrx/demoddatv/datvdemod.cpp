@@ -21,6 +21,7 @@
 
 #include <QTime>
 #include <QDebug>
+#include <QThread>
 #include <stdio.h>
 #include <complex.h>
 #include "audio/audiooutput.h"
@@ -38,6 +39,8 @@ MESSAGE_CLASS_DEFINITION(DATVDemod::MsgConfigureChannelizer, Message)
 
 DATVDemod::DATVDemod(DeviceSourceAPI *deviceAPI) :
     ChannelSinkAPI(m_channelIdURI),
+    m_schedulerCPUTimeNs(0),
+    m_cpuTimeNs(0),
     m_blnNeedConfigUpdate(false),
     m_deviceAPI(deviceAPI),
     m_objRegisteredTVScreen(0),
@@ -202,6 +205,16 @@ void DATVDemod::CleanUpDATVFramework(bool blnRelease)
         if (m_objScheduler != nullptr)
         {
             m_objScheduler->shutdown();
+
+            for (int i = 0; i < m_objScheduler->nrunnables; i++)
+            {
+                leansdr::runnable_common *runnable = m_objScheduler->runnables[i];
+                qDebug() << "DATVDemod::CleanUpDATVFramework: " << runnable->name
+                    << " thread: " << runnable->worker
+                    << " runs: " << runnable->run_count
+                    << " CPU time (ms): " << runnable->run_ns / 1000000ULL;
+            }
+
             delete m_objScheduler;
         }
 
@@ -477,7 +490,8 @@ void DATVDemod::InitDATVFramework()
         <<  " HARD METRIC: " << m_settings.m_hardMetric
         <<  " RollOff: " << m_settings.m_rollOff
         <<  " Viterbi: " << m_settings.m_viterbi
-        <<  " Excursion: " << m_settings.m_excursion;
+        <<  " Excursion: " << m_settings.m_excursion
+        <<  " Multi threaded: " << m_settings.m_multiThreaded;
 
     m_objCfg.standard = m_settings.m_standard;
 
@@ -530,6 +544,7 @@ void DATVDemod::InitDATVFramework()
     m_objCfg.hard_metric = m_settings.m_hardMetric;
     m_objCfg.sampler = m_settings.m_filter;
     m_objCfg.viterbi = m_settings.m_viterbi;
+    m_objCfg.threads = m_settings.m_multiThreaded ? std::max(2, std::min(QThread::idealThreadCount(), 4)) : 1;
 
     // Min buffer size for baseband data
     //   scopes: 1024
@@ -563,6 +578,7 @@ void DATVDemod::InitDATVFramework()
     m_lngExpectedReadIQ  = BUF_BASEBAND;
 
     m_objScheduler = new leansdr::scheduler();
+    m_schedulerCPUTimeNs = 0;
 
     //***************
     p_rawiq = new leansdr::pipebuf<leansdr::cf32>(m_objScheduler, "rawiq", BUF_BASEBAND);
@@ -781,6 +797,8 @@ void DATVDemod::InitDATVFramework()
     // OUTPUT
     r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, m_objVideoStream);
 
+    m_objScheduler->set_threads(m_objCfg.threads);
+
     m_blnDVBInitialized = true;
 }
 
@@ -868,6 +886,10 @@ void DATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVect
                 {
                     m_objScheduler->step();
 
+                    quint64 schedulerCPUTimeNs = m_objScheduler->total_run_ns();
+                    m_cpuTimeNs.fetchAndAddRelaxed(schedulerCPUTimeNs - m_schedulerCPUTimeNs);
+                    m_schedulerCPUTimeNs = schedulerCPUTimeNs;
+
                     m_lngReadIQ=0;
                     delete p_rawiq_writer;
                     p_rawiq_writer = new leansdr::pipewriter<leansdr::cf32>(*p_rawiq);
@@ -59,6 +59,7 @@ class DownChannelizer;
 #include "util/movingaverage.h"
 
 #include <QMutex>
+#include <QAtomicInteger>
 
 // enum DATVModulation { BPSK, QPSK, PSK8, APSK16, APSK32, APSK64E, QAM16, QAM64, QAM256 };
 // enum dvb_version { DVB_S, DVB_S2 };
@@ -72,6 +73,7 @@ struct config
     DATVDemodSettings::dvb_sampler sampler;
 
     int buf_factor;      // Buffer sizing
+    int threads;         // Number of scheduler threads (1: single threaded)
     float Fs;            // Sampling frequency (Hz)
     float Fderot;        // Shift the signal (Hz). Note: Ftune is faster
     int anf;             // Number of auto notch filters
@@ -98,6 +100,7 @@ struct config
         standard(DATVDemodSettings::DVB_S),
         sampler(DATVDemodSettings::SAMP_LINEAR),
         buf_factor(4),
+        threads(1),
         Fs(2.4e6),
         Fderot(0),
         anf(0),
@@ -176,6 +179,7 @@ public:
     int GetSampleRate();
     void InitDATVFramework();
     double getMagSq() const { return m_objMagSqAverage; } //!< Beware this is scaled to 2^30
+    quint64 getCPUTimeNs() const { return m_cpuTimeNs.load(); } //!< CPU time spent in the LeanSDR blocks since creation in ns
 
     static const QString m_channelIdURI;
     static const QString m_channelId;
@@ -240,6 +244,8 @@ private:
 
     leansdr::scheduler * m_objScheduler;
     struct config m_objCfg;
+    quint64 m_schedulerCPUTimeNs;       //!< CPU time of the current scheduler already added to m_cpuTimeNs
+    QAtomicInteger<quint64> m_cpuTimeNs; //!< read by the GUI
 
     bool m_blnDVBInitialized;
     bool m_blnNeedConfigUpdate;
@@ -161,6 +161,8 @@ DATVDemodGUI::DATVDemodGUI(PluginAPI* objPluginAPI, DeviceUISet *deviceUISet, Ba
     m_intLastDecodedData=0;
     m_intLastSpeed=0;
     m_intReadyDecodedData=0;
+    m_lastCPUTimeNs=m_objDATVDemod->getCPUTimeNs();
+    m_cpuLoadTimer.start();
     m_objTimer.setInterval(1000);
     connect(&m_objTimer, SIGNAL(timeout()), this, SLOT(tick()));
     m_objTimer.start();
@@ -228,6 +230,7 @@ void DATVDemodGUI::displaySettings()
     ui->chkHardMetric->setChecked(m_settings.m_hardMetric);
     ui->spiRollOff->setValue((int) (m_settings.m_rollOff * 100.0f));
     ui->chkViterbi->setChecked(m_settings.m_viterbi);
+    ui->chkMultiThreaded->setChecked(m_settings.m_multiThreaded);
     ui->audioMute->setChecked(m_settings.m_audioMute);
     ui->cmbFEC->setCurrentIndex((int) m_settings.m_fec);
     ui->cmbModulation->setCurrentIndex((int) m_settings.m_modulation);
@@ -351,6 +354,7 @@ void DATVDemodGUI::applySettings(bool force)
         m_settings.m_hardMetric = ui->chkHardMetric->isChecked();
         m_settings.m_rollOff = ((float)ui->spiRollOff->value()) / 100.0f;
         m_settings.m_viterbi = ui->chkViterbi->isChecked();
+        m_settings.m_multiThreaded = ui->chkMultiThreaded->isChecked();
         m_settings.m_excursion = ui->spiExcursion->value();
         m_settings.m_audioMute = ui->audioMute->isChecked();
         m_settings.m_audioVolume = ui->audioVolume->value();
@@ -398,6 +402,17 @@ void DATVDemodGUI::tick()
         m_objMagSqAverage(m_objDATVDemod->getMagSq());
         double magSqDB = CalcDb::dbPower(m_objMagSqAverage / (SDR_RX_SCALED*SDR_RX_SCALED));
         ui->channePowerText->setText(tr("%1 dB").arg(magSqDB, 0, 'f', 1));
+
+        // CPU time of the LeanSDR blocks over the tick period as a percentage of one core
+        quint64 cpuTimeNs = m_objDATVDemod->getCPUTimeNs();
+        qint64 elapsedNs = m_cpuLoadTimer.nsecsElapsed();
+
+        if (elapsedNs > 0) {
+            ui->lblCPU->setText(QString("CPU: %1%").arg((100.0 * (cpuTimeNs - m_lastCPUTimeNs)) / elapsedNs, 0, 'f', 0));
+        }
+
+        m_lastCPUTimeNs = cpuTimeNs;
+        m_cpuLoadTimer.restart();
     }
 
     if((m_intLastDecodedData-m_intPreviousDecodedData)>=0)
@@ -559,6 +574,11 @@ void DATVDemodGUI::on_chkHardMetric_clicked()
     applySettings();
 }
 
+void DATVDemodGUI::on_chkMultiThreaded_clicked()
+{
+    applySettings();
+}
+
 void DATVDemodGUI::on_resetDefaults_clicked()
 {
     resetToDefaults();
@@ -28,6 +28,7 @@
 #include "datvdemod.h"
 
 #include <QTimer>
+#include <QElapsedTimer>
 
 
 class PluginAPI;
@@ -77,6 +78,7 @@ private slots:
     void on_cmbFEC_currentIndexChanged(const QString &arg1);
     void on_chkViterbi_clicked();
     void on_chkHardMetric_clicked();
+    void on_chkMultiThreaded_clicked();
     void on_resetDefaults_clicked();
     void on_spiSymbolRate_valueChanged(int arg1);
     void on_spiNotchFilters_valueChanged(int arg1);
@@ -114,6 +116,8 @@ private:
     qint64 m_intLastDecodedData;
     qint64 m_intLastSpeed;
     int m_intReadyDecodedData;
+    quint64 m_lastCPUTimeNs;
+    QElapsedTimer m_cpuLoadTimer;
 
     bool m_blnBasicSettingsShown;
     bool m_blnDoApplySettings;
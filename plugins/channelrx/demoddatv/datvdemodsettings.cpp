@@ -52,6 +52,7 @@ void DATVDemodSettings::resetToDefaults()
     m_audioDeviceName = AudioDeviceManager::m_defaultDeviceName;
     m_audioVolume = 0;
     m_videoMute = false;
+    m_multiThreaded = false;
 }
 
 QByteArray DATVDemodSettings::serialize() const
@@ -82,6 +83,7 @@ QByteArray DATVDemodSettings::serialize() const
     s.writeString(20, m_audioDeviceName);
     s.writeS32(21, m_audioVolume);
     s.writeBool(22, m_videoMute);
+    s.writeBool(23, m_multiThreaded);
 
     return s.final();
 }
@@ -143,6 +145,7 @@ bool DATVDemodSettings::deserialize(const QByteArray& data)
         d.readString(20, &m_audioDeviceName, AudioDeviceManager::m_defaultDeviceName);
         d.readS32(21, &m_audioVolume, 0);
         d.readBool(22, &m_videoMute, false);
+        d.readBool(23, &m_multiThreaded, false);
 
         return true;
     }
@@ -173,7 +176,8 @@ void DATVDemodSettings::debug(const QString& msg) const
         << " m_audioMute: " << m_audioMute
         << " m_audioDeviceName: " << m_audioDeviceName
         << " m_audioVolume: " << m_audioVolume
-        << " m_videoMute: " << m_videoMute;
+        << " m_videoMute: " << m_videoMute
+        << " m_multiThreaded: " << m_multiThreaded;
 }
 
 bool DATVDemodSettings::isDifferent(const DATVDemodSettings& other)
@@ -191,5 +195,6 @@ bool DATVDemodSettings::isDifferent(const DATVDemodSettings& other)
         || (m_standard != other.m_standard)
         || (m_notchFilters != other.m_notchFilters)
         || (m_symbolRate != other.m_symbolRate)
-        || (m_excursion != other.m_excursion));
+        || (m_excursion != other.m_excursion)
+        || (m_multiThreaded != other.m_multiThreaded));
 }
\ No newline at end of file
@@ -75,6 +75,7 @@ struct DATVDemodSettings
     int m_excursion;
     int m_audioVolume;
     bool m_videoMute;
+    bool m_multiThreaded; //!< run the leansdr chain on several threads
 
     DATVDemodSettings();
     void resetToDefaults();
@@ -1,5 +1,14 @@
 #include "framework.h"
 
+#include <chrono>
+#include <condition_variable>
+#ifndef _WIN32
+#include <time.h>
+#endif
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace leansdr
 {
 
@@ -13,4 +22,199 @@ void fail(const char *s)
     fprintf(stderr, "** %s\n", s);
 }
 
+// Worker threads of a threaded scheduler.
+// groups[0] is run by the thread calling scheduler::step(),
+// groups[i] (i > 0) by workers[i-1].
+
+struct scheduler_threads
+{
+    std::vector<std::thread> workers;
+    std::vector<std::vector<runnable_common *> > groups;
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    unsigned long generation;
+    int pending;
+    bool stopping;
+
+    scheduler_threads() : generation(0), pending(0), stopping(false)
+    {
+    }
+
+    void work(int index)
+    {
+        unsigned long seen = 0;
+
+        while (1)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                start_cv.wait(lock, [&] { return stopping || (generation != seen); });
+                if (stopping)
+                    return;
+                seen = generation;
+            }
+
+            std::vector<runnable_common *> &group = groups[index];
+            for (size_t i = 0; i < group.size(); ++i)
+                scheduler::run_timed(group[i]);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--pending == 0)
+                    done_cv.notify_one();
+            }
+        }
+    }
+};
+
+scheduler::~scheduler()
+{
+    stop_threads();
+}
+
+// CPU time of the calling thread in nanoseconds so that time slices lost
+// to other threads or processes are not charged to the runnables.
+// Falls back to wall time where there is no thread CPU clock.
+static unsigned long long thread_cpu_ns()
+{
+#if defined(_WIN32) || !defined(CLOCK_THREAD_CPUTIME_ID)
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+void scheduler::run_timed(runnable_common *r)
+{
+    unsigned long long t0 = thread_cpu_ns();
+    r->run();
+    r->run_ns += thread_cpu_ns() - t0;
+    r->run_count++;
+}
+
+void scheduler::set_threads(int n)
+{
+    stop_threads();
+
+    if (n > nrunnables)
+        n = nrunnables;
+    if (n <= 1)
+    {
+        nthreads = 1;
+        return;
+    }
+
+    nthreads = n;
+    nrounds = 0;
+    threads = new scheduler_threads();
+    threads->groups.resize(n);
+
+    // Until we have measurements spread runnables evenly in pipeline order
+    for (int i = 0; i < nrunnables; ++i)
+    {
+        runnables[i]->worker = (i * n) / nrunnables;
+        threads->groups[runnables[i]->worker].push_back(runnables[i]);
+    }
+
+    for (int i = 1; i < n; ++i)
+        threads->workers.push_back(std::thread(&scheduler_threads::work, threads, i));
+}
+
+void scheduler::stop_threads()
+{
+    if (!threads)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(threads->mutex);
+        threads->stopping = true;
+    }
+    threads->start_cv.notify_all();
+
+    for (size_t i = 0; i < threads->workers.size(); ++i)
+        threads->workers[i].join();
+
+    delete threads;
+    threads = NULL;
+    nthreads = 1;
+
+    for (int i = 0; i < npipes; ++i)
+        pipes[i]->defer_pack = false;
+}
+
+void scheduler::step_threaded()
+{
+    for (int i = 0; i < npipes; ++i)
+        pipes[i]->defer_pack = true;
+
+    {
+        std::lock_guard<std::mutex> lock(threads->mutex);
+        threads->generation++;
+        threads->pending = threads->workers.size();
+    }
+    threads->start_cv.notify_all();
+
+    std::vector<runnable_common *> &group = threads->groups[0];
+    for (size_t i = 0; i < group.size(); ++i)
+        run_timed(group[i]);
+
+    {
+        std::unique_lock<std::mutex> lock(threads->mutex);
+        threads->done_cv.wait(lock, [&] { return threads->pending == 0; });
+    }
+
+    // All threads are idle: buffers can be compacted safely
+    for (int i = 0; i < npipes; ++i)
+    {
+        pipes[i]->defer_pack = false;
+        if (pipes[i]->pack_pending)
+            pipes[i]->pack();
+    }
+
+    nrounds++;
+    if ((nrounds == 16) || (nrounds % 256 == 0))
+        balance();
+}
+
+// Longest processing time first assignment of runnables to threads
+// based on the time measured so far. Runnables keep their pipeline
+// order within a thread. Only called between rounds.
+void scheduler::balance()
+{
+    std::vector<runnable_common *> sorted(runnables, runnables + nrunnables);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const runnable_common *a, const runnable_common *b) { return a->run_ns > b->run_ns; });
+    std::vector<unsigned long long> load(nthreads, 0);
+
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+        int w = std::min_element(load.begin(), load.end()) - load.begin();
+        sorted[i]->worker = w;
+        load[w] += sorted[i]->run_ns;
+    }
+
+    for (int w = 0; w < nthreads; ++w)
+        threads->groups[w].clear();
+    for (int i = 0; i < nrunnables; ++i)
+        threads->groups[runnables[i]->worker].push_back(runnables[i]);
+}
+
+void scheduler::dump_profile()
+{
+    unsigned long long total_ns = total_run_ns();
+
+    fprintf(stderr, "\n");
+    for (int i = 0; i < nrunnables; ++i)
+    {
+        runnable_common *r = runnables[i];
+        fprintf(stderr, "%-20s : thread %d %8lu runs %10.3f ms %5.1f %%\n",
+                r->name, r->worker, r->run_count, r->run_ns / 1e6,
+                total_ns ? (100.0 * r->run_ns) / total_ns : 0.0);
+    }
+    fprintf(stderr, "Total CPU time: %.3f ms on %d thread(s)\n", total_ns / 1e6, nthreads);
+}
+
 } // leansdr
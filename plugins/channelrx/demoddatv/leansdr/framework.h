@@ -19,6 +19,7 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <atomic>
 
 #include <math.h>
 #include <stdint.h>
@@ -45,6 +46,13 @@ void fail(const char *s);
 // [pipereader] is a client-side hook reading from a [pipebuf].
 // [runnable] is anything that moves data between [pipebufs].
 // [scheduler] is a global context which invokes [runnables] until fixpoint.
+//
+// The scheduler can optionally spread the [runnables] over several threads
+// (see scheduler::set_threads). Each step() is then a round in which every
+// thread invokes its own [runnables] once, concurrently with the others.
+// Within a round a [pipebuf] is only ever appended to by its writer and
+// consumed by its readers; compaction of buffers (pack) is deferred to the
+// end of the round when all threads are idle.
 
 static const int MAX_PIPES = 64;
 static const int MAX_RUNNABLES = 64;
@@ -67,9 +75,15 @@ struct pipebuf_common
         (void)total_bufs;
     }
 
+    virtual void pack()
+    {
+    }
+
     const char *name;
+    bool defer_pack;   // set by the scheduler while a threaded round is running
+    bool pack_pending; // writer ran out of space during a threaded round
 
-    pipebuf_common(const char *_name) : name(_name)
+    pipebuf_common(const char *_name) : name(_name), defer_pack(false), pack_pending(false)
     {
     }
 
@@ -81,8 +95,11 @@ struct pipebuf_common
 struct runnable_common
 {
     const char *name;
+    unsigned long long run_ns; // CPU time of the calling thread spent in run()
+    unsigned long run_count;   // number of run() invocations
+    int worker;                // thread this runnable is assigned to in threaded mode
 
-    runnable_common(const char *_name) : name(_name)
+    runnable_common(const char *_name) : name(_name), run_ns(0), run_count(0), worker(0)
     {
     }
 
@@ -111,6 +128,8 @@ struct window_placement
     int x, y, w, h;
 };
 
+struct scheduler_threads;
+
 struct scheduler
 {
     pipebuf_common *pipes[MAX_PIPES];
@@ -125,8 +144,23 @@ struct scheduler
                   windows(NULL),
                   verbose(false),
                   debug(false),
-                  debug2(false)
+                  debug2(false),
+                  threads(NULL),
+                  nthreads(1),
+                  nrounds(0)
+    {
+    }
+
+    ~scheduler();
+
+    // Number of threads to spread the runnables on. 1 (default) runs
+    // everything in the calling thread as before. Must be called after
+    // all runnables have been created and before the first step().
+    void set_threads(int n);
+
+    int get_threads() const
     {
+        return nthreads;
     }
 
     void add_pipe(pipebuf_common *p)
@@ -145,8 +179,27 @@ struct scheduler
 
     void step()
     {
+        if (threads)
+        {
+            step_threaded();
+            return;
+        }
+
+        for (int i = 0; i < nrunnables; ++i)
+            run_timed(runnables[i]);
+    }
+
+    // Invoke a runnable and account for the CPU time spent in it
+    static void run_timed(runnable_common *r);
+
+    // CPU time spent in all runnables since their creation.
+    // Only consistent between calls to step().
+    unsigned long long total_run_ns() const
+    {
+        unsigned long long total_ns = 0;
         for (int i = 0; i < nrunnables; ++i)
-            runnables[i]->run();
+            total_ns += runnables[i]->run_ns;
+        return total_ns;
     }
 
     void run()
@@ -165,6 +218,8 @@ struct scheduler
 
     void shutdown()
     {
+        stop_threads();
+
         for (int i = 0; i < nrunnables; ++i)
             runnables[i]->shutdown();
     }
@@ -186,6 +241,18 @@ struct scheduler
         fprintf(stderr, "Total buffer memory: %ld KiB\n",
                 (unsigned long)total_bufs / 1024);
     }
+
+    // Print CPU time spent in each runnable
+    void dump_profile();
+
+  private:
+    scheduler_threads *threads;
+    int nthreads;
+    unsigned long nrounds;
+
+    void step_threaded();
+    void stop_threads();
+    void balance();
 };
 
 struct runnable : runnable_common
@@ -206,6 +273,7 @@ struct pipebuf : pipebuf_common
     T *rds[MAX_READERS];
     int nrd;
     T *wr;
+    std::atomic<T *> wr_shared; // wr as seen by readers running in other threads
     T *end;
 
     int sizeofT()
@@ -216,6 +284,7 @@ struct pipebuf : pipebuf_common
     pipebuf(scheduler *sch, const char *name, unsigned long size) : pipebuf_common(name),
                                                                     buf(new T[size]),
                                                                     nrd(0), wr(buf),
+                                                                    wr_shared(buf),
                                                                     end(buf + size),
                                                                     min_write(1),
                                                                     total_written(0),
@@ -234,12 +303,14 @@ struct pipebuf : pipebuf_common
 
     void pack()
     {
+        pack_pending = false;
         T *rd = wr;
         for (int i = 0; i < nrd; ++i)
             if (rds[i] < rd)
                 rd = rds[i];
         memmove(buf, rd, (wr - rd) * sizeof(T));
         wr -= rd - buf;
+        wr_shared.store(wr, std::memory_order_relaxed);
         for (int i = 0; i < nrd; ++i)
             rds[i] -= rd - buf;
     }
@@ -296,7 +367,12 @@ struct pipewriter
     long writable()
     {
         if (buf.end < buf.min_write + buf.wr)
-            buf.pack();
+        {
+            if (buf.defer_pack)
+                buf.pack_pending = true; // readers may be running: compact at end of round
+            else
+                buf.pack();
+        }
         return buf.end - buf.wr;
     }
 
@@ -313,6 +389,7 @@ struct pipewriter
         }
 
         buf.wr += n;
+        buf.wr_shared.store(buf.wr, std::memory_order_release);
         buf.total_written += n;
     }
 
@@ -356,7 +433,7 @@ struct pipereader
 
     long readable()
     {
-        return buf.wr - buf.rds[id];
+        return buf.wr_shared.load(std::memory_order_acquire) - buf.rds[id];
     }
 
     T *rd()
@@ -366,7 +443,7 @@ struct pipereader
 
     void read(unsigned long n)
     {
-        if (buf.rds[id] + n > buf.wr)
+        if (buf.rds[id] + n > buf.wr_shared.load(std::memory_order_relaxed))
         {
             fprintf(stderr, "Bug: underflow from %s\n", buf.name);
         }
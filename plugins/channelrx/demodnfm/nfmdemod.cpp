@@ -77,6 +77,13 @@ NFMDemod::NFMDemod(DeviceSourceAPI *devieAPI) :
     qDebug("NFMDemod::NFMDemod");
 	setObjectName(m_channelId);
 
+    m_messageDispatcher.add<DownChannelizer::MsgChannelizerNotification>(&NFMDemod::handleChannelizerNotification);
+    m_messageDispatcher.add<MsgConfigureChannelizer>(&NFMDemod::handleConfigureChannelizer);
+    m_messageDispatcher.add<MsgConfigureNFMDemod>(&NFMDemod::handleConfigureNFMDemod);
+    m_messageDispatcher.add<BasebandSampleSink::MsgThreadedSink>(&NFMDemod::handleThreadedSink);
+    m_messageDispatcher.add<DSPConfigureAudio>(&NFMDemod::handleConfigureAudio);
+    m_messageDispatcher.add<DSPSignalNotification>(&NFMDemod::handleSignalNotification);
+
 	m_audioBuffer.resize(1<<14);
 	m_audioBufferFill = 0;
 
@@ -96,6 +103,7 @@ NFMDemod::NFMDemod(DeviceSourceAPI *devieAPI) :
 	applySettings(m_settings, true);
 
     m_channelizer = new DownChannelizer(this);
+    m_channelizer->setPolyphaseChannelizer(m_deviceAPI->acquirePolyphaseChannelizer()); // narrowband: take a shared sub-band when it fits
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
@@ -113,6 +121,7 @@ NFMDemod::~NFMDemod()
     m_deviceAPI->removeThreadedSink(m_threadedChannelizer);
     delete m_threadedChannelizer;
     delete m_channelizer;
+    m_deviceAPI->releasePolyphaseChannelizer();
 }
 
 float arctan2(Real y, Real x)
@@ -165,168 +174,206 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
         if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
         {
+            processOneSample(ci, 1.0 / (SDR_RX_SCALED*SDR_RX_SCALED));
+            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        }
+	}
 
-            qint16 sample;
+	flushAudio();
+	m_settingsMutex.unlock();
+}
 
-            double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
-            Real deviation;
+/** Float baseband is already normalized to +/-1.0 so samples are taken as they are */
+void NFMDemod::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool firstOfBurst)
+{
+    (void) firstOfBurst;
+	Complex ci;
 
-            Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
+	if (!m_running) {
+	    return;
+	}
 
-            Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
-            m_movingAverage(magsq);
-            m_magsqSum += magsq;
+	m_settingsMutex.lock();
 
-            if (magsq > m_magsqPeak)
-            {
-                m_magsqPeak = magsq;
-            }
+	for (FSampleVector::const_iterator it = begin; it != end; ++it)
+	{
+		Complex c(it->m_real, it->m_imag);
+		c *= m_nco.nextIQ();
 
-            m_magsqCount++;
-            m_sampleCount++;
+        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
+        {
+            processOneSample(ci, 1.0);
+            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        }
+	}
 
-            // AF processing
+	flushAudio();
+	m_settingsMutex.unlock();
+}
 
-            if (m_settings.m_deltaSquelch)
-            {
-                if (m_afSquelch.analyze(demod * m_discriCompensation))
-                {
-                    m_afSquelchOpen = m_afSquelch.evaluate(); // ? m_squelchGate + m_squelchDecay : 0;
+/** Demodulate one channel sample. magsqNorm brings the squared magnitude of ci to full scale 1.0 */
+void NFMDemod::processOneSample(Complex &ci, double magsqNorm)
+{
+    qint16 sample;
 
-                    if (!m_afSquelchOpen) {
-                        m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
-                    }
-                }
+    double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
+    Real deviation;
 
-                if (m_afSquelchOpen)
-                {
-                    m_squelchDelayLine.write(demod * m_discriCompensation);
+    Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
 
-                    if (m_squelchCount < 2*m_squelchGate) {
-                        m_squelchCount++;
-                    }
-                }
-                else
-                {
-                    m_squelchDelayLine.write(0);
+    Real magsq = magsqRaw * magsqNorm;
+    m_movingAverage(magsq);
+    m_magsqSum += magsq;
 
-                    if (m_squelchCount > 0) {
-                        m_squelchCount--;
-                    }
-                }
+    if (magsq > m_magsqPeak)
+    {
+        m_magsqPeak = magsq;
+    }
+
+    m_magsqCount++;
+    m_sampleCount++;
+
+    // AF processing
+
+    if (m_settings.m_deltaSquelch)
+    {
+        if (m_afSquelch.analyze(demod * m_discriCompensation))
+        {
+            m_afSquelchOpen = m_afSquelch.evaluate(); // ? m_squelchGate + m_squelchDecay : 0;
+
+            if (!m_afSquelchOpen) {
+                m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
             }
-            else
-            {
-                if ((Real) m_movingAverage < m_squelchLevel)
-                {
-                    m_squelchDelayLine.write(0);
+        }
 
-                    if (m_squelchCount > 0) {
-                        m_squelchCount--;
-                    }
-                }
-                else
-                {
-                    m_squelchDelayLine.write(demod * m_discriCompensation);
+        if (m_afSquelchOpen)
+        {
+            m_squelchDelayLine.write(demod * m_discriCompensation);
 
-                    if (m_squelchCount < 2*m_squelchGate) {
-                        m_squelchCount++;
-                    }
-                }
+            if (m_squelchCount < 2*m_squelchGate) {
+                m_squelchCount++;
+            }
+        }
+        else
+        {
+            m_squelchDelayLine.write(0);
+
+            if (m_squelchCount > 0) {
+                m_squelchCount--;
             }
+        }
+    }
+    else
+    {
+        if ((Real) m_movingAverage < m_squelchLevel)
+        {
+            m_squelchDelayLine.write(0);
 
-            m_squelchOpen = (m_squelchCount > m_squelchGate);
+            if (m_squelchCount > 0) {
+                m_squelchCount--;
+            }
+        }
+        else
+        {
+            m_squelchDelayLine.write(demod * m_discriCompensation);
 
-            if (m_settings.m_audioMute)
-            {
-                sample = 0;
+            if (m_squelchCount < 2*m_squelchGate) {
+                m_squelchCount++;
             }
-            else
+        }
+    }
+
+    m_squelchOpen = (m_squelchCount > m_squelchGate);
+
+    if (m_settings.m_audioMute)
+    {
+        sample = 0;
+    }
+    else
+    {
+        if (m_squelchOpen)
+        {
+            if (m_settings.m_ctcssOn)
             {
-                if (m_squelchOpen)
+                Real ctcss_sample = m_lowpass.filter(demod * m_discriCompensation);
+
+                if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
                 {
-                    if (m_settings.m_ctcssOn)
+                    if (m_ctcssDetector.analyze(&ctcss_sample))
                     {
-                        Real ctcss_sample = m_lowpass.filter(demod * m_discriCompensation);
+                        int maxToneIndex;
 
-                        if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
+                        if (m_ctcssDetector.getDetectedTone(maxToneIndex))
                         {
-                            if (m_ctcssDetector.analyze(&ctcss_sample))
+                            if (maxToneIndex+1 != m_ctcssIndex)
                             {
-                                int maxToneIndex;
-
-                                if (m_ctcssDetector.getDetectedTone(maxToneIndex))
-                                {
-                                    if (maxToneIndex+1 != m_ctcssIndex)
-                                    {
-                                        if (getMessageQueueToGUI()) {
-                                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
-                                            getMessageQueueToGUI()->push(msg);
-                                        }
-                                        m_ctcssIndex = maxToneIndex+1;
-                                    }
+                                if (getMessageQueueToGUI()) {
+                                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
+                                    getMessageQueueToGUI()->push(msg);
                                 }
-                                else
-                                {
-                                    if (m_ctcssIndex != 0)
-                                    {
-                                        if (getMessageQueueToGUI()) {
-                                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                                            getMessageQueueToGUI()->push(msg);
-                                        }
-                                        m_ctcssIndex = 0;
-                                    }
+                                m_ctcssIndex = maxToneIndex+1;
+                            }
+                        }
+                        else
+                        {
+                            if (m_ctcssIndex != 0)
+                            {
+                                if (getMessageQueueToGUI()) {
+                                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                                    getMessageQueueToGUI()->push(msg);
                                 }
+                                m_ctcssIndex = 0;
                             }
                         }
                     }
-
-                    if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
-                    {
-                        sample = 0;
-                    }
-                    else
-                    {
-                        sample = m_bandpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume;
-                    }
                 }
-                else
-                {
-                    if (m_ctcssIndex != 0)
-                    {
-                        if (getMessageQueueToGUI()) {
-                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                            getMessageQueueToGUI()->push(msg);
-                        }
-
-                        m_ctcssIndex = 0;
-                    }
+            }
 
-                    sample = 0;
-                }
+            if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
+            {
+                sample = 0;
             }
+            else
+            {
+                sample = m_bandpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume;
+            }
+        }
+        else
+        {
+            if (m_ctcssIndex != 0)
+            {
+                if (getMessageQueueToGUI()) {
+                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                    getMessageQueueToGUI()->push(msg);
+                }
 
+                m_ctcssIndex = 0;
+            }
 
-            m_audioBuffer[m_audioBufferFill].l = sample;
-            m_audioBuffer[m_audioBufferFill].r = sample;
-            ++m_audioBufferFill;
+            sample = 0;
+        }
+    }
 
-            if (m_audioBufferFill >= m_audioBuffer.size())
-            {
-                uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-                if (res != m_audioBufferFill)
-                {
-                    qDebug("NFMDemod::feed: %u/%u audio samples written", res, m_audioBufferFill);
-                }
+    m_audioBuffer[m_audioBufferFill].l = sample;
+    m_audioBuffer[m_audioBufferFill].r = sample;
+    ++m_audioBufferFill;
 
-                m_audioBufferFill = 0;
-            }
+    if (m_audioBufferFill >= m_audioBuffer.size())
+    {
+        uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        if (res != m_audioBufferFill)
+        {
+            qDebug("NFMDemod::feed: %u/%u audio samples written", res, m_audioBufferFill);
         }
-	}
 
+        m_audioBufferFill = 0;
+    }
+}
+
+void NFMDemod::flushAudio()
+{
 	if (m_audioBufferFill > 0)
 	{
 		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
@@ -338,8 +385,6 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
 		m_audioBufferFill = 0;
 	}
-
-	m_settingsMutex.unlock();
 }
 
 void NFMDemod::start()
@@ -360,67 +405,71 @@ void NFMDemod::stop()
 
 bool NFMDemod::handleMessage(const Message& cmd)
 {
-	if (DownChannelizer::MsgChannelizerNotification::match(cmd))
-	{
-		DownChannelizer::MsgChannelizerNotification& notif = (DownChannelizer::MsgChannelizerNotification&) cmd;
-		qDebug() << "NFMDemod::handleMessage: DownChannelizer::MsgChannelizerNotification";
+    return m_messageDispatcher.dispatch(this, cmd);
+}
 
-		applyChannelSettings(notif.getSampleRate(), notif.getFrequencyOffset());
+bool NFMDemod::handleChannelizerNotification(const Message& cmd)
+{
+    DownChannelizer::MsgChannelizerNotification& notif = (DownChannelizer::MsgChannelizerNotification&) cmd;
+    qDebug() << "NFMDemod::handleMessage: DownChannelizer::MsgChannelizerNotification";
 
-		return true;
-	}
-    else if (MsgConfigureChannelizer::match(cmd))
-    {
-        MsgConfigureChannelizer& cfg = (MsgConfigureChannelizer&) cmd;
+    applyChannelSettings(notif.getSampleRate(), notif.getFrequencyOffset());
 
-        qDebug() << "NFMDemod::handleMessage: MsgConfigureChannelizer:"
-                 << " sampleRate: " << cfg.getSampleRate()
-                 << " centerFrequency: " << cfg.getCenterFrequency();
+    return true;
+}
 
-        m_channelizer->configure(m_channelizer->getInputMessageQueue(),
-            cfg.getSampleRate(),
-            cfg.getCenterFrequency());
+bool NFMDemod::handleConfigureChannelizer(const Message& cmd)
+{
+    MsgConfigureChannelizer& cfg = (MsgConfigureChannelizer&) cmd;
 
-        return true;
-    }
-	else if (MsgConfigureNFMDemod::match(cmd))
-	{
-	    MsgConfigureNFMDemod& cfg = (MsgConfigureNFMDemod&) cmd;
-		qDebug() << "NFMDemod::handleMessage: MsgConfigureNFMDemod";
+    qDebug() << "NFMDemod::handleMessage: MsgConfigureChannelizer:"
+             << " sampleRate: " << cfg.getSampleRate()
+             << " centerFrequency: " << cfg.getCenterFrequency();
 
-        applySettings(cfg.getSettings(), cfg.getForce());
+    m_channelizer->configure(m_channelizer->getInputMessageQueue(),
+        cfg.getSampleRate(),
+        cfg.getCenterFrequency());
 
-        return true;
-	}
-	else if (BasebandSampleSink::MsgThreadedSink::match(cmd))
-	{
-	    BasebandSampleSink::MsgThreadedSink& cfg = (BasebandSampleSink::MsgThreadedSink&) cmd;
-	    const QThread *thread = cfg.getThread();
-	    qDebug("NFMDemod::handleMessage: BasebandSampleSink::MsgThreadedSink: %p", thread);
-	    return true;
-	}
-    else if (DSPConfigureAudio::match(cmd))
-    {
-        DSPConfigureAudio& cfg = (DSPConfigureAudio&) cmd;
-        uint32_t sampleRate = cfg.getSampleRate();
+    return true;
+}
 
-        qDebug() << "NFMDemod::handleMessage: DSPConfigureAudio:"
-                << " sampleRate: " << sampleRate;
+bool NFMDemod::handleConfigureNFMDemod(const Message& cmd)
+{
+    MsgConfigureNFMDemod& cfg = (MsgConfigureNFMDemod&) cmd;
+    qDebug() << "NFMDemod::handleMessage: MsgConfigureNFMDemod";
 
-        if (sampleRate != m_audioSampleRate) {
-            applyAudioSampleRate(sampleRate);
-        }
+    applySettings(cfg.getSettings(), cfg.getForce());
+
+    return true;
+}
+
+bool NFMDemod::handleThreadedSink(const Message& cmd)
+{
+    BasebandSampleSink::MsgThreadedSink& cfg = (BasebandSampleSink::MsgThreadedSink&) cmd;
+    const QThread *thread = cfg.getThread();
+    qDebug("NFMDemod::handleMessage: BasebandSampleSink::MsgThreadedSink: %p", thread);
+    return true;
+}
+
+bool NFMDemod::handleConfigureAudio(const Message& cmd)
+{
+    DSPConfigureAudio& cfg = (DSPConfigureAudio&) cmd;
+    uint32_t sampleRate = cfg.getSampleRate();
 
-        return true;
+    qDebug() << "NFMDemod::handleMessage: DSPConfigureAudio:"
+            << " sampleRate: " << sampleRate;
+
+    if (sampleRate != m_audioSampleRate) {
+        applyAudioSampleRate(sampleRate);
     }
-	else if (DSPSignalNotification::match(cmd))
-	{
-	    return true;
-	}
-	else
-	{
-		return false;
-	}
+
+    return true;
+}
+
+bool NFMDemod::handleSignalNotification(const Message& cmd)
+{
+    (void) cmd;
+    return true;
 }
 
 void NFMDemod::applyAudioSampleRate(int sampleRate)
@@ -36,6 +36,7 @@
 #include "dsp/ctcssdetector.h"
 #include "audio/audiofifo.h"
 #include "util/message.h"
+#include "util/messagedispatcher.h"
 #include "util/movingaverage.h"
 #include "util/doublebufferfifo.h"
 
@@ -121,6 +122,7 @@ public:
 	virtual void destroy() { delete this; }
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool po);
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
@@ -244,12 +246,22 @@ private:
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
 
+    MessageDispatcher<NFMDemod> m_messageDispatcher;
+
     static const int m_udpBlockSize;
 
 //    void apply(bool force = false);
     void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
     void applyAudioSampleRate(int sampleRate);
+    void processOneSample(Complex &ci, double magsqNorm);
+    void flushAudio();
+    bool handleChannelizerNotification(const Message& cmd);
+    bool handleConfigureChannelizer(const Message& cmd);
+    bool handleConfigureNFMDemod(const Message& cmd);
+    bool handleThreadedSink(const Message& cmd);
+    bool handleConfigureAudio(const Message& cmd);
+    bool handleSignalNotification(const Message& cmd);
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const NFMDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMDemodSettings& settings, bool force);
@@ -26,6 +26,13 @@
 #include <channel/remotedatablock.h>
 #include <QUdpSocket>
 
+#ifdef REMOTESINK_SENDMMSG
+#include <netinet/in.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#endif
+
 #include "cm256cc/cm256.h"
 
 MESSAGE_CLASS_DEFINITION(RemoteSinkThread::MsgStartStop, Message)
@@ -34,8 +41,16 @@ RemoteSinkThread::RemoteSinkThread(QObject* parent) :
     QThread(parent),
     m_running(false),
     m_address(QHostAddress::LocalHost),
-    m_socket(0)
+    m_socket(0),
+    m_txDelay(0)
 {
+#ifdef REMOTESINK_SENDMMSG
+    m_mmsgSocket = -1;
+    memset(&m_mmsgAddress, 0, sizeof(m_mmsgAddress));
+    m_mmsgAddressLength = 0;
+    m_mmsgPort = 0;
+    m_mmsgFailed = false;
+#endif
 
     m_cm256p = m_cm256.isInitialized() ? &m_cm256 : 0;
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
@@ -68,6 +83,9 @@ void RemoteSinkThread::stopWork()
 	qDebug("RemoteSinkThread::stopWork");
     delete m_socket;
     m_socket = 0;
+#ifdef REMOTESINK_SENDMMSG
+    closeMmsgSocket();
+#endif
 	m_running = false;
 	wait();
 }
@@ -106,16 +124,16 @@ void RemoteSinkThread::handleDataBlock(RemoteDataBlock& dataBlock)
     uint16_t dataPort = dataBlock.m_txControlBlock.m_dataPort;
     RemoteSuperBlock *txBlockx = dataBlock.m_superBlocks;
 
+    if (txDelay != m_txDelay)
+    {
+        m_txDelay = txDelay;
+        m_txBucket.setRate(txDelay > 0 ? 1e6 / txDelay : 0.0, m_txBurstSize); // blocks per second
+    }
+
     if ((nbBlocksFEC == 0) || !m_cm256p) // Do not FEC encode
     {
-        if (m_socket)
-        {
-            for (int i = 0; i < RemoteNbOrginalBlocks; i++)
-            {
-                // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
-                usleep(txDelay);
-            }
+        if (m_socket) {
+            sendBlocks(txBlockx, RemoteNbOrginalBlocks, dataPort);
         }
     }
     else
@@ -153,19 +171,165 @@ void RemoteSinkThread::handleDataBlock(RemoteDataBlock& dataBlock)
         }
 
         // Transmit all blocks
-        if (m_socket)
+        if (m_socket) {
+            sendBlocks(txBlockx, cm256Params.OriginalCount + cm256Params.RecoveryCount, dataPort);
+        }
+    }
+
+    dataBlock.m_txControlBlock.m_processed = true;
+}
+
+void RemoteSinkThread::sendBlocks(RemoteSuperBlock *txBlocks, int nbBlocks, uint16_t dataPort)
+{
+#ifdef REMOTESINK_SENDMMSG
+    bool useMmsg = setupMmsgDestination(dataPort);
+#endif
+    int sent = 0;
+
+    // Send in bursts paced by the token bucket or all at once if unlimited
+    while (sent < nbBlocks)
+    {
+        int burst = m_txBucket.isUnlimited() ? nbBlocks - sent : std::min(nbBlocks - sent, m_txBurstSize);
+        int burstSent = 0;
+        m_txBucket.take(burst);
+
+#ifdef REMOTESINK_SENDMMSG
+        if (useMmsg)
         {
-            for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; i++)
-            {
-                // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
-                usleep(txDelay);
+            burstSent = sendBlocksMmsg(&txBlocks[sent], burst);
+            useMmsg = burstSent == burst;
+        }
+#endif
+        for (int i = burstSent; i < burst; i++) {
+            m_socket->writeDatagram((const char*) &txBlocks[sent + i], (qint64) RemoteUdpSize, m_address, dataPort);
+        }
+
+        sent += burst;
+    }
+}
+
+#ifdef REMOTESINK_SENDMMSG
+bool RemoteSinkThread::setupMmsgDestination(uint16_t dataPort)
+{
+    if ((m_address == m_mmsgHostAddress) && (dataPort == m_mmsgPort))
+    {
+        if (m_mmsgFailed) { // fallback latched for this destination
+            return false;
+        }
+
+        if (m_mmsgSocket >= 0) {
+            return true;
+        }
+    }
+    else
+    {
+        m_mmsgFailed = false; // give sendmmsg another chance with a new destination
+    }
+
+    int previousFamily = m_mmsgAddress.ss_family;
+    memset(&m_mmsgAddress, 0, sizeof(m_mmsgAddress));
+
+    if (m_address.protocol() == QAbstractSocket::IPv4Protocol)
+    {
+        sockaddr_in *address = (sockaddr_in *) &m_mmsgAddress;
+        address->sin_family = AF_INET;
+        address->sin_port = htons(dataPort);
+        address->sin_addr.s_addr = htonl(m_address.toIPv4Address());
+        m_mmsgAddressLength = sizeof(sockaddr_in);
+    }
+    else if (m_address.protocol() == QAbstractSocket::IPv6Protocol)
+    {
+        sockaddr_in6 *address = (sockaddr_in6 *) &m_mmsgAddress;
+        Q_IPV6ADDR ipv6 = m_address.toIPv6Address();
+        address->sin6_family = AF_INET6;
+        address->sin6_port = htons(dataPort);
+        memcpy(&address->sin6_addr, &ipv6, sizeof(address->sin6_addr));
+        m_mmsgAddressLength = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        closeMmsgSocket();
+        return false;
+    }
+
+    if ((m_mmsgSocket >= 0) && (previousFamily != m_mmsgAddress.ss_family)) {
+        closeMmsgSocket();
+    }
+
+    if (m_mmsgSocket < 0)
+    {
+        m_mmsgSocket = ::socket(m_mmsgAddress.ss_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+        if (m_mmsgSocket < 0)
+        {
+            qWarning("RemoteSinkThread::setupMmsgDestination: cannot create socket: %s. Using Qt socket", strerror(errno));
+            m_mmsgHostAddress = m_address;
+            m_mmsgPort = dataPort;
+            m_mmsgFailed = true;
+            return false;
+        }
+
+        int sendBufferSize = 256 * RemoteUdpSize; // room for a full frame
+
+        if (setsockopt(m_mmsgSocket, SOL_SOCKET, SO_SNDBUF, &sendBufferSize, sizeof(sendBufferSize)) < 0) {
+            qWarning("RemoteSinkThread::setupMmsgDestination: cannot set send buffer size: %s", strerror(errno));
+        }
+    }
+
+    m_mmsgHostAddress = m_address;
+    m_mmsgPort = dataPort;
+    qDebug("RemoteSinkThread::setupMmsgDestination: %s:%u", qPrintable(m_address.toString()), dataPort);
+
+    return true;
+}
+
+int RemoteSinkThread::sendBlocksMmsg(RemoteSuperBlock *txBlocks, int nbBlocks)
+{
+    // Datagrams are sent straight from the super blocks array
+    for (int i = 0; i < nbBlocks; i++)
+    {
+        m_mmsgIovecs[i].iov_base = (void *) &txBlocks[i];
+        m_mmsgIovecs[i].iov_len = RemoteUdpSize;
+        memset(&m_mmsgHeaders[i], 0, sizeof(struct mmsghdr));
+        m_mmsgHeaders[i].msg_hdr.msg_name = (void *) &m_mmsgAddress;
+        m_mmsgHeaders[i].msg_hdr.msg_namelen = m_mmsgAddressLength;
+        m_mmsgHeaders[i].msg_hdr.msg_iov = &m_mmsgIovecs[i];
+        m_mmsgHeaders[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int sent = 0;
+
+    while (sent < nbBlocks)
+    {
+        int ret = sendmmsg(m_mmsgSocket, &m_mmsgHeaders[sent], nbBlocks - sent, 0);
+
+        if (ret < 0)
+        {
+            if (errno == EINTR) {
+                continue;
             }
+
+            qWarning("RemoteSinkThread::sendBlocksMmsg: sendmmsg failed: %s. Falling back to Qt socket for this destination", strerror(errno));
+            closeMmsgSocket();
+            m_mmsgFailed = true;
+            break;
         }
+
+        sent += ret;
     }
 
-    dataBlock.m_txControlBlock.m_processed = true;
+    return sent;
+}
+
+void RemoteSinkThread::closeMmsgSocket()
+{
+    if (m_mmsgSocket >= 0)
+    {
+        ::close(m_mmsgSocket);
+        m_mmsgSocket = -1;
+    }
 }
+#endif
 
 void RemoteSinkThread::handleInputMessages()
 {
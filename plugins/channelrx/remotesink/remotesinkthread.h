@@ -33,8 +33,15 @@
 
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "util/tokenbucket.h"
+
+#if defined(__linux__)
+#define REMOTESINK_SENDMMSG // send a whole frame with one system call
+#include <sys/socket.h>
+#endif
 
 class RemoteDataBlock;
+struct RemoteSuperBlock;
 class CM256;
 class QUdpSocket;
 
@@ -80,13 +87,35 @@ private:
     QHostAddress m_address;
     QUdpSocket *m_socket;
 
+    TokenBucket m_txBucket; //!< UDP blocks pacing
+    int m_txDelay;          //!< current delay between blocks in microseconds
+
+#ifdef REMOTESINK_SENDMMSG
+    int m_mmsgSocket;                      //!< native socket used with sendmmsg
+    sockaddr_storage m_mmsgAddress;        //!< destination
+    socklen_t m_mmsgAddressLength;
+    QHostAddress m_mmsgHostAddress;        //!< destination for which m_mmsgAddress was built
+    uint16_t m_mmsgPort;
+    bool m_mmsgFailed;                     //!< sendmmsg failed: the Qt socket is used until the destination changes
+    struct mmsghdr m_mmsgHeaders[256];
+    struct iovec m_mmsgIovecs[256];
+#endif
+
     MessageQueue m_inputMessageQueue;
 
+    static const int m_txBurstSize = 32; //!< maximum number of blocks sent back to back when paced
+
     void startWork();
     void stopWork();
 
     void run();
     void handleDataBlock(RemoteDataBlock& dataBlock);
+    void sendBlocks(RemoteSuperBlock *txBlocks, int nbBlocks, uint16_t dataPort);
+#ifdef REMOTESINK_SENDMMSG
+    int sendBlocksMmsg(RemoteSuperBlock *txBlocks, int nbBlocks);
+    bool setupMmsgDestination(uint16_t dataPort);
+    void closeMmsgSocket();
+#endif
 
 private slots:
     void handleInputMessages();
@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <complex.h>
+#include <algorithm>
 
 #include <QTime>
 #include <QDebug>
@@ -113,10 +114,32 @@ void AMMod::pull(Sample& sample)
 		return;
 	}
 
-	Complex ci;
+	m_settingsMutex.lock();
+	pullOne(sample);
+	m_settingsMutex.unlock();
+}
+
+void AMMod::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+	if (m_settings.m_channelMute)
+	{
+		std::fill(begin, begin + nbSamples, Sample(0, 0));
+		return;
+	}
 
 	m_settingsMutex.lock();
 
+	for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+		pullOne(*begin);
+	}
+
+	m_settingsMutex.unlock();
+}
+
+void AMMod::pullOne(Sample& sample)
+{
+	Complex ci;
+
     if (m_interpolatorDistance > 1.0f) // decimate
     {
     	modulateSample();
@@ -138,8 +161,6 @@ void AMMod::pull(Sample& sample)
 
     ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
 
-    m_settingsMutex.unlock();
-
     double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
 	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
 	m_movingAverage(magsq);
@@ -89,7 +89,7 @@ FreeDVMod::FreeDVMod(DeviceSinkAPI *deviceAPI) :
 	DSPEngine::instance()->getAudioDeviceManager()->addAudioSource(&m_audioFifo, getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getInputSampleRate();
 
-    m_SSBFilter = new fftfilt(m_lowCutoff / m_audioSampleRate, m_hiCutoff / m_audioSampleRate, m_ssbFftLen);
+    m_SSBFilter = new rfftfilt(m_lowCutoff / m_audioSampleRate, m_hiCutoff / m_audioSampleRate, m_ssbFftLen);
     m_SSBFilterBuffer = new Complex[m_ssbFftLen>>1]; // filter returns data exactly half of its size
     std::fill(m_SSBFilterBuffer, m_SSBFilterBuffer+(m_ssbFftLen>>1), Complex{0,0});
 
@@ -212,7 +212,6 @@ void FreeDVMod::pullAF(Complex& sample)
         return;
 	}
 
-    Complex ci;
     fftfilt::cmplx *filtered;
     int n_out = 0;
 
@@ -337,10 +336,8 @@ void FreeDVMod::pullAF(Complex& sample)
         m_iModem = 0;
     }
 
-    ci.real(m_modOut[m_iModem++] / m_scaleFactor);
-    ci.imag(0.0f);
-
-    n_out = m_SSBFilter->runSSB(ci, &filtered, true); // USB
+    Real modSample = m_modOut[m_iModem++] / m_scaleFactor;
+    n_out = m_SSBFilter->runSSB(modSample, &filtered, true); // USB
 
     if (n_out > 0)
     {
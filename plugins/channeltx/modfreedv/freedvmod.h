@@ -287,7 +287,7 @@ private:
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
     bool m_interpolatorConsumed;
-	fftfilt* m_SSBFilter;
+	rfftfilt* m_SSBFilter; //!< modem output is real
 	Complex* m_SSBFilterBuffer;
 	int m_SSBFilterBufferIndex;
 	static const int m_ssbFftLen;
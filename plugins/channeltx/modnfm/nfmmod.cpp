@@ -119,10 +119,32 @@ void NFMMod::pull(Sample& sample)
 		return;
 	}
 
-	Complex ci;
+	m_settingsMutex.lock();
+	pullOne(sample);
+	m_settingsMutex.unlock();
+}
+
+void NFMMod::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+	if (m_settings.m_channelMute)
+	{
+		std::fill(begin, begin + nbSamples, Sample(0, 0));
+		return;
+	}
 
 	m_settingsMutex.lock();
 
+	for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+		pullOne(*begin);
+	}
+
+	m_settingsMutex.unlock();
+}
+
+void NFMMod::pullOne(Sample& sample)
+{
+	Complex ci;
+
     if (m_interpolatorDistance > 1.0f) // decimate
     {
     	modulateSample();
@@ -144,8 +166,6 @@ void NFMMod::pull(Sample& sample)
 
     ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
 
-    m_settingsMutex.unlock();
-
     double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
 	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
 	m_movingAverage(magsq);
@@ -60,6 +60,8 @@ SSBMod::SSBMod(DeviceSinkAPI *deviceAPI) :
     m_inputFrequencyOffset(0),
     m_SSBFilter(0),
     m_DSBFilter(0),
+    m_SSBRealFilter(0),
+    m_DSBRealFilter(0),
 	m_SSBFilterBuffer(0),
 	m_DSBFilterBuffer(0),
 	m_SSBFilterBufferIndex(0),
@@ -81,8 +83,7 @@ SSBMod::SSBMod(DeviceSinkAPI *deviceAPI) :
 	DSPEngine::instance()->getAudioDeviceManager()->addAudioSource(&m_audioFifo, getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getInputSampleRate();
 
-    m_SSBFilter = new fftfilt(m_settings.m_lowCutoff / m_audioSampleRate, m_settings.m_bandwidth / m_audioSampleRate, m_ssbFftLen);
-    m_DSBFilter = new fftfilt((2.0f * m_settings.m_bandwidth) / m_audioSampleRate, 2 * m_ssbFftLen);
+    createFilters(m_settings.m_audioBinaural, m_settings.m_lowCutoff, m_settings.m_bandwidth);
     m_SSBFilterBuffer = new Complex[m_ssbFftLen>>1]; // filter returns data exactly half of its size
     m_DSBFilterBuffer = new Complex[m_ssbFftLen];
     std::fill(m_SSBFilterBuffer, m_SSBFilterBuffer+(m_ssbFftLen>>1), Complex{0,0});
@@ -137,16 +138,34 @@ SSBMod::~SSBMod()
 
     delete m_SSBFilter;
     delete m_DSBFilter;
+    delete m_SSBRealFilter;
+    delete m_DSBRealFilter;
     delete[] m_SSBFilterBuffer;
     delete[] m_DSBFilterBuffer;
 }
 
 void SSBMod::pull(Sample& sample)
 {
-	Complex ci;
+	m_settingsMutex.lock();
+	pullOne(sample);
+	m_settingsMutex.unlock();
+}
 
+void SSBMod::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
 	m_settingsMutex.lock();
 
+	for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+		pullOne(*begin);
+	}
+
+	m_settingsMutex.unlock();
+}
+
+void SSBMod::pullOne(Sample& sample)
+{
+	Complex ci;
+
     if (m_interpolatorDistance > 1.0f) // decimate
     {
     	modulateSample();
@@ -169,8 +188,6 @@ void SSBMod::pull(Sample& sample)
     ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
     ci *= 0.891235351562f * SDR_TX_SCALEF; //scaling at -1 dB to account for possible filter overshoot
 
-    m_settingsMutex.unlock();
-
     double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
 	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
 	m_movingAverage(magsq);
@@ -391,7 +408,26 @@ void SSBMod::pullAF(Complex& sample)
     if ((m_settings.m_modAFInput == SSBModSettings::SSBModInputFile)
        || (m_settings.m_modAFInput == SSBModSettings::SSBModInputAudio)) // real audio
     {
-    	if (m_settings.m_dsb)
+    	if (m_settings.m_dsb && m_DSBRealFilter)
+    	{
+    	    // mono audio is real: the real filter only needs real FFTs both ways
+    		float *filteredReal;
+    		n_out = m_DSBRealFilter->runDSB(ci.real(), &filteredReal);
+
+    		if (n_out > 0)
+    		{
+    			for (int i = 0; i < n_out; i++) {
+    				m_DSBFilterBuffer[i] = Complex{filteredReal[i], 0.0f};
+    			}
+
+    			filtered = m_DSBFilterBuffer;
+    			m_DSBFilterBufferIndex = 0;
+    		}
+
+    		sample = m_DSBFilterBuffer[m_DSBFilterBufferIndex];
+    		m_DSBFilterBufferIndex++;
+    	}
+    	else if (m_settings.m_dsb)
     	{
     		n_out = m_DSBFilter->runDSB(ci, &filtered);
 
@@ -406,7 +442,11 @@ void SSBMod::pullAF(Complex& sample)
     	}
     	else
     	{
-    		n_out = m_SSBFilter->runSSB(ci, &filtered, m_settings.m_usb);
+    		if (m_SSBRealFilter) {
+    			n_out = m_SSBRealFilter->runSSB(ci.real(), &filtered, m_settings.m_usb);
+    		} else {
+    			n_out = m_SSBFilter->runSSB(ci, &filtered, m_settings.m_usb);
+    		}
 
     		if (n_out > 0)
     		{
@@ -665,6 +705,43 @@ void SSBMod::seekFileStream(int seekPercentage)
     }
 }
 
+void SSBMod::createFilters(bool audioBinaural, float lowCutoff, float band)
+{
+    delete m_SSBFilter;
+    delete m_DSBFilter;
+    delete m_SSBRealFilter;
+    delete m_DSBRealFilter;
+    m_SSBFilter = 0;
+    m_DSBFilter = 0;
+    m_SSBRealFilter = 0;
+    m_DSBRealFilter = 0;
+
+    if (audioBinaural)
+    {
+        m_SSBFilter = new fftfilt(lowCutoff / m_audioSampleRate, band / m_audioSampleRate, m_ssbFftLen);
+        m_DSBFilter = new fftfilt((2.0f * band) / m_audioSampleRate, 2 * m_ssbFftLen);
+    }
+    else
+    {
+        m_SSBRealFilter = new rfftfilt(lowCutoff / m_audioSampleRate, band / m_audioSampleRate, m_ssbFftLen);
+        m_DSBRealFilter = new rfftfilt((2.0f * band) / m_audioSampleRate, 2 * m_ssbFftLen);
+    }
+}
+
+void SSBMod::designFilters(float lowCutoff, float band, int sampleRate)
+{
+    if (m_SSBRealFilter)
+    {
+        m_SSBRealFilter->create_filter(lowCutoff / sampleRate, band / sampleRate);
+        m_DSBRealFilter->create_dsb_filter((2.0f * band) / sampleRate);
+    }
+    else
+    {
+        m_SSBFilter->create_filter(lowCutoff / sampleRate, band / sampleRate);
+        m_DSBFilter->create_dsb_filter((2.0f * band) / sampleRate);
+    }
+}
+
 void SSBMod::applyAudioSampleRate(int sampleRate)
 {
     qDebug("SSBMod::applyAudioSampleRate: %d", sampleRate);
@@ -695,8 +772,7 @@ void SSBMod::applyAudioSampleRate(int sampleRate)
         lowCutoff = band - 100.0f;
     }
 
-    m_SSBFilter->create_filter(lowCutoff / sampleRate, band / sampleRate);
-    m_DSBFilter->create_dsb_filter((2.0f * band) / sampleRate);
+    designFilters(lowCutoff, band, sampleRate);
 
     m_settings.m_bandwidth = band;
     m_settings.m_lowCutoff = lowCutoff;
@@ -843,8 +919,18 @@ void SSBMod::applySettings(const SSBModSettings& settings, bool force)
         m_interpolatorConsumed = false;
         m_interpolatorDistance = (Real) m_audioSampleRate / (Real) m_outputSampleRate;
         m_interpolator.create(48, m_audioSampleRate, band, 3.0);
-        m_SSBFilter->create_filter(lowCutoff / m_audioSampleRate, band / m_audioSampleRate);
-        m_DSBFilter->create_dsb_filter((2.0f * band) / m_audioSampleRate);
+        designFilters(lowCutoff, band, m_audioSampleRate);
+        m_settingsMutex.unlock();
+    }
+
+    if (settings.m_audioBinaural != m_settings.m_audioBinaural) // the filters of the other audio mode with their stale overlap are dropped
+    {
+        m_settingsMutex.lock();
+        createFilters(settings.m_audioBinaural, lowCutoff, band);
+        std::fill(m_SSBFilterBuffer, m_SSBFilterBuffer+(m_ssbFftLen>>1), Complex{0,0});
+        std::fill(m_DSBFilterBuffer, m_DSBFilterBuffer+m_ssbFftLen, Complex{0,0});
+        m_SSBFilterBufferIndex = 0;
+        m_DSBFilterBufferIndex = 0;
         m_settingsMutex.unlock();
     }
 
@@ -209,6 +209,7 @@ public:
     void setSpectrumSampleSink(BasebandSampleSink* sampleSink) { m_sampleSink = sampleSink; }
 
     virtual void pull(Sample& sample);
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples);
     virtual void pullAudio(int nbSamples);
     virtual void start();
     virtual void stop();
@@ -276,8 +277,10 @@ private:
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
     bool m_interpolatorConsumed;
-	fftfilt* m_SSBFilter;
-	fftfilt* m_DSBFilter;
+	fftfilt* m_SSBFilter;      //!< binaural audio only
+	fftfilt* m_DSBFilter;      //!< binaural audio only
+	rfftfilt* m_SSBRealFilter; //!< used for mono audio which is real. Mono audio only
+	rfftfilt* m_DSBRealFilter; //!< used for mono audio which is real. Mono audio only
 	Complex* m_SSBFilterBuffer;
 	Complex* m_DSBFilterBuffer;
 	int m_SSBFilterBufferIndex;
@@ -320,8 +323,11 @@ private:
     static const int m_levelNbSamples;
 
     void applyAudioSampleRate(int sampleRate);
+    void createFilters(bool audioBinaural, float lowCutoff, float band); //!< allocate the filters of the audio mode only
+    void designFilters(float lowCutoff, float band, int sampleRate);
     void applyChannelSettings(int basebandSampleRate, int outputSampleRate, int inputFrequencyOffset, bool force = false);
     void applySettings(const SSBModSettings& settings, bool force = false);
+    void pullOne(Sample& sample);
     void pullAF(Complex& sample);
     void calculateLevel(Complex& sample);
     void modulateSample();
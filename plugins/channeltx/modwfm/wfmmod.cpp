@@ -126,12 +126,34 @@ void WFMMod::pull(Sample& sample)
 		return;
 	}
 
+	m_settingsMutex.lock();
+	pullOne(sample);
+	m_settingsMutex.unlock();
+}
+
+void WFMMod::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+	if (m_settings.m_channelMute)
+	{
+		std::fill(begin, begin + nbSamples, Sample(0, 0));
+		return;
+	}
+
+	m_settingsMutex.lock();
+
+	for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+		pullOne(*begin);
+	}
+
+	m_settingsMutex.unlock();
+}
+
+void WFMMod::pullOne(Sample& sample)
+{
 	Complex ci, ri;
     fftfilt::cmplx *rf;
     int rf_out;
 
-	m_settingsMutex.lock();
-
 	if ((m_settings.m_modAFInput == WFMModSettings::WFMModInputFile)
 	   || (m_settings.m_modAFInput == WFMModSettings::WFMModInputAudio))
 	{
@@ -166,8 +188,6 @@ void WFMMod::pull(Sample& sample)
     ci = m_rfFilterBuffer[m_rfFilterBufferIndex] * m_carrierNco.nextIQ(); // shift to carrier frequency
     m_rfFilterBufferIndex++;
 
-    m_settingsMutex.unlock();
-
     double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
 	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
 	m_movingAverage(magsq);
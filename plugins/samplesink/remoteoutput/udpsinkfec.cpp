@@ -44,14 +44,10 @@ UDPSinkFEC::UDPSinkFEC() :
     memset((char *) m_txBlocks, 0, 4*256*sizeof(RemoteSuperBlock));
     memset((char *) &m_superBlock, 0, sizeof(RemoteSuperBlock));
     m_currentMetaFEC.init();
-    m_bufMeta = new uint8_t[m_udpSize];
-    m_buf = new uint8_t[m_udpSize];
 }
 
 UDPSinkFEC::~UDPSinkFEC()
 {
-    delete[] m_buf;
-    delete[] m_bufMeta;
 }
 
 void UDPSinkFEC::start()
@@ -35,7 +35,6 @@ class UDPSinkFEC : public QObject
 {
     Q_OBJECT
 public:
-    static const uint32_t m_udpSize = 512;          //!< Size of UDP block in number of bytes
     static const uint32_t m_nbOriginalBlocks = 128; //!< Number of original blocks in a protected block sequence
 
     /**
@@ -84,8 +83,6 @@ private:
     QHostAddress m_ownAddress;
 
     CRC64        m_crc64;
-    uint8_t*     m_bufMeta;
-    uint8_t*     m_buf;
 
     RemoteMetaDataFEC m_currentMetaFEC;  //!< Meta data for current frame
     uint32_t m_nbBlocksFEC;                 //!< Variable number of FEC blocks
@@ -468,6 +468,7 @@ void AirspyGui::openDeviceSettingsDialog(const QPoint& p)
     dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
     dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
     dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+    dialog.setFileRecordFormat(m_settings.m_fileRecordFormat);
 
     dialog.move(p);
     dialog.exec();
@@ -476,6 +477,7 @@ void AirspyGui::openDeviceSettingsDialog(const QPoint& p)
     m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
     m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
     m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+    m_settings.m_fileRecordFormat = dialog.getFileRecordFormat();
 
     sendSettings();
 }
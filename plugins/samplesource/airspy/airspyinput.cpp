@@ -327,7 +327,7 @@ bool AirspyInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -706,6 +706,9 @@ int AirspyInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getAirspySettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getAirspySettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getAirspySettings()->getUseReverseApi() != 0;
     }
@@ -767,6 +770,8 @@ void AirspyInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& res
         response.getAirspySettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getAirspySettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getAirspySettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getAirspySettings()->getReverseApiAddress()) {
@@ -849,6 +854,9 @@ void AirspyInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgAirspySettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgAirspySettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
@@ -42,6 +42,7 @@ void AirspySettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -70,6 +71,7 @@ QByteArray AirspySettings::serialize() const
     s.writeString(16, m_reverseAPIAddress);
     s.writeU32(17, m_reverseAPIPort);
     s.writeU32(18, m_reverseAPIDeviceIndex);
+    s.writeS32(19, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -116,6 +118,7 @@ bool AirspySettings::deserialize(const QByteArray& data)
 
         d.readU32(18, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(19, &m_fileRecordFormat, 0);
 
 		return true;
 	}
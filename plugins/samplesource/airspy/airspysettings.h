@@ -43,6 +43,7 @@ struct AirspySettings {
     bool m_transverterMode;
     qint64 m_transverterDeltaFrequency;
     QString m_fileRecordName;
+    int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
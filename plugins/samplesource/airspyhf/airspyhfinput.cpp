@@ -96,6 +96,14 @@ bool AirspyHFInput::openDevice()
         return false;
     }
 
+#ifdef SDR_RX_FLOAT_BASEBAND
+    if (!m_sampleFifoF.setSize(1<<19))
+    {
+        qCritical("AirspyHFInput::openDevice: could not allocate float SampleFifo");
+        return false;
+    }
+#endif
+
     if ((m_dev = open_airspyhf_from_serial(m_deviceAPI->getSampleSourceSerial())) == 0)
     {
         qCritical("AirspyHFInput::openDevice: could not open Airspy HF with serial %s", qPrintable(m_deviceAPI->getSampleSourceSerial()));
@@ -178,6 +186,9 @@ bool AirspyHFInput::start()
     }
 
 	m_airspyHFThread->setLog2Decimation(m_settings.m_log2Decim);
+#ifdef SDR_RX_FLOAT_BASEBAND
+	m_airspyHFThread->setSampleFifoF(&m_sampleFifoF);
+#endif
 	m_airspyHFThread->startWork();
 
 	mutexLocker.unlock();
@@ -337,7 +348,7 @@ bool AirspyHFInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -685,6 +696,9 @@ int AirspyHFInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getAirspyHfSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getAirspyHfSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getAirspyHfSettings()->getUseReverseApi() != 0;
     }
@@ -748,6 +762,8 @@ void AirspyHFInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
         response.getAirspyHfSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getAirspyHfSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getAirspyHfSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getAirspyHfSettings()->getReverseApiAddress()) {
@@ -852,6 +868,9 @@ void AirspyHFInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgAirspyHFSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgAirspyHFSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
     if (deviceSettingsKeys.contains("useAGC")) {
         swgAirspyHFSettings->setUseAgc(settings.m_useAGC ? 1 : 0);
     }
@@ -35,6 +35,7 @@ void AirspyHFSettings::resetToDefaults()
     m_transverterDeltaFrequency = 0;
     m_bandIndex = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -69,6 +70,7 @@ QByteArray AirspyHFSettings::serialize() const
     s.writeU32(18, m_attenuatorSteps);
 	s.writeBool(19, m_dcBlock);
 	s.writeBool(20, m_iqCorrection);
+	s.writeS32(21, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -115,6 +117,7 @@ bool AirspyHFSettings::deserialize(const QByteArray& data)
         d.readU32(18, &m_attenuatorSteps, 0);
 		d.readBool(19, &m_dcBlock, false);
 		d.readBool(20, &m_iqCorrection, false);
+		d.readS32(21, &m_fileRecordFormat, 0);
 
 		return true;
 	}
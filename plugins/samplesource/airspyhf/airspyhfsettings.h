@@ -30,6 +30,7 @@ struct AirspyHFSettings
     qint64 m_transverterDeltaFrequency;
     quint32 m_bandIndex;
     QString m_fileRecordName;
+    int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     bool m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -30,6 +30,7 @@ AirspyHFThread::AirspyHFThread(airspyhf_device_t* dev, SampleSinkFifo* sampleFif
 	m_dev(dev),
 	m_convertBuffer(AIRSPYHF_BLOCKSIZE),
 	m_sampleFifo(sampleFifo),
+	m_sampleFifoF(0),
 	m_samplerate(10),
 	m_log2Decim(0)
 {
@@ -69,6 +70,12 @@ void AirspyHFThread::setLog2Decimation(unsigned int log2_decim)
 	m_log2Decim = log2_decim;
 }
 
+void AirspyHFThread::setSampleFifoF(FSampleSinkFifo* sampleFifoF)
+{
+	m_sampleFifoF = sampleFifoF;
+	m_convertBufferF.resize(sampleFifoF ? AIRSPYHF_BLOCKSIZE : 0);
+}
+
 void AirspyHFThread::run()
 {
     airspyhf_error rc;
@@ -137,9 +144,50 @@ void AirspyHFThread::callback(const float* buf, qint32 len)
 }
 
 
+//  Same as callback but samples stay in float
+void AirspyHFThread::callbackF(const float* buf, qint32 len)
+{
+	FSampleVector::iterator it = m_convertBufferF.begin();
+
+    switch (m_log2Decim)
+    {
+    case 0:
+        m_decimatorsF.decimate1(&it, buf, len);
+        break;
+    case 1:
+        m_decimatorsF.decimate2_cen(&it, buf, len);
+        break;
+    case 2:
+        m_decimatorsF.decimate4_cen(&it, buf, len);
+        break;
+    case 3:
+        m_decimatorsF.decimate8_cen(&it, buf, len);
+        break;
+    case 4:
+        m_decimatorsF.decimate16_cen(&it, buf, len);
+        break;
+    case 5:
+        m_decimatorsF.decimate32_cen(&it, buf, len);
+        break;
+    case 6:
+        m_decimatorsF.decimate64_cen(&it, buf, len);
+        break;
+    default:
+        break;
+    }
+
+	m_sampleFifoF->write(m_convertBufferF.begin(), it);
+}
+
 int AirspyHFThread::rx_callback(airspyhf_transfer_t* transfer)
 {
 	qint32 nbIAndQ = transfer->sample_count * 2;
-	m_this->callback((float *) transfer->samples, nbIAndQ);
+
+	if (m_this->m_sampleFifoF) {
+		m_this->callbackF((float *) transfer->samples, nbIAndQ);
+	} else {
+		m_this->callback((float *) transfer->samples, nbIAndQ);
+	}
+
 	return 0;
 }
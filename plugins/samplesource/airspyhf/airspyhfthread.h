@@ -19,12 +19,14 @@
 #define INCLUDE_AIRSPYHFTHREAD_H
 
 #include <dsp/decimatorsfi.h>
+#include <dsp/decimatorsff.h>
 #include <QThread>
 #include <QMutex>
 #include <QWaitCondition>
 #include <libairspyhf/airspyhf.h>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/fsamplesinkfifo.h"
 
 #define AIRSPYHF_BLOCKSIZE (1<<17)
 
@@ -39,6 +41,7 @@ public:
 	void stopWork();
 	void setSamplerate(uint32_t samplerate);
 	void setLog2Decimation(unsigned int log2_decim);
+	void setSampleFifoF(FSampleSinkFifo* sampleFifoF); //!< stream float baseband to this FIFO instead (0 for fixed point). Call before startWork()
 
 private:
 	QMutex m_startWaitMutex;
@@ -49,15 +52,19 @@ private:
 	qint16 m_buf[2*AIRSPYHF_BLOCKSIZE];
 	SampleVector m_convertBuffer;
 	SampleSinkFifo* m_sampleFifo;
+	FSampleVector m_convertBufferF;
+	FSampleSinkFifo* m_sampleFifoF;
 
 	int m_samplerate;
 	unsigned int m_log2Decim;
 	static AirspyHFThread *m_this;
 
 	DecimatorsFI m_decimators;
+	DecimatorsFF m_decimatorsF;
 
 	void run();
 	void callback(const float* buf, qint32 len);
+	void callbackF(const float* buf, qint32 len);
 	static int rx_callback(airspyhf_transfer_t* transfer);
 };
 
@@ -294,7 +294,7 @@ bool Bladerf1Input::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -645,6 +645,8 @@ void Bladerf1Input::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
         response.getBladeRf1InputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getBladeRf1InputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getBladeRf1InputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getBladeRf1InputSettings()->getReverseApiAddress()) {
@@ -708,6 +710,9 @@ int Bladerf1Input::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getBladeRf1InputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getBladeRf1InputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getBladeRf1InputSettings()->getUseReverseApi() != 0;
     }
@@ -815,6 +820,9 @@ void Bladerf1Input::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgBladeRF1Settings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgBladeRF1Settings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
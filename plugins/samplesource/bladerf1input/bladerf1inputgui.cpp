@@ -547,6 +547,7 @@ void Bladerf1InputGui::openDeviceSettingsDialog(const QPoint& p)
     dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
     dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
     dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+    dialog.setFileRecordFormat(m_settings.m_fileRecordFormat);
 
     dialog.move(p);
     dialog.exec();
@@ -555,6 +556,7 @@ void Bladerf1InputGui::openDeviceSettingsDialog(const QPoint& p)
     m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
     m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
     m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+    m_settings.m_fileRecordFormat = dialog.getFileRecordFormat();
 
     sendSettings();
 }
@@ -42,6 +42,7 @@ void BladeRF1InputSettings::resetToDefaults()
 	m_dcBlock = false;
 	m_iqCorrection = false;
 	m_fileRecordName = "";
+	m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -68,6 +69,7 @@ QByteArray BladeRF1InputSettings::serialize() const
     s.writeString(14, m_reverseAPIAddress);
     s.writeU32(15, m_reverseAPIPort);
     s.writeU32(16, m_reverseAPIDeviceIndex);
+    s.writeS32(17, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -114,6 +116,7 @@ bool BladeRF1InputSettings::deserialize(const QByteArray& data)
 
         d.readU32(16, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(17, &m_fileRecordFormat, 0);
 
 		return true;
 	}
@@ -724,7 +724,7 @@ bool BladeRF2Input::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -1099,6 +1099,9 @@ int BladeRF2Input::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getBladeRf2InputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getBladeRf2InputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getBladeRf2InputSettings()->getUseReverseApi() != 0;
     }
@@ -1156,6 +1159,8 @@ void BladeRF2Input::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
         response.getBladeRf2InputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getBladeRf2InputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getBladeRf2InputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getBladeRf2InputSettings()->getReverseApiAddress()) {
@@ -1285,6 +1290,9 @@ void BladeRF2Input::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgBladeRF2Settings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgBladeRF2Settings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
     if (deviceSettingsKeys.contains("devSampleRate")) {
         swgBladeRF2Settings->setDevSampleRate(settings.m_devSampleRate);
     }
@@ -538,6 +538,7 @@ void BladeRF2InputGui::openDeviceSettingsDialog(const QPoint& p)
     dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
     dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
     dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+    dialog.setFileRecordFormat(m_settings.m_fileRecordFormat);
 
     dialog.move(p);
     dialog.exec();
@@ -546,6 +547,7 @@ void BladeRF2InputGui::openDeviceSettingsDialog(const QPoint& p)
     m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
     m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
     m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+    m_settings.m_fileRecordFormat = dialog.getFileRecordFormat();
 
     sendSettings();
 }
@@ -40,6 +40,7 @@ void BladeRF2InputSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -66,6 +67,7 @@ QByteArray BladeRF2InputSettings::serialize() const
     s.writeString(14, m_reverseAPIAddress);
     s.writeU32(15, m_reverseAPIPort);
     s.writeU32(16, m_reverseAPIDeviceIndex);
+    s.writeS32(17, m_fileRecordFormat);
 
     return s.final();
 }
@@ -110,6 +112,7 @@ bool BladeRF2InputSettings::deserialize(const QByteArray& data)
 
         d.readU32(16, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(17, &m_fileRecordFormat, 0);
 
         return true;
     }
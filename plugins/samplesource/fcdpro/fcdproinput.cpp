@@ -301,7 +301,7 @@ bool FCDProInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -948,6 +948,9 @@ int FCDProInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getFcdProSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getFcdProSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getFcdProSettings()->getUseReverseApi() != 0;
     }
@@ -1007,6 +1010,8 @@ void FCDProInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& res
         response.getFcdProSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getFcdProSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getFcdProSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getFcdProSettings()->getReverseApiAddress()) {
@@ -1105,6 +1110,9 @@ void FCDProInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgFCDProSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgFCDProSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
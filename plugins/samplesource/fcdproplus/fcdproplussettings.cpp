@@ -42,6 +42,7 @@ void FCDProPlusSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -69,6 +70,7 @@ QByteArray FCDProPlusSettings::serialize() const
     s.writeString(15, m_reverseAPIAddress);
     s.writeU32(16, m_reverseAPIPort);
     s.writeU32(17, m_reverseAPIDeviceIndex);
+    s.writeS32(18, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -114,6 +116,7 @@ bool FCDProPlusSettings::deserialize(const QByteArray& data)
 
         d.readU32(17, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(18, &m_fileRecordFormat, 0);
 		return true;
 	}
 	else
@@ -242,7 +242,10 @@ void FileSourceGui::displaySettings()
 {
     blockApplySettings(true);
     ui->playLoop->setChecked(m_settings.m_loop);
-    ui->acceleration->setCurrentIndex(FileSourceSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
+    ui->acceleration->setCurrentIndex(m_settings.m_asFastAsPossible ?
+        ui->acceleration->count() - 1 : // as fast as possible is the last item
+        FileSourceSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
+    ui->readAhead->setValue(m_settings.m_readAheadMs);
     blockApplySettings(false);
 }
 
@@ -320,7 +323,7 @@ void FileSourceGui::on_showFileDialog_clicked(bool checked)
 {
     (void) checked;
 	QString fileName = QFileDialog::getOpenFileName(this,
-	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq)"), 0, QFileDialog::DontUseNativeDialog);
+	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.sdriqz)"), 0, QFileDialog::DontUseNativeDialog);
 
 	if (fileName != "")
 	{
@@ -335,7 +338,22 @@ void FileSourceGui::on_acceleration_currentIndexChanged(int index)
 {
     if (m_doApplySettings)
     {
-        m_settings.m_accelerationFactor = FileSourceSettings::getAccelerationValue(index);
+        m_settings.m_asFastAsPossible = index == ui->acceleration->count() - 1;
+
+        if (!m_settings.m_asFastAsPossible) {
+            m_settings.m_accelerationFactor = FileSourceSettings::getAccelerationValue(index);
+        }
+
+        FileSourceInput::MsgConfigureFileSource *message = FileSourceInput::MsgConfigureFileSource::create(m_settings, false);
+        m_sampleSource->getInputMessageQueue()->push(message);
+    }
+}
+
+void FileSourceGui::on_readAhead_valueChanged(int value)
+{
+    if (m_doApplySettings)
+    {
+        m_settings.m_readAheadMs = value;
         FileSourceInput::MsgConfigureFileSource *message = FileSourceInput::MsgConfigureFileSource::create(m_settings, false);
         m_sampleSource->getInputMessageQueue()->push(message);
     }
@@ -427,6 +445,7 @@ void FileSourceGui::setAccelerationCombo()
         ui->acceleration->addItem(s);
     }
 
+    ui->acceleration->addItem(QString("Max")); // as fast as possible
     ui->acceleration->blockSignals(false);
 }
 
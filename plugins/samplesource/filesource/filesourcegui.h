@@ -96,6 +96,7 @@ private slots:
 	void on_navTimeSlider_valueChanged(int value);
 	void on_showFileDialog_clicked(bool checked);
 	void on_acceleration_currentIndexChanged(int index);
+	void on_readAhead_valueChanged(int value);
     void updateStatus();
 	void tick();
     void openDeviceSettingsDialog(const QPoint& p);
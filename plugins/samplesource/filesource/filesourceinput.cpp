@@ -32,6 +32,7 @@
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 #include "dsp/filerecord.h"
+#include "dsp/filerecordcodec.h"
 #include "device/devicesourceapi.h"
 
 #include "filesourceinput.h"
@@ -52,7 +53,11 @@ MESSAGE_CLASS_DEFINITION(FileSourceInput::MsgReportHeaderCRC, Message)
 FileSourceInput::FileSourceInput(DeviceSourceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
 	m_settings(),
+	m_mappedData(0),
+	m_mappedSize(0),
+	m_compressed(false),
 	m_fileSourceThread(NULL),
+	m_endOfStream(false),
 	m_deviceDescription(),
 	m_fileName("..."),
 	m_sampleRate(0),
@@ -75,6 +80,7 @@ FileSourceInput::~FileSourceInput()
     delete m_networkManager;
 
 	stop();
+	unmapFile();
 }
 
 void FileSourceInput::destroy()
@@ -90,6 +96,8 @@ void FileSourceInput::openFileStream()
 		m_ifstream.close();
 	}
 
+	m_blockReader.close();
+	m_compressed = false;
 	m_ifstream.open(m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
 	quint64 fileSize = m_ifstream.tellg();
 
@@ -104,7 +112,24 @@ void FileSourceInput::openFileStream()
 		m_sampleSize = header.sampleSize;
 		QString crcHex = QString("%1").arg(header.crc32 , 0, 16);
 
-	    if (crcOK)
+	    if (crcOK && (header.filler == FileRecordCodec::m_formatMarker))
+	    {
+	        qDebug("FileSourceInput::openFileStream: CRC32 OK for compressed block file header: %s", qPrintable(crcHex));
+	        mapFile(fileSize); // blocks are decoded from the mapped file only
+
+	        if (m_mappedData && m_blockReader.open(m_mappedData, m_mappedSize) && (m_sampleRate > 0))
+	        {
+	            m_compressed = true;
+	            m_sampleSize = SDR_RX_SAMP_SZ; // decoded to this build sample size
+	            m_recordLength = m_blockReader.getNbSamples() / m_sampleRate;
+	        }
+	        else
+	        {
+	            qCritical("FileSourceInput::openFileStream: cannot read compressed block file");
+	            m_recordLength = 0;
+	        }
+	    }
+	    else if (crcOK)
 	    {
 	        qDebug("FileSourceInput::openFileStream: CRC32 OK for header: %s", qPrintable(crcHex));
 	        m_recordLength = (fileSize - sizeof(FileRecord::Header)) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
@@ -143,9 +168,53 @@ void FileSourceInput::openFileStream()
 
 	if (m_recordLength == 0) {
 	    m_ifstream.close();
+	    m_blockReader.close();
+	    m_compressed = false;
+	    unmapFile();
+	} else if (!m_compressed) {
+	    mapFile(fileSize);
 	}
 }
 
+void FileSourceInput::mapFile(quint64 fileSize)
+{
+    unmapFile();
+    m_mappedFile.setFileName(m_fileName);
+
+    if (!m_mappedFile.open(QIODevice::ReadOnly))
+    {
+        qWarning("FileSourceInput::mapFile: cannot open %s: reading from stream", qPrintable(m_fileName));
+        return;
+    }
+
+    m_mappedData = m_mappedFile.map(0, fileSize);
+
+    if (m_mappedData)
+    {
+        m_mappedSize = fileSize;
+        qDebug("FileSourceInput::mapFile: mapped %llu bytes", m_mappedSize);
+    }
+    else
+    {
+        qWarning("FileSourceInput::mapFile: cannot map %s: reading from stream", qPrintable(m_fileName));
+        m_mappedFile.close();
+    }
+}
+
+void FileSourceInput::unmapFile()
+{
+    if (m_mappedData)
+    {
+        m_mappedFile.unmap((uchar *) m_mappedData);
+        m_mappedData = 0;
+        m_mappedSize = 0;
+    }
+
+    if (m_mappedFile.isOpen()) {
+        m_mappedFile.close();
+    }
+}
+
 void FileSourceInput::seekFileStream(int seekMillis)
 {
 	QMutexLocker mutexLocker(&m_mutex);
@@ -154,9 +223,18 @@ void FileSourceInput::seekFileStream(int seekMillis)
 	{
         quint64 seekPoint = ((m_recordLength * seekMillis) / 1000) * m_sampleRate;
 		m_fileSourceThread->setSamplesCount(seekPoint);
+
+		if (m_compressed)
+		{
+		    m_blockReader.seek(seekPoint); // constant time with the block index
+		    m_fileSourceThread->setMappedPosition(m_blockReader.getDataPosition());
+		    return;
+		}
+
         seekPoint *= (m_sampleSize == 24 ? 8 : 4); // + sizeof(FileSink::Header)
 		m_ifstream.clear();
 		m_ifstream.seekg(seekPoint + sizeof(FileRecord::Header), std::ios::beg);
+		m_fileSourceThread->setMappedPosition(seekPoint + sizeof(FileRecord::Header));
 	}
 }
 
@@ -189,7 +267,19 @@ bool FileSourceInput::start()
 
 	m_fileSourceThread = new FileSourceThread(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
 	m_fileSourceThread->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+	m_fileSourceThread->setMappedFile(m_mappedData, m_mappedSize);
+	m_fileSourceThread->setMappedPosition(sizeof(FileRecord::Header));
+
+	if (m_compressed)
+	{
+	    m_blockReader.seek(0);
+	    m_fileSourceThread->setBlockReader(&m_blockReader);
+	}
+
+	m_fileSourceThread->setReadAhead(m_settings.m_readAheadMs);
+	m_fileSourceThread->setAsFastAsPossible(m_settings.m_asFastAsPossible || DSPEngine::instance()->isOffline());
 	m_fileSourceThread->startWork();
+	m_endOfStream = false;
 	m_deviceDescription = "FileSource";
 
 	mutexLocker.unlock();
@@ -374,13 +464,15 @@ bool FileSourceInput::handleMessage(const Message& message)
             getMessageQueueToGUI()->push(report);
         }
 
-        if (m_settings.m_loop)
+        if (m_settings.m_loop && !DSPEngine::instance()->isOffline()) // offline processing ends with the file
         {
             seekFileStream(0);
             m_fileSourceThread->startWork();
         }
         else
         {
+            m_endOfStream = true;
+
             if (getMessageQueueToGUI())
             {
                 MsgPlayPause *report = MsgPlayPause::create(false);
@@ -419,6 +511,20 @@ bool FileSourceInput::applySettings(const FileSourceSettings& settings, bool for
         }
     }
 
+    if ((m_settings.m_readAheadMs != settings.m_readAheadMs) || force)
+    {
+        if (m_fileSourceThread) {
+            m_fileSourceThread->setReadAhead(settings.m_readAheadMs);
+        }
+    }
+
+    if ((m_settings.m_asFastAsPossible != settings.m_asFastAsPossible) || force)
+    {
+        if (m_fileSourceThread) {
+            m_fileSourceThread->setAsFastAsPossible(settings.m_asFastAsPossible || DSPEngine::instance()->isOffline());
+        }
+    }
+
     if ((m_settings.m_loop != settings.m_loop)) {
         reverseAPIKeys.append("loop");
     }
@@ -459,8 +565,11 @@ int FileSourceInput::webapiSettingsPutPatch(
     (void) errorMessage;
     FileSourceSettings settings = m_settings;
 
-    if (deviceSettingsKeys.contains("fileName")) {
+    if (deviceSettingsKeys.contains("fileName"))
+    {
         settings.m_fileName = *response.getFileSourceSettings()->getFileName();
+        MsgConfigureFileSourceName *msg = MsgConfigureFileSourceName::create(settings.m_fileName); // open it
+        m_inputMessageQueue.push(msg);
     }
     if (deviceSettingsKeys.contains("accelerationFactor")) {
         settings.m_accelerationFactor = response.getFileSourceSettings()->getAccelerationFactor();
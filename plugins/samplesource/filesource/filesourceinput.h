@@ -25,9 +25,11 @@
 #include <QString>
 #include <QByteArray>
 #include <QTimer>
+#include <QFile>
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/filerecordblockreader.h"
 #include "filesourcesettings.h"
 
 class QNetworkAccessManager;
@@ -294,6 +296,7 @@ public:
     quint64 getStartingTimeStamp() const;
 
 	virtual bool handleMessage(const Message& message);
+	virtual bool isEndOfStream() const { return m_endOfStream; }
 
 	virtual int webapiSettingsGet(
 	            SWGSDRangel::SWGDeviceSettings& response,
@@ -323,19 +326,27 @@ public:
 	QMutex m_mutex;
 	FileSourceSettings m_settings;
 	std::ifstream m_ifstream;
+	QFile m_mappedFile;     //!< same file memory mapped for zero copy reads
+	const quint8 *m_mappedData; //!< mapped file or null if the file cannot be mapped
+	quint64 m_mappedSize;
+	FileRecordBlockReader m_blockReader; //!< reads compressed block files from the mapped file
+	bool m_compressed;      //!< file is in compressed block format
 	FileSourceThread* m_fileSourceThread;
+	volatile bool m_endOfStream; //!< end of file reached and not looping
 	QString m_deviceDescription;
 	QString m_fileName;
 	int m_sampleRate;
 	quint32 m_sampleSize;
 	quint64 m_centerFrequency;
-    quint64 m_recordLength; //!< record length in seconds computed from file size
+    quint64 m_recordLength; //!< record length in seconds computed from file size or from the block index
     quint64 m_startingTimeStamp;
 	const QTimer& m_masterTimer;
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
 
 	void openFileStream();
+	void mapFile(quint64 fileSize);
+	void unmapFile();
 	void seekFileStream(int seekMillis);
 	bool applySettings(const FileSourceSettings& settings, bool force = false);
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const FileSourceSettings& settings);
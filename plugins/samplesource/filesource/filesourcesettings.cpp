@@ -33,6 +33,8 @@ void FileSourceSettings::resetToDefaults()
     m_fileName = "./test.sdriq";
     m_accelerationFactor = 1;
     m_loop = true;
+    m_readAheadMs = 1000;
+    m_asFastAsPossible = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -49,6 +51,8 @@ QByteArray FileSourceSettings::serialize() const
     s.writeString(5, m_reverseAPIAddress);
     s.writeU32(6, m_reverseAPIPort);
     s.writeU32(7, m_reverseAPIDeviceIndex);
+    s.writeU32(8, m_readAheadMs);
+    s.writeBool(9, m_asFastAsPossible);
 
     return s.final();
 }
@@ -82,6 +86,9 @@ bool FileSourceSettings::deserialize(const QByteArray& data)
         d.readU32(7, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
 
+        d.readU32(8, &m_readAheadMs, 1000);
+        d.readBool(9, &m_asFastAsPossible, false);
+
         return true;
     }
     else
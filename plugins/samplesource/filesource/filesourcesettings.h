@@ -27,6 +27,8 @@ struct FileSourceSettings {
     QString m_fileName;
     quint32 m_accelerationFactor;
     bool m_loop;
+    quint32 m_readAheadMs;     //!< read ahead window of the memory mapped file reader in milliseconds of samples
+    bool m_asFastAsPossible;   //!< push samples as fast as the DSP engine can take them (offline processing)
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -18,9 +18,16 @@
 #include <stdio.h>
 #include <errno.h>
 #include <assert.h>
+#include <algorithm>
 #include <QDebug>
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 #include "dsp/filerecord.h"
+#include "dsp/filerecordblockreader.h"
 #include "filesourcethread.h"
 #include "dsp/samplesinkfifo.h"
 #include "util/messagequeue.h"
@@ -47,7 +54,16 @@ FileSourceThread::FileSourceThread(std::ifstream *samplesStream,
 	m_samplesize(0),
 	m_samplebytes(0),
     m_throttlems(FILESOURCE_THROTTLE_MS),
-    m_throttleToggle(false)
+    m_throttleToggle(false),
+    m_mappedData(0),
+    m_mappedSize(0),
+    m_mappedPosition(0),
+    m_readAheadPosition(0),
+    m_releasedPosition(0),
+    m_readAheadMs(0),
+    m_readAheadBytes(0),
+    m_asFastAsPossible(false),
+    m_blockReader(0)
 {
     assert(m_ifstream != 0);
 }
@@ -73,14 +89,21 @@ void FileSourceThread::startWork()
 
     if (m_ifstream->is_open())
     {
-        qDebug() << "FileSourceThread::startWork: file stream open, starting...";
+        qDebug() << "FileSourceThread::startWork: file stream open, starting..."
+                << (m_mappedData ? " mapped" : " stream")
+                << (m_asFastAsPossible ? " as fast as possible" : "");
+        m_readAheadPosition = m_mappedPosition;
+        m_releasedPosition = m_mappedPosition & ~(getPageSize() - 1);
         m_startWaitMutex.lock();
         m_elapsedTimer.start();
         start();
         while(!m_running)
             m_startWaiter.wait(&m_startWaitMutex, 100);
         m_startWaitMutex.unlock();
-        connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+
+        if (!m_asFastAsPossible) { // else samples are pushed from the thread loop
+            connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+        }
     }
     else
     {
@@ -93,9 +116,51 @@ void FileSourceThread::stopWork()
 	qDebug() << "FileSourceThread::stopWork";
 	disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
 	m_running = false;
+	m_readAheadMutex.lock();
+	m_readAheadWaiter.wakeAll();
+	m_readAheadMutex.unlock();
+	m_sampleFifo->interruptWaitRoom();
 	wait();
 }
 
+void FileSourceThread::setMappedFile(const quint8 *mappedData, quint64 mappedSize)
+{
+    m_mappedData = mappedData;
+    m_mappedSize = mappedData ? mappedSize : 0;
+    m_mappedPosition = 0;
+
+#ifndef _WIN32
+    if (m_mappedData) {
+        madvise((void *) m_mappedData, m_mappedSize, MADV_SEQUENTIAL);
+    }
+#endif
+}
+
+void FileSourceThread::setReadAhead(quint32 readAheadMs)
+{
+    m_readAheadMs = readAheadMs;
+    m_readAheadBytes.store(((qint64) m_samplerate * 2 * m_samplebytes * m_readAheadMs) / 1000, std::memory_order_release);
+}
+
+void FileSourceThread::setAsFastAsPossible(bool asFastAsPossible)
+{
+    if (asFastAsPossible == m_asFastAsPossible) {
+        return;
+    }
+
+    bool wasRunning = m_running;
+
+    if (wasRunning) {
+        stopWork();
+    }
+
+    m_asFastAsPossible = asFastAsPossible;
+
+    if (wasRunning) {
+        startWork();
+    }
+}
+
 void FileSourceThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
 {
 	qDebug() << "FileSourceThread::setSampleRateAndSize:"
@@ -114,6 +179,7 @@ void FileSourceThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
 		m_samplesize = samplesize;
 		m_samplebytes = m_samplesize > 16 ? sizeof(int32_t) : sizeof(int16_t);
         m_chunksize = (m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
+        m_readAheadBytes.store(((qint64) m_samplerate * 2 * m_samplebytes * m_readAheadMs) / 1000, std::memory_order_release);
 
         setBuffers(m_chunksize);
 	}
@@ -164,14 +230,153 @@ void FileSourceThread::run()
 	m_running = true;
 	m_startWaiter.wakeAll();
 
-	while(m_running) // actual work is in the tick() function
-	{
-		sleep(1);
+	if (m_asFastAsPossible) {
+	    runAsFastAsPossible();
+	} else {
+	    runReadAhead(); // actual work is in the tick() function
 	}
 
 	m_running = false;
 }
 
+void FileSourceThread::runReadAhead()
+{
+    while (m_running)
+    {
+        readAhead();
+
+        m_readAheadMutex.lock();
+
+        if (m_running) {
+            m_readAheadWaiter.wait(&m_readAheadMutex, 100);
+        }
+
+        m_readAheadMutex.unlock();
+    }
+}
+
+void FileSourceThread::runAsFastAsPossible()
+{
+    while (m_running)
+    {
+        unsigned int chunkSamples = m_samplebytes ? m_chunksize / (2 * m_samplebytes) : 0;
+
+        if (chunkSamples == 0)
+        {
+            usleep(1000);
+            continue;
+        }
+
+        if (m_sampleFifo->waitRoom(chunkSamples, 100) < chunkSamples) { // woken up when the DSP engine makes room
+            continue;
+        }
+
+        bool more = readChunk();
+        readAhead();
+
+        if (!more)
+        {
+            MsgReportEOF *message = MsgReportEOF::create();
+            m_fileInputMessageQueue->push(message);
+            break;
+        }
+    }
+}
+
+bool FileSourceThread::readChunk()
+{
+    if (m_blockReader)
+    {
+        // decoded samples are already in this build sample size
+        int nbSamples = m_chunksize / (2 * m_samplebytes);
+        int nbRead = m_blockReader->read((Sample *) m_convertBuf, nbSamples);
+        m_sampleFifo->write(m_convertBuf, nbRead * sizeof(Sample));
+        m_mappedPosition.store(m_blockReader->getDataPosition(), std::memory_order_release);
+        m_samplesCount += nbRead;
+
+        return nbRead == nbSamples;
+    }
+    else if (m_mappedData)
+    {
+        quint64 position = m_mappedPosition.load(std::memory_order_relaxed);
+        qint64 nbBytes = std::min((quint64) m_chunksize, m_mappedSize - position);
+        nbBytes -= nbBytes % (2 * m_samplebytes);
+
+        // samples go straight from the mapped file pages to the FIFO
+        writeToSampleFifo(m_mappedData + position, (qint32) nbBytes);
+        m_mappedPosition.store(position + nbBytes, std::memory_order_release);
+        m_samplesCount += nbBytes / (2 * m_samplebytes);
+
+        return nbBytes == m_chunksize;
+    }
+    else
+    {
+        // read samples directly feeding the SampleFifo (no callback)
+        m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+
+        if (m_ifstream->eof())
+        {
+            writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
+            return false;
+        }
+        else
+        {
+            writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
+            m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            return true;
+        }
+    }
+}
+
+void FileSourceThread::readAhead()
+{
+    if (!m_mappedData) {
+        return;
+    }
+
+    const quint64 pageSize = getPageSize();
+    quint64 position = m_mappedPosition.load(std::memory_order_acquire);
+    quint64 readAheadBytes = m_readAheadBytes.load(std::memory_order_acquire);
+    quint64 end = std::min(position + readAheadBytes, m_mappedSize);
+
+    if (end > m_readAheadPosition)
+    {
+        quint64 start = m_readAheadPosition & ~(pageSize - 1);
+#ifndef _WIN32
+        madvise((void *) (m_mappedData + start), end - start, MADV_WILLNEED);
+#endif
+        // touch each page so that the timer tick never waits on a page fault
+        volatile quint8 touch = 0;
+
+        for (quint64 page = start; page < end; page += pageSize) {
+            touch += m_mappedData[page];
+        }
+
+        m_readAheadPosition = end;
+    }
+
+#ifndef _WIN32
+    // drop pages already consumed so that the resident size does not grow with the file size
+    quint64 releaseEnd = position & ~(pageSize - 1);
+
+    if (releaseEnd > m_releasedPosition)
+    {
+        madvise((void *) (m_mappedData + m_releasedPosition), releaseEnd - m_releasedPosition, MADV_DONTNEED);
+        m_releasedPosition = releaseEnd;
+    }
+#endif
+}
+
+quint64 FileSourceThread::getPageSize()
+{
+#ifndef _WIN32
+    static const quint64 pageSize = sysconf(_SC_PAGESIZE);
+#else
+    static const quint64 pageSize = 4096;
+#endif
+    return pageSize;
+}
+
 void FileSourceThread::tick()
 {
 	if (m_running)
@@ -186,19 +391,17 @@ void FileSourceThread::tick()
             setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
-		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
-
-        if (m_ifstream->eof())
+        if (!readChunk())
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
         	MsgReportEOF *message = MsgReportEOF::create();
         	m_fileInputMessageQueue->push(message);
         }
-        else
+
+        if (m_mappedData)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            m_readAheadMutex.lock();
+            m_readAheadWaiter.wakeOne();
+            m_readAheadMutex.unlock();
         }
 	}
 }
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <atomic>
 
 #include "dsp/inthalfbandfilter.h"
 #include "util/message.h"
@@ -34,6 +35,7 @@
 
 class SampleSinkFifo;
 class MessageQueue;
+class FileRecordBlockReader;
 
 class FileSourceThread : public QThread {
 	Q_OBJECT
@@ -70,11 +72,18 @@ public:
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
     void setSamplesCount(quint64 samplesCount) { m_samplesCount = samplesCount; }
+    void setMappedFile(const quint8 *mappedData, quint64 mappedSize); //!< read from a memory mapped file instead of the stream. Null data to read from the stream.
+    void setMappedPosition(quint64 position) { m_mappedPosition = position; } //!< byte position in mapped file. Only when not running.
+    void setReadAhead(quint32 readAheadMs);       //!< window in milliseconds of samples faulted in ahead of the read position
+    void setAsFastAsPossible(bool asFastAsPossible); //!< push samples as fast as the DSP engine consumes them instead of at the sample rate
+    void setBlockReader(FileRecordBlockReader *blockReader) { m_blockReader = blockReader; } //!< decode a compressed block file from the mapped file. Null for raw files.
 
 private:
 	QMutex m_startWaitMutex;
 	QWaitCondition m_startWaiter;
 	volatile bool m_running;
+	QMutex m_readAheadMutex;
+	QWaitCondition m_readAheadWaiter;
 
 	std::ifstream* m_ifstream;
 	quint8  *m_fileBuf;
@@ -93,7 +102,22 @@ private:
     QElapsedTimer m_elapsedTimer;
     bool m_throttleToggle;
 
+    const quint8 *m_mappedData;            //!< memory mapped file or null if reading from stream
+    quint64 m_mappedSize;                  //!< size of the mapped file in bytes
+    std::atomic<quint64> m_mappedPosition; //!< current read position in the mapped file
+    quint64 m_readAheadPosition;           //!< end of the window already faulted in
+    quint64 m_releasedPosition;            //!< start of the pages not yet released behind the read position
+    quint32 m_readAheadMs;
+    std::atomic<qint64> m_readAheadBytes;  //!< set from the GUI or API thread and read by the read ahead thread
+    bool m_asFastAsPossible;
+    FileRecordBlockReader *m_blockReader;  //!< compressed block file reader or null for raw files
+
 	void run();
+	void runReadAhead();
+	void runAsFastAsPossible();
+	bool readChunk(); //!< read one chunk into the FIFO. Returns false at end of file.
+	void readAhead();
+	static quint64 getPageSize();
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
 private slots:
@@ -41,6 +41,7 @@ void HackRFInputSettings::resetToDefaults()
 	m_iqCorrection = false;
 	m_devSampleRate = 2400000;
 	m_fileRecordName = "";
+	m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -66,6 +67,7 @@ QByteArray HackRFInputSettings::serialize() const
     s.writeString(15, m_reverseAPIAddress);
     s.writeU32(16, m_reverseAPIPort);
     s.writeU32(17, m_reverseAPIDeviceIndex);
+    s.writeS32(18, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -109,6 +111,7 @@ bool HackRFInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(17, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(18, &m_fileRecordFormat, 0);
 
 		return true;
 	}
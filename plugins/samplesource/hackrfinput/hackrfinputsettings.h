@@ -41,6 +41,7 @@ struct HackRFInputSettings {
 	bool m_dcBlock;
 	bool m_iqCorrection;
 	QString m_fileRecordName;
+	int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
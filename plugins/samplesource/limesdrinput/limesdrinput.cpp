@@ -753,7 +753,7 @@ bool LimeSDRInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -1509,6 +1509,9 @@ int LimeSDRInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getLimeSdrInputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getLimeSdrInputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("gpioDir")) {
         settings.m_gpioDir = response.getLimeSdrInputSettings()->getGpioDir() & 0xFF;
     }
@@ -1571,6 +1574,8 @@ void LimeSDRInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& re
         response.getLimeSdrInputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getLimeSdrInputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getLimeSdrInputSettings()->setGpioDir(settings.m_gpioDir);
     response.getLimeSdrInputSettings()->setGpioPins(settings.m_gpioPins);
     response.getLimeSdrInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
@@ -1662,6 +1667,15 @@ void LimeSDRInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& respon
     response.getLimeSdrInputReport()->setTemperature(temp);
     response.getLimeSdrInputReport()->setGpioDir(gpioDir);
     response.getLimeSdrInputReport()->setGpioPins(gpioPins);
+
+    if (m_limeSDRInputThread)
+    {
+        DeviceSamplePipeline::Stats stats;
+        m_limeSDRInputThread->getPipelineStats(stats);
+        response.getLimeSdrInputReport()->setPipelineOverrunCount(stats.m_overruns);
+        response.getLimeSdrInputReport()->setPipelineLatencyAvg(stats.m_latencyAvg);
+        response.getLimeSdrInputReport()->setPipelineLatencyMax(stats.m_latencyMax);
+    }
 }
 
 void LimeSDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const LimeSDRInputSettings& settings, bool force)
@@ -1741,6 +1755,9 @@ void LimeSDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgLimeSdrInputSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgLimeSdrInputSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
     if (deviceSettingsKeys.contains("gpioDir") || force) {
         swgLimeSdrInputSettings->setGpioDir(settings.m_gpioDir & 0xFF);
     }
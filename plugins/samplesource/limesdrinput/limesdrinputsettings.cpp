@@ -47,6 +47,7 @@ void LimeSDRInputSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_gpioDir = 0;
     m_gpioPins = 0;
     m_useReverseAPI = false;
@@ -85,6 +86,7 @@ QByteArray LimeSDRInputSettings::serialize() const
     s.writeString(25, m_reverseAPIAddress);
     s.writeU32(26, m_reverseAPIPort);
     s.writeU32(27, m_reverseAPIDeviceIndex);
+    s.writeS32(28, m_fileRecordFormat);
     return s.final();
 }
 
@@ -141,6 +143,7 @@ bool LimeSDRInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(27, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(28, &m_fileRecordFormat, 0);
 
         return true;
     }
@@ -67,6 +67,7 @@ struct LimeSDRInputSettings
     bool     m_transverterMode;
     qint64   m_transverterDeltaFrequency;
     QString  m_fileRecordName;
+    int      m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     uint8_t  m_gpioDir;      //!< GPIO pin direction LSB first; 0 input, 1 output
     uint8_t  m_gpioPins;     //!< GPIO pins to write; LSB first
     bool     m_useReverseAPI;
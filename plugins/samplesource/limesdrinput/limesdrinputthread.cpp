@@ -25,11 +25,12 @@ LimeSDRInputThread::LimeSDRInputThread(lms_stream_t* stream, SampleSinkFifo* sam
     QThread(parent),
     m_running(false),
     m_stream(stream),
+    m_pipeline(this),
     m_convertBuffer(LIMESDR_BLOCKSIZE),
     m_sampleFifo(sampleFifo),
     m_log2Decim(0)
 {
-    std::fill(m_buf, m_buf + 2*LIMESDR_BLOCKSIZE, 0);
+    m_pipeline.allocate(LIMESDR_NBBUFFERS, 1, 2*LIMESDR_BLOCKSIZE*sizeof(qint16)); // I+Q values of each sample
 }
 
 LimeSDRInputThread::~LimeSDRInputThread()
@@ -83,23 +84,33 @@ void LimeSDRInputThread::run()
     metadata.flushPartialPacket = false; //Do not discard data remainder when read size differs from packet size
     metadata.waitForTimestamp = false;   //Do not wait for specific timestamps
 
+    m_pipeline.startWork();
     m_running = true;
     m_startWaiter.wakeAll();
 
     while (m_running)
     {
-        if ((res = LMS_RecvStream(m_stream, (void *) m_buf, LIMESDR_BLOCKSIZE, &metadata, 1000)) < 0)
+        DeviceSamplePipeline::Buffer *buffer = m_pipeline.acquireBuffer();
+
+        if ((res = LMS_RecvStream(m_stream, buffer->m_channelPointers[0], LIMESDR_BLOCKSIZE, &metadata, 1000)) < 0)
         {
             qCritical("LimeSDRInputThread::run read error: %s", strerror(errno));
+            m_pipeline.submitBuffer(buffer, 0);
             break;
         }
 
-        callback(m_buf, 2 * res);
+        m_pipeline.submitBuffer(buffer, res);
     }
 
+    m_pipeline.stopWork();
     m_running = false;
 }
 
+void LimeSDRInputThread::processBuffer(const DeviceSamplePipeline::Buffer& buffer)
+{
+    callback((const qint16*) buffer.m_channels[0].data(), 2 * buffer.m_nbSamples);
+}
+
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void LimeSDRInputThread::callback(const qint16* buf, qint32 len)
 {
@@ -26,11 +26,17 @@
 
 #include "dsp/samplesinkfifo.h"
 #include "dsp/decimators.h"
+#include "dsp/devicesamplepipeline.h"
 #include "limesdr/devicelimesdrshared.h"
 
 #define LIMESDR_BLOCKSIZE (1<<15) //complex samples per buffer
+#define LIMESDR_NBBUFFERS 8       //number of buffers between stream reader and decimation
 
-class LimeSDRInputThread : public QThread, public DeviceLimeSDRShared::ThreadInterface
+/**
+ * This thread only reads the stream. Decimation and FIFO writes are done in the
+ * worker thread of the sample pipeline.
+ */
+class LimeSDRInputThread : public QThread, public DeviceLimeSDRShared::ThreadInterface, public DeviceSamplePipeline::Processor
 {
     Q_OBJECT
 
@@ -43,6 +49,8 @@ public:
     virtual void setDeviceSampleRate(int sampleRate) { (void) sampleRate; }
     virtual bool isRunning() { return m_running; }
     void setLog2Decimation(unsigned int log2_decim);
+    void getPipelineStats(DeviceSamplePipeline::Stats& stats) { m_pipeline.getStats(stats); }
+    virtual void processBuffer(const DeviceSamplePipeline::Buffer& buffer);
 
 private:
     QMutex m_startWaitMutex;
@@ -50,7 +58,7 @@ private:
     bool m_running;
 
     lms_stream_t* m_stream;
-    qint16 m_buf[2*LIMESDR_BLOCKSIZE]; //must hold I+Q values of each sample hence 2xcomplex size
+    DeviceSamplePipeline m_pipeline;
     SampleVector m_convertBuffer;
     SampleSinkFifo* m_sampleFifo;
 
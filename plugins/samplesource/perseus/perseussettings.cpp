@@ -37,6 +37,7 @@ void PerseusSettings::resetToDefaults()
     m_wideBand = false;
     m_attenuator = Attenuator_None;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -60,6 +61,7 @@ QByteArray PerseusSettings::serialize() const
     s.writeString(11, m_reverseAPIAddress);
     s.writeU32(12, m_reverseAPIPort);
     s.writeU32(13, m_reverseAPIDeviceIndex);
+    s.writeS32(14, m_fileRecordFormat);
 
     return s.final();
 }
@@ -107,6 +109,7 @@ bool PerseusSettings::deserialize(const QByteArray& data)
 
         d.readU32(13, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(14, &m_fileRecordFormat, 0);
 
         return true;
     }
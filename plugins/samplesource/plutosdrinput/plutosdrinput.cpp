@@ -205,7 +205,7 @@ bool PlutoSDRInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -439,6 +439,9 @@ bool PlutoSDRInput::applySettings(const PlutoSDRInputSettings& settings, bool fo
     if ((m_settings.m_fileRecordName != settings.m_fileRecordName) || force) {
         reverseAPIKeys.append("fileRecordName");
     }
+    if ((m_settings.m_fileRecordFormat != settings.m_fileRecordFormat) || force) {
+        reverseAPIKeys.append("fileRecordFormat");
+    }
 
     // determine if buddies threads or own thread need to be suspended
 
@@ -826,6 +829,9 @@ int PlutoSDRInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getPlutoSdrInputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getPlutoSdrInputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getPlutoSdrInputSettings()->getUseReverseApi() != 0;
     }
@@ -889,6 +895,8 @@ void PlutoSDRInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
         response.getPlutoSdrInputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getPlutoSdrInputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getPlutoSdrInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getPlutoSdrInputSettings()->getReverseApiAddress()) {
@@ -979,6 +987,9 @@ void PlutoSDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgPlutoSdrInputSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgPlutoSdrInputSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
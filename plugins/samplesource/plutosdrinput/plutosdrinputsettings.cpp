@@ -46,6 +46,7 @@ void PlutoSDRInputSettings::resetToDefaults()
 	m_transverterMode = false;
 	m_transverterDeltaFrequency = 0;
 	m_fileRecordName = "";
+	m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -76,6 +77,7 @@ QByteArray PlutoSDRInputSettings::serialize() const
     s.writeString(19, m_reverseAPIAddress);
     s.writeU32(20, m_reverseAPIPort);
     s.writeU32(21, m_reverseAPIDeviceIndex);
+    s.writeS32(22, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -143,6 +145,7 @@ bool PlutoSDRInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(21, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(22, &m_fileRecordFormat, 0);
 
 		return true;
 	}
@@ -174,7 +174,7 @@ bool RemoteInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -251,6 +251,9 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
     if ((m_settings.m_fileRecordName != settings.m_fileRecordName) || force) {
         reverseAPIKeys.append("fileRecordName");
     }
+    if ((m_settings.m_fileRecordFormat != settings.m_fileRecordFormat) || force) {
+        reverseAPIKeys.append("fileRecordFormat");
+    }
 
     if ((m_settings.m_dcBlock != settings.m_dcBlock) || (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
     {
@@ -354,6 +357,9 @@ int RemoteInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getRemoteInputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getRemoteInputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getRemoteInputSettings()->getUseReverseApi() != 0;
     }
@@ -395,6 +401,8 @@ void RemoteInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& res
         response.getRemoteInputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getRemoteInputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     response.getRemoteInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getRemoteInputSettings()->getReverseApiAddress()) {
@@ -429,6 +437,11 @@ void RemoteInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& respons
 
     response.getRemoteInputReport()->setMinNbBlocks(m_remoteInputUDPHandler->getMinNbBlocks());
     response.getRemoteInputReport()->setMaxNbRecovery(m_remoteInputUDPHandler->getMaxNbRecovery());
+    response.getRemoteInputReport()->setNbPacketsReceived(m_remoteInputUDPHandler->getNbPacketsReceived());
+    response.getRemoteInputReport()->setNbPacketsDropped(m_remoteInputUDPHandler->getNbPacketsDropped());
+    response.getRemoteInputReport()->setNbPacketsTruncated(m_remoteInputUDPHandler->getNbPacketsTruncated());
+    response.getRemoteInputReport()->setNbFramesRecovered(m_remoteInputUDPHandler->getNbFramesRecovered());
+    response.getRemoteInputReport()->setNbFramesLost(m_remoteInputUDPHandler->getNbFramesLost());
 }
 
 void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const RemoteInputSettings& settings, bool force)
@@ -463,6 +476,9 @@ void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgRemoteInputSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgRemoteInputSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
@@ -145,6 +145,9 @@ public:
         int getNbFECBlocksPerFrame() const { return m_nbFECBlocksPerFrame; }
         int getSampleBits() const { return m_sampleBits; }
         int getSampleBytes() const { return m_sampleBytes; }
+        float getPacketsPerSecond() const { return m_packetsPerSecond; }
+        uint32_t getNbFramesRecovered() const { return m_nbFramesRecovered; }
+        uint32_t getNbFramesLost() const { return m_nbFramesLost; }
 
 		static MsgReportRemoteInputStreamTiming* create(uint64_t tv_msec,
 				float bufferLenSec,
@@ -160,7 +163,10 @@ public:
                 int nbOriginalBlocksPerFrame,
                 int nbFECBlocksPerFrame,
                 int sampleBits,
-                int sampleBytes)
+                int sampleBytes,
+                float packetsPerSecond,
+                uint32_t nbFramesRecovered,
+                uint32_t nbFramesLost)
 		{
 			return new MsgReportRemoteInputStreamTiming(tv_msec,
 					bufferLenSec,
@@ -176,7 +182,10 @@ public:
                     nbOriginalBlocksPerFrame,
                     nbFECBlocksPerFrame,
                     sampleBits,
-                    sampleBytes);
+                    sampleBytes,
+                    packetsPerSecond,
+                    nbFramesRecovered,
+                    nbFramesLost);
 		}
 
 	protected:
@@ -195,6 +204,9 @@ public:
         int      m_nbFECBlocksPerFrame;
         int      m_sampleBits;
         int      m_sampleBytes;
+        float    m_packetsPerSecond;   //!< datagrams received per second
+        uint32_t m_nbFramesRecovered;  //!< frames restored by FEC since start
+        uint32_t m_nbFramesLost;       //!< frames missing or not decodable since start
 
 		MsgReportRemoteInputStreamTiming(uint64_t tv_msec,
 				float bufferLenSec,
@@ -210,7 +222,10 @@ public:
                 int nbOriginalBlocksPerFrame,
                 int nbFECBlocksPerFrame,
                 int sampleBits,
-                int sampleBytes) :
+                int sampleBytes,
+                float packetsPerSecond,
+                uint32_t nbFramesRecovered,
+                uint32_t nbFramesLost) :
 			Message(),
 			m_tv_msec(tv_msec),
 			m_framesDecodingStatus(framesDecodingStatus),
@@ -226,7 +241,10 @@ public:
             m_nbOriginalBlocksPerFrame(nbOriginalBlocksPerFrame),
             m_nbFECBlocksPerFrame(nbFECBlocksPerFrame),
             m_sampleBits(sampleBits),
-            m_sampleBytes(sampleBytes)
+            m_sampleBytes(sampleBytes),
+            m_packetsPerSecond(packetsPerSecond),
+            m_nbFramesRecovered(nbFramesRecovered),
+            m_nbFramesLost(nbFramesLost)
 		{ }
 	};
 
@@ -43,14 +43,19 @@ SOURCES += remoteinputbuffer.cpp\
     remoteinput.cpp\
     remoteinputsettings.cpp\
     remoteinputplugin.cpp\
-    remoteinputudphandler.cpp
+    remoteinputudphandler.cpp\
+    remoteinputudpreceiver.cpp\
+    remoteinputfecdecoder.cpp
 
 HEADERS += remoteinputbuffer.h\
     remoteinputgui.h\
     remoteinput.h\
     remoteinputsettings.h\
     remoteinputplugin.h\
-    remoteinputudphandler.h
+    remoteinputudphandler.h\
+    remoteinputudpreceiver.h\
+    remoteinputfecdecoder.h\
+    remoteinputframepool.h
 
 FORMS += remoteinputgui.ui
 
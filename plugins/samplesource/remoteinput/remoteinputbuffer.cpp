@@ -36,6 +36,8 @@ RemoteInputBuffer::RemoteInputBuffer() :
         m_curNbRecovery(0),
         m_maxNbRecovery(0),
         m_framesDecoded(true),
+        m_nbFramesRecovered(0),
+        m_nbFramesLost(0),
         m_readIndex(0),
         m_readBuffer(0),
         m_readSize(0),
@@ -182,6 +184,10 @@ void RemoteInputBuffer::checkSlotData(int slotIndex)
 
     if (!m_decoderSlots[slotIndex].m_decoded)
     {
+        if (m_decoderSlots[slotIndex].m_blockCount > 0) {
+            m_nbFramesLost++;
+        }
+
         qDebug() << "RemoteInputBuffer::checkSlotData: incomplete frame:"
                 << " slotIndex: " << slotIndex
                 << " m_blockCount: " << m_decoderSlots[slotIndex].m_blockCount
@@ -206,6 +212,12 @@ void RemoteInputBuffer::writeData(char *array)
     }
     else if (m_frameHead != frameIndex) // frame break => new frame starts
     {
+        uint16_t frameDelta = frameIndex - m_frameHead;
+
+        if ((frameDelta > 1) && (frameDelta <= nbDecoderSlots)) { // whole frames skipped. Larger jumps are stream restarts.
+            m_nbFramesLost += frameDelta - 1;
+        }
+
         m_decoderIndexHead = decoderIndex; // new decoder slot head
         m_frameHead = frameIndex;          // new frame head
         checkSlotData(decoderIndex);       // check slot before re-init
@@ -259,6 +271,7 @@ void RemoteInputBuffer::writeData(char *array)
 
             if (m_cm256.cm256_decode(m_paramsCM256, m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks)) // CM256 decode
             {
+                m_nbFramesLost++;
                 qDebug() << "RemoteInputBuffer::writeData: decode CM256 error:"
                         << " decoderIndex: " << decoderIndex
                         << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
@@ -267,6 +280,7 @@ void RemoteInputBuffer::writeData(char *array)
             }
             else
             {
+                m_nbFramesRecovered++;
                 qDebug() << "RemoteInputBuffer::writeData: decode CM256 success:"
                         << " decoderIndex: " << decoderIndex
                         << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
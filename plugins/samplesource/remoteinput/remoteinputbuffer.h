@@ -26,7 +26,6 @@
 #include "util/movingaverage.h"
 
 
-#define REMOTEINPUT_UDPSIZE 512               // UDP payload size
 #define REMOTEINPUT_NBORIGINALBLOCKS 128      // number of sample blocks per frame excluding FEC blocks
 #define REMOTEINPUT_NBDECODERSLOTS 16         // power of two sub multiple of uint16_t size. A too large one is superfluous.
 
@@ -85,6 +84,15 @@ public:
         return framesDecoded;
     }
 
+    uint32_t getNbFramesRecovered() const { return m_nbFramesRecovered; } //!< frames restored by FEC since last counters reset
+    uint32_t getNbFramesLost() const { return m_nbFramesLost; }           //!< frames missing or not decodable since last counters reset
+
+    void resetFramesCounters()
+    {
+        m_nbFramesRecovered = 0;
+        m_nbFramesLost = 0;
+    }
+
     float getBufferLengthInSecs() const { return m_bufferLenSec; }
     int32_t getRWBalanceCorrection() const { return m_balCorrection; }
 
@@ -148,6 +156,8 @@ private:
     MovingAverageUtil<int, int, 10> m_avgOrigBlocks; //!< (stats) average number of original blocks received
     MovingAverageUtil<int, int, 10> m_avgNbRecovery; //!< (stats) average number of recovery blocks used
     bool                 m_framesDecoded;        //!< [stats] true if all frames were decoded since last poll
+    uint32_t             m_nbFramesRecovered;    //!< [stats] number of frames restored by FEC
+    uint32_t             m_nbFramesLost;         //!< [stats] number of frames missing or not decodable
     int                  m_readIndex;            //!< current byte read index in frames buffer
     int                  m_wrDeltaEstimate;      //!< Sampled estimate of write to read indexes difference
     uint32_t             m_tvOut_sec;            //!< Estimated returned samples timestamp (seconds)
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QMutex>
+#include <QDebug>
+
+#include "remoteinputframepool.h"
+#include "remoteinputbuffer.h"
+#include "remoteinputfecdecoder.h"
+
+RemoteInputFECDecoder::RemoteInputFECDecoder(
+        RemoteInputFramePool& framePool,
+        RemoteInputBuffer& remoteInputBuffer,
+        QMutex& remoteInputBufferMutex,
+        QObject* parent) :
+    QThread(parent),
+    m_framePool(framePool),
+    m_remoteInputBuffer(remoteInputBuffer),
+    m_remoteInputBufferMutex(remoteInputBufferMutex),
+    m_running(false),
+    m_sampleRate(0),
+    m_centerFrequency(0)
+{
+}
+
+RemoteInputFECDecoder::~RemoteInputFECDecoder()
+{
+    stopWork();
+}
+
+void RemoteInputFECDecoder::startWork()
+{
+    if (m_running) {
+        return;
+    }
+
+    m_sampleRate = 0;
+    m_centerFrequency = 0;
+    m_running = true;
+    start();
+}
+
+void RemoteInputFECDecoder::stopWork()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    m_framePool.wakeUp();
+    wait();
+}
+
+void RemoteInputFECDecoder::run()
+{
+    while (m_running)
+    {
+        if (!m_framePool.waitForData(100)) {
+            continue;
+        }
+
+        int count;
+        RemoteSuperBlock *blocks = m_framePool.readBegin(count);
+        count = std::min(count, m_maxBlocksPerLock);
+        unsigned int sampleRate, centerFrequency;
+
+        {
+            QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+
+            for (int i = 0; i < count; i++) {
+                m_remoteInputBuffer.writeData((char *) &blocks[i]);
+            }
+
+            sampleRate = m_remoteInputBuffer.getCurrentMeta().m_sampleRate;
+            centerFrequency = m_remoteInputBuffer.getCurrentMeta().m_centerFrequency;
+        }
+
+        m_framePool.readCommit(count);
+
+        if ((sampleRate != m_sampleRate) || (centerFrequency != m_centerFrequency))
+        {
+            m_sampleRate = sampleRate;
+            m_centerFrequency = centerFrequency;
+            emit streamMetaChanged(sampleRate, centerFrequency);
+        }
+    }
+}
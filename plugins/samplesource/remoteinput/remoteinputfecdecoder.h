@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFECDECODER_H_
+#define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFECDECODER_H_
+
+#include <atomic>
+
+#include <QThread>
+
+#include "channel/remotedatablock.h"
+
+class QMutex;
+class RemoteInputFramePool;
+class RemoteInputBuffer;
+
+/**
+ * FEC decode stage of the Remote input. Takes the blocks received into the frame pool,
+ * reassembles frames and runs the CM256 decoder in the Remote input buffer. Runs in its
+ * own thread so that a costly FEC decode never holds back the socket reads.
+ */
+class RemoteInputFECDecoder : public QThread
+{
+    Q_OBJECT
+public:
+    RemoteInputFECDecoder(
+        RemoteInputFramePool& framePool,
+        RemoteInputBuffer& remoteInputBuffer,
+        QMutex& remoteInputBufferMutex,
+        QObject* parent = nullptr);
+    ~RemoteInputFECDecoder();
+
+    void startWork();
+    void stopWork();
+
+signals:
+    void streamMetaChanged(unsigned int sampleRate, unsigned int centerFrequency); //!< center frequency in kHz as in stream meta data
+
+private:
+    static const int m_maxBlocksPerLock = 2 * RemoteNbOrginalBlocks; //!< bound the time the buffer is locked against the DSP side reads
+
+    RemoteInputFramePool& m_framePool;
+    RemoteInputBuffer& m_remoteInputBuffer;
+    QMutex& m_remoteInputBufferMutex;
+    std::atomic<bool> m_running;
+    unsigned int m_sampleRate;
+    unsigned int m_centerFrequency;
+
+    void run();
+};
+
+#endif /* PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFECDECODER_H_ */
@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFRAMEPOOL_H_
+#define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFRAMEPOOL_H_
+
+#include <atomic>
+#include <algorithm>
+
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "channel/remotedatablock.h"
+
+/**
+ * Preallocated pool of UDP super blocks shared by the receive thread (producer) and the
+ * FEC decoder thread (consumer). It is a single producer single consumer ring: the producer
+ * gets a contiguous span of free blocks to receive datagrams into and the consumer gets a
+ * contiguous span of received blocks to decode. Datagrams are therefore received in place
+ * and never copied before they reach the decoder.
+ */
+class RemoteInputFramePool
+{
+public:
+    static const int m_nbBlocks = 8 * 2 * RemoteNbOrginalBlocks; //!< room for 8 frames with the maximum number of FEC blocks
+
+    RemoteInputFramePool() :
+        m_blocks(new RemoteSuperBlock[m_nbBlocks]),
+        m_head(0),
+        m_tail(0)
+    {}
+
+    ~RemoteInputFramePool() {
+        delete[] m_blocks;
+    }
+
+    /** Producer: get the first free block and the number of contiguous free blocks after it (up to maxCount) */
+    RemoteSuperBlock *writeBegin(int maxCount, int& count)
+    {
+        unsigned int head = m_head.load(std::memory_order_relaxed);
+        unsigned int tail = m_tail.load(std::memory_order_acquire);
+        unsigned int index = head % m_nbBlocks;
+        int nbFree = m_nbBlocks - (int) (head - tail);
+        count = std::min(std::min(nbFree, m_nbBlocks - (int) index), maxCount);
+        return &m_blocks[index];
+    }
+
+    /** Producer: publish count blocks filled after a writeBegin and wake up the consumer */
+    void writeCommit(int count)
+    {
+        if (count <= 0) {
+            return;
+        }
+
+        m_head.store(m_head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        QMutexLocker mutexLocker(&m_mutex);
+        m_dataReady.wakeOne();
+    }
+
+    /** Consumer: get the first received block and the number of contiguous received blocks after it */
+    RemoteSuperBlock *readBegin(int& count)
+    {
+        unsigned int tail = m_tail.load(std::memory_order_relaxed);
+        unsigned int head = m_head.load(std::memory_order_acquire);
+        unsigned int index = tail % m_nbBlocks;
+        count = std::min((int) (head - tail), m_nbBlocks - (int) index);
+        return &m_blocks[index];
+    }
+
+    /** Consumer: release count blocks after a readBegin */
+    void readCommit(int count) {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /** Consumer: wait at most timeoutMs for received blocks. Returns true if some are available */
+    bool waitForData(unsigned long timeoutMs)
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (m_head.load(std::memory_order_acquire) != m_tail.load(std::memory_order_relaxed)) {
+            return true;
+        }
+
+        m_dataReady.wait(&m_mutex, timeoutMs);
+        return m_head.load(std::memory_order_acquire) != m_tail.load(std::memory_order_relaxed);
+    }
+
+    /** Wake up a consumer waiting for data (used on stop) */
+    void wakeUp()
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_dataReady.wakeAll();
+    }
+
+    /** Drop all blocks. Only when both producer and consumer are stopped */
+    void reset()
+    {
+        m_head.store(0);
+        m_tail.store(0);
+    }
+
+private:
+    RemoteSuperBlock *m_blocks;
+    std::atomic<unsigned int> m_head; //!< total number of blocks written (producer)
+    std::atomic<unsigned int> m_tail; //!< total number of blocks read (consumer)
+    QMutex m_mutex;                   //!< only used to park the consumer when the pool is empty
+    QWaitCondition m_dataReady;
+};
+
+#endif /* PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTFRAMEPOOL_H_ */
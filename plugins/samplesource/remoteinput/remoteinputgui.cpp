@@ -61,6 +61,9 @@ RemoteInputGui::RemoteInputGui(DeviceUISet *deviceUISet, QWidget* parent) :
     m_nbFECBlocks(0),
     m_sampleBits(16), // assume 16 bits to start with
     m_sampleBytes(2),
+    m_packetsPerSecond(0.0f),
+    m_nbFramesRecovered(0),
+    m_nbFramesLost(0),
     m_samplesCount(0),
     m_tickCount(0),
     m_addressEdited(false),
@@ -216,6 +219,9 @@ bool RemoteInputGui::handleMessage(const Message& message)
         m_nbOriginalBlocks = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbOriginalBlocksPerFrame();
         m_sampleBits = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getSampleBits();
         m_sampleBytes = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getSampleBytes();
+        m_packetsPerSecond = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getPacketsPerSecond();
+        m_nbFramesRecovered = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbFramesRecovered();
+        m_nbFramesLost = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbFramesLost();
 
         int nbFECBlocks = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbFECBlocksPerFrame();
 
@@ -487,6 +493,12 @@ void RemoteInputGui::updateWithStreamTime()
         ui->allFramesDecoded->setStyleSheet("QToolButton { background-color : red; }");
 	}
 
+    ui->allFramesDecoded->setToolTip(tr("Frames status: green = all original received, none = some recovered by FEC, red = some lost\n"
+        "%1 packets/s - frames recovered: %2 - frames lost: %3")
+        .arg(QString::number(m_packetsPerSecond, 'f', 0))
+        .arg(m_nbFramesRecovered)
+        .arg(m_nbFramesLost));
+
 	QString s = QString::number(m_bufferLengthInSecs, 'f', 1);
 	ui->bufferLenSecsText->setText(tr("%1").arg(s));
 
@@ -645,6 +657,7 @@ void RemoteInputGui::openDeviceSettingsDialog(const QPoint& p)
     dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
     dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
     dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+    dialog.setFileRecordFormat(m_settings.m_fileRecordFormat);
 
     dialog.move(p);
     dialog.exec();
@@ -653,6 +666,7 @@ void RemoteInputGui::openDeviceSettingsDialog(const QPoint& p)
     m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
     m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
     m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+    m_settings.m_fileRecordFormat = dialog.getFileRecordFormat();
 
     sendSettings();
 }
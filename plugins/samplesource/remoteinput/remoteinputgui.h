@@ -86,6 +86,9 @@ private:
     int m_nbFECBlocks;
     int m_sampleBits;
     int m_sampleBytes;
+    float m_packetsPerSecond;
+    uint32_t m_nbFramesRecovered;
+    uint32_t m_nbFramesLost;
 
 	int m_samplesCount;
 	std::size_t m_tickCount;
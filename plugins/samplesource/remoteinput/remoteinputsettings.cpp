@@ -32,6 +32,7 @@ void RemoteInputSettings::resetToDefaults()
     m_dcBlock = false;
     m_iqCorrection = false;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -52,6 +53,7 @@ QByteArray RemoteInputSettings::serialize() const
     s.writeString(12, m_reverseAPIAddress);
     s.writeU32(13, m_reverseAPIPort);
     s.writeU32(14, m_reverseAPIDeviceIndex);
+    s.writeS32(15, m_fileRecordFormat);
 
     return s.final();
 }
@@ -90,6 +92,7 @@ bool RemoteInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(14, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(15, &m_fileRecordFormat, 0);
         return true;
     }
     else
@@ -15,7 +15,6 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <QUdpSocket>
 #include <QDebug>
 #include <QTimer>
 
@@ -24,6 +23,8 @@
 #include <device/devicesourceapi.h>
 
 #include "remoteinputudphandler.h"
+#include "remoteinputudpreceiver.h"
+#include "remoteinputfecdecoder.h"
 #include "remoteinput.h"
 
 RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceSourceAPI *deviceAPI) :
@@ -32,13 +33,11 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceS
     m_masterTimerConnected(false),
     m_running(false),
     m_rateDivider(1000/REMOTEINPUT_THROTTLE_MS),
-	m_dataSocket(0),
+	m_udpReceiver(0),
+	m_fecDecoder(0),
 	m_dataAddress(QHostAddress::LocalHost),
-	m_remoteAddress(QHostAddress::LocalHost),
 	m_dataPort(9090),
 	m_dataConnected(false),
-	m_udpBuf(0),
-	m_udpReadBytes(0),
 	m_sampleFifo(sampleFifo),
 	m_samplerate(0),
 	m_centerFrequency(0),
@@ -53,9 +52,14 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceS
     m_converterBuffer(0),
     m_converterBufferNbSamples(0),
     m_throttleToggle(false),
-	m_autoCorrBuffer(true)
+	m_autoCorrBuffer(true),
+	m_nbPacketsLastReport(0),
+	m_nbDroppedLastReport(0),
+	m_packetsPerSecond(0.0f)
 {
-    m_udpBuf = new char[RemoteUdpSize];
+    m_udpReceiver = new RemoteInputUDPReceiver(m_framePool);
+    m_fecDecoder = new RemoteInputFECDecoder(m_framePool, m_remoteInputBuffer, m_remoteInputBufferMutex);
+    connect(m_fecDecoder, SIGNAL(streamMetaChanged(unsigned int, unsigned int)), this, SLOT(streamMetaChanged(unsigned int, unsigned int)), Qt::QueuedConnection);
 
 #ifdef USE_INTERNAL_TIMER
 #warning "Uses internal timer"
@@ -71,7 +75,8 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceS
 RemoteInputUDPHandler::~RemoteInputUDPHandler()
 {
 	stop();
-	delete[] m_udpBuf;
+	delete m_fecDecoder;
+	delete m_udpReceiver;
 	if (m_converterBuffer) { delete[] m_converterBuffer; }
 #ifdef USE_INTERNAL_TIMER
     if (m_timer) {
@@ -88,28 +93,30 @@ void RemoteInputUDPHandler::start()
 	    return;
 	}
 
-	if (!m_dataSocket)
-	{
-		m_dataSocket = new QUdpSocket(this);
-	}
-
     if (!m_dataConnected)
 	{
-        connect(m_dataSocket, SIGNAL(readyRead()), this, SLOT(dataReadyRead())); //, Qt::QueuedConnection);
+        m_framePool.reset();
 
-        if (m_dataSocket->bind(m_dataAddress, m_dataPort))
+        if (m_udpReceiver->startWork(m_dataAddress, m_dataPort))
 		{
 			qDebug("RemoteInputUDPHandler::start: bind data socket to %s:%d", m_dataAddress.toString().toStdString().c_str(),  m_dataPort);
+			m_fecDecoder->startWork();
 			m_dataConnected = true;
 		}
 		else
 		{
 			qWarning("RemoteInputUDPHandler::start: cannot bind data port %d", m_dataPort);
-	        disconnect(m_dataSocket, SIGNAL(readyRead()), this, SLOT(dataReadyRead()));
 			m_dataConnected = false;
 		}
 	}
 
+    m_remoteInputBufferMutex.lock();
+    m_remoteInputBuffer.resetFramesCounters();
+    m_remoteInputBufferMutex.unlock();
+    m_nbPacketsLastReport = 0;
+    m_nbDroppedLastReport = 0;
+    m_packetsPerSecond = 0.0f;
+    m_reportTimer.start();
     m_elapsedTimer.start();
     m_running = true;
 }
@@ -127,13 +134,8 @@ void RemoteInputUDPHandler::stop()
     if (m_dataConnected)
     {
 		m_dataConnected = false;
-	    disconnect(m_dataSocket, SIGNAL(readyRead()), this, SLOT(dataReadyRead()));
-	}
-
-	if (m_dataSocket)
-	{
-		delete m_dataSocket;
-		m_dataSocket = 0;
+		m_udpReceiver->stopWork(); // producer first so that the decoder can drain what is left
+		m_fecDecoder->stopWork();
 	}
 
 	m_centerFrequency = 0;
@@ -157,45 +159,79 @@ void RemoteInputUDPHandler::configureUDPLink(const QString& address, quint16 por
 	start();
 }
 
-void RemoteInputUDPHandler::dataReadyRead()
+void RemoteInputUDPHandler::getRemoteAddress(QString& s) const
 {
-    m_udpReadBytes = 0;
+    s = m_udpReceiver->getRemoteAddress().toString();
+}
 
-	while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
-	{
-		qint64 pendingDataSize = m_dataSocket->pendingDatagramSize();
-		m_udpReadBytes += m_dataSocket->readDatagram(&m_udpBuf[m_udpReadBytes], pendingDataSize, &m_remoteAddress, 0);
+int RemoteInputUDPHandler::getBufferGauge() const
+{
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    return m_remoteInputBuffer.getBufferGauge();
+}
 
-		if (m_udpReadBytes == RemoteUdpSize) {
-		    processData();
-		    m_udpReadBytes = 0;
-		}
-	}
+int RemoteInputUDPHandler::getMinNbBlocks()
+{
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    return m_remoteInputBuffer.getMinNbBlocks();
 }
 
-void RemoteInputUDPHandler::processData()
+int RemoteInputUDPHandler::getMaxNbRecovery()
 {
-    m_remoteInputBuffer.writeData(m_udpBuf);
-    const RemoteMetaDataFEC& metaData =  m_remoteInputBuffer.getCurrentMeta();
-    bool change = false;
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    return m_remoteInputBuffer.getMaxNbRecovery();
+}
 
-    m_tv_msec = m_remoteInputBuffer.getTVOutMSec();
+uint32_t RemoteInputUDPHandler::getNbFramesRecovered() const
+{
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    return m_remoteInputBuffer.getNbFramesRecovered();
+}
+
+uint32_t RemoteInputUDPHandler::getNbFramesLost() const
+{
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    return m_remoteInputBuffer.getNbFramesLost();
+}
 
-    if (m_centerFrequency != metaData.m_centerFrequency)
+uint64_t RemoteInputUDPHandler::getNbPacketsReceived() const
+{
+    return m_udpReceiver->getNbPackets();
+}
+
+uint64_t RemoteInputUDPHandler::getNbPacketsDropped() const
+{
+    return m_udpReceiver->getNbDropped();
+}
+
+uint64_t RemoteInputUDPHandler::getNbPacketsTruncated() const
+{
+    return m_udpReceiver->getNbTruncated();
+}
+
+void RemoteInputUDPHandler::streamMetaChanged(unsigned int sampleRate, unsigned int centerFrequency)
+{
+    bool change = false;
+
+    if (m_centerFrequency != centerFrequency)
     {
-        m_centerFrequency = metaData.m_centerFrequency;
+        m_centerFrequency = centerFrequency;
         change = true;
     }
 
-    if (m_samplerate != metaData.m_sampleRate)
+    if (m_samplerate != sampleRate)
     {
-        m_samplerate = metaData.m_sampleRate;
+        m_samplerate = sampleRate;
         change = true;
     }
 
     if (change && (m_samplerate != 0))
     {
-        qDebug("RemoteInputUDPHandler::processData: m_samplerate: %u m_centerFrequency: %u kHz", m_samplerate, m_centerFrequency);
+        qDebug("RemoteInputUDPHandler::streamMetaChanged: m_samplerate: %u m_centerFrequency: %u kHz", m_samplerate, m_centerFrequency);
+
+        m_remoteInputBufferMutex.lock();
+        m_tv_msec = m_remoteInputBuffer.getTVOutMSec();
+        m_remoteInputBufferMutex.unlock();
 
         DSPSignalNotification *notif = new DSPSignalNotification(m_samplerate, m_centerFrequency * 1000); // Frequency in Hz for the DSP engine
         m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
@@ -246,6 +282,9 @@ void RemoteInputUDPHandler::disconnectTimer()
 
 void RemoteInputUDPHandler::tick()
 {
+    QMutexLocker mutexLocker(&m_remoteInputBufferMutex);
+    m_tv_msec = m_remoteInputBuffer.getTVOutMSec();
+
     // auto throttling
     int throttlems = m_elapsedTimer.restart();
 
@@ -260,7 +299,7 @@ void RemoteInputUDPHandler::tick()
         m_readLengthSamples += m_remoteInputBuffer.getRWBalanceCorrection();
     }
 
-    const RemoteMetaDataFEC& metaData =  m_remoteInputBuffer.getCurrentMeta();
+    const RemoteMetaDataFEC metaData =  m_remoteInputBuffer.getCurrentMeta();
     m_readLength = m_readLengthSamples * (metaData.m_sampleBytes & 0xF) * 2;
 
     if ((metaData.m_sampleBits == 16) && (SDR_RX_SAMP_SZ == 24)) // 16 -> 24 bits
@@ -321,6 +360,21 @@ void RemoteInputUDPHandler::tick()
 	{
 		m_tickCount = 0;
 
+        uint64_t nbPackets = m_udpReceiver->getNbPackets();
+        uint64_t nbDropped = m_udpReceiver->getNbDropped();
+        qint64 reportElapsedms = m_reportTimer.restart();
+
+        if (reportElapsedms > 0) {
+            m_packetsPerSecond = ((nbPackets - m_nbPacketsLastReport) * 1000.0f) / reportElapsedms;
+        }
+
+        if (nbDropped != m_nbDroppedLastReport) {
+            qWarning("RemoteInputUDPHandler::tick: %llu datagrams dropped as FEC decoding lags", (unsigned long long) (nbDropped - m_nbDroppedLastReport));
+        }
+
+        m_nbPacketsLastReport = nbPackets;
+        m_nbDroppedLastReport = nbDropped;
+
 		if (m_outputMessageQueueToGUI)
 		{
 	        int framesDecodingStatus;
@@ -355,7 +409,10 @@ void RemoteInputUDPHandler::tick()
 	            nbOriginalBlocks,
 	            nbFECblocks,
 	            sampleBits,
-	            sampleBytes);
+	            sampleBytes,
+	            m_packetsPerSecond,
+	            m_remoteInputBuffer.getNbFramesRecovered(),
+	            m_remoteInputBuffer.getNbFramesLost());
 
 	            m_outputMessageQueueToGUI->push(report);
 		}
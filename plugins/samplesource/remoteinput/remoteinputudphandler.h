@@ -19,12 +19,12 @@
 #define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPHANDLER_H_
 
 #include <QObject>
-#include <QUdpSocket>
 #include <QHostAddress>
 #include <QMutex>
 #include <QElapsedTimer>
 
 #include "remoteinputbuffer.h"
+#include "remoteinputframepool.h"
 
 #define REMOTEINPUT_THROTTLE_MS 50
 
@@ -32,6 +32,8 @@ class SampleSinkFifo;
 class MessageQueue;
 class QTimer;
 class DeviceSourceAPI;
+class RemoteInputUDPReceiver;
+class RemoteInputFECDecoder;
 
 class RemoteInputUDPHandler : public QObject
 {
@@ -43,17 +45,21 @@ public:
 	void start();
 	void stop();
 	void configureUDPLink(const QString& address, quint16 port);
-	void getRemoteAddress(QString& s) const { s = m_remoteAddress.toString(); }
+	void getRemoteAddress(QString& s) const;
     int getNbOriginalBlocks() const { return RemoteNbOrginalBlocks; }
     bool isStreaming() const { return m_masterTimerConnected; }
     int getSampleRate() const { return m_samplerate; }
     int getCenterFrequency() const { return m_centerFrequency * 1000; }
-    int getBufferGauge() const { return m_remoteInputBuffer.getBufferGauge(); }
+    int getBufferGauge() const;
     uint64_t getTVmSec() const { return m_tv_msec; }
-    int getMinNbBlocks() { return m_remoteInputBuffer.getMinNbBlocks(); }
-    int getMaxNbRecovery() { return m_remoteInputBuffer.getMaxNbRecovery(); }
-public slots:
-	void dataReadyRead();
+    int getMinNbBlocks();
+    int getMaxNbRecovery();
+    float getPacketsPerSecond() const { return m_packetsPerSecond; }
+    uint32_t getNbFramesRecovered() const;
+    uint32_t getNbFramesLost() const;
+    uint64_t getNbPacketsReceived() const;  //!< valid datagrams received since start
+    uint64_t getNbPacketsDropped() const;   //!< datagrams dropped because FEC decoding lagged
+    uint64_t getNbPacketsTruncated() const; //!< datagrams dropped because they were not of the block size
 
 private:
 	DeviceSourceAPI *m_deviceAPI;
@@ -62,13 +68,13 @@ private:
 	bool m_running;
     uint32_t m_rateDivider;
 	RemoteInputBuffer m_remoteInputBuffer;
-	QUdpSocket *m_dataSocket;
+	mutable QMutex m_remoteInputBufferMutex; //!< buffer is written by the FEC decoder thread and read on timer ticks
+	RemoteInputFramePool m_framePool;        //!< received datagrams waiting for FEC decoding
+	RemoteInputUDPReceiver *m_udpReceiver;
+	RemoteInputFECDecoder *m_fecDecoder;
 	QHostAddress m_dataAddress;
-	QHostAddress m_remoteAddress;
 	quint16 m_dataPort;
 	bool m_dataConnected;
-	char *m_udpBuf;
-	qint64 m_udpReadBytes;
 	SampleSinkFifo *m_sampleFifo;
 	uint32_t m_samplerate;
 	uint32_t m_centerFrequency;
@@ -86,12 +92,16 @@ private:
     uint32_t m_converterBufferNbSamples;
     bool m_throttleToggle;
     bool m_autoCorrBuffer;
+    uint64_t m_nbPacketsLastReport;
+    uint64_t m_nbDroppedLastReport;
+    float m_packetsPerSecond;
+    QElapsedTimer m_reportTimer;
 
 	void connectTimer();
     void disconnectTimer();
-	void processData();
 
 private slots:
+	void streamMetaChanged(unsigned int sampleRate, unsigned int centerFrequency);
 	void tick();
 };
 
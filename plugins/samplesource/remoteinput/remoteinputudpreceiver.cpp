@@ -0,0 +1,306 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QUdpSocket>
+#include <QDebug>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <netinet/in.h>
+#endif
+
+#include "remoteinputframepool.h"
+#include "remoteinputudpreceiver.h"
+
+RemoteInputUDPReceiver::RemoteInputUDPReceiver(RemoteInputFramePool& framePool, QObject* parent) :
+    QThread(parent),
+    m_framePool(framePool),
+    m_running(false),
+    m_nbPackets(0),
+    m_nbDropped(0),
+    m_nbTruncated(0),
+    m_scratchBlocks(new RemoteSuperBlock[m_batchSize]),
+#ifdef REMOTEINPUT_RECVMMSG
+    m_socket(-1),
+#endif
+    m_udpSocket(nullptr)
+{
+#ifdef REMOTEINPUT_RECVMMSG
+    memset(m_mmsgHeaders, 0, sizeof(m_mmsgHeaders));
+#endif
+}
+
+RemoteInputUDPReceiver::~RemoteInputUDPReceiver()
+{
+    stopWork();
+    delete[] m_scratchBlocks;
+}
+
+bool RemoteInputUDPReceiver::startWork(const QHostAddress& address, quint16 port)
+{
+    if (m_running) {
+        return true;
+    }
+
+    m_nbPackets = 0;
+    m_nbDropped = 0;
+    m_nbTruncated = 0;
+
+#ifdef REMOTEINPUT_RECVMMSG
+    if (!openSocket(address, port)) {
+        return false;
+    }
+#else
+    m_udpSocket = new QUdpSocket();
+
+    if (!m_udpSocket->bind(address, port))
+    {
+        delete m_udpSocket;
+        m_udpSocket = nullptr;
+        return false;
+    }
+
+    m_udpSocket->moveToThread(this);
+#endif
+
+    qDebug("RemoteInputUDPReceiver::startWork: bound to %s:%d", qPrintable(address.toString()), port);
+    m_running = true;
+    start(QThread::HighPriority);
+    return true;
+}
+
+void RemoteInputUDPReceiver::stopWork()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    wait(); // returns at the latest after the socket read timeout
+
+#ifdef REMOTEINPUT_RECVMMSG
+    closeSocket();
+#endif
+    if (m_udpSocket)
+    {
+        delete m_udpSocket;
+        m_udpSocket = nullptr;
+    }
+
+    qDebug("RemoteInputUDPReceiver::stopWork: received %llu datagrams, dropped %llu, wrong size %llu",
+        (unsigned long long) getNbPackets(), (unsigned long long) getNbDropped(), (unsigned long long) getNbTruncated());
+}
+
+QHostAddress RemoteInputUDPReceiver::getRemoteAddress() const
+{
+    QMutexLocker mutexLocker(&m_remoteAddressMutex);
+    return m_remoteAddress;
+}
+
+void RemoteInputUDPReceiver::run()
+{
+    while (m_running)
+    {
+        int count;
+        RemoteSuperBlock *blocks = m_framePool.writeBegin(m_batchSize, count);
+
+        if (count == 0) // pool full: the decoder is lagging. Keep draining the socket so that the kernel buffer does not overflow.
+        {
+            int nbDropped = receiveBlocks(m_scratchBlocks, m_batchSize);
+
+            if (nbDropped > 0) {
+                m_nbDropped.fetch_add(nbDropped, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            int nbReceived = receiveBlocks(blocks, count);
+
+            if (nbReceived > 0)
+            {
+                m_nbPackets.fetch_add(nbReceived, std::memory_order_relaxed);
+                m_framePool.writeCommit(nbReceived);
+            }
+        }
+    }
+}
+
+int RemoteInputUDPReceiver::receiveBlocks(RemoteSuperBlock *blocks, int maxCount)
+{
+#ifdef REMOTEINPUT_RECVMMSG
+    return receiveMmsg(blocks, maxCount);
+#else
+    return receiveDatagrams(blocks, maxCount);
+#endif
+}
+
+int RemoteInputUDPReceiver::receiveDatagrams(RemoteSuperBlock *blocks, int maxCount)
+{
+    if (!m_udpSocket->hasPendingDatagrams() && !m_udpSocket->waitForReadyRead(m_readTimeoutMs)) {
+        return 0;
+    }
+
+    QHostAddress remoteAddress;
+    int nbBlocks = 0;
+
+    while ((nbBlocks < maxCount) && m_udpSocket->hasPendingDatagrams())
+    {
+        qint64 datagramSize = m_udpSocket->pendingDatagramSize(); // a larger datagram is truncated by the read
+
+        if ((m_udpSocket->readDatagram((char *) &blocks[nbBlocks], RemoteUdpSize, &remoteAddress, 0) == RemoteUdpSize)
+            && (datagramSize == RemoteUdpSize))
+        {
+            nbBlocks++;
+        }
+        else
+        {
+            m_nbTruncated.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (nbBlocks > 0)
+    {
+        QMutexLocker mutexLocker(&m_remoteAddressMutex);
+        m_remoteAddress = remoteAddress;
+    }
+
+    return nbBlocks;
+}
+
+#ifdef REMOTEINPUT_RECVMMSG
+bool RemoteInputUDPReceiver::openSocket(const QHostAddress& address, quint16 port)
+{
+    sockaddr_storage bindAddress;
+    socklen_t bindAddressLength;
+    memset(&bindAddress, 0, sizeof(bindAddress));
+
+    if (address.protocol() == QAbstractSocket::IPv6Protocol)
+    {
+        sockaddr_in6 *address6 = (sockaddr_in6 *) &bindAddress;
+        Q_IPV6ADDR ipv6 = address.toIPv6Address();
+        address6->sin6_family = AF_INET6;
+        address6->sin6_port = htons(port);
+        memcpy(&address6->sin6_addr, &ipv6, sizeof(address6->sin6_addr));
+        bindAddressLength = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        sockaddr_in *address4 = (sockaddr_in *) &bindAddress;
+        address4->sin_family = AF_INET;
+        address4->sin_port = htons(port);
+        address4->sin_addr.s_addr = address.protocol() == QAbstractSocket::IPv4Protocol ? htonl(address.toIPv4Address()) : htonl(INADDR_ANY);
+        bindAddressLength = sizeof(sockaddr_in);
+    }
+
+    m_socket = ::socket(bindAddress.ss_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+    if (m_socket < 0)
+    {
+        qWarning("RemoteInputUDPReceiver::openSocket: cannot create socket: %s", strerror(errno));
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    int rcvBufSize = 4 * RemoteInputFramePool::m_nbBlocks * RemoteUdpSize; // absorb bursts while the thread is not scheduled
+    setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &rcvBufSize, sizeof(rcvBufSize));
+    timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = m_readTimeoutMs * 1000;
+    setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    if (::bind(m_socket, (const sockaddr *) &bindAddress, bindAddressLength) < 0)
+    {
+        qWarning("RemoteInputUDPReceiver::openSocket: cannot bind to %s:%d: %s",
+            qPrintable(address.toString()), port, strerror(errno));
+        closeSocket();
+        return false;
+    }
+
+    return true;
+}
+
+void RemoteInputUDPReceiver::closeSocket()
+{
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+        m_socket = -1;
+    }
+}
+
+int RemoteInputUDPReceiver::receiveMmsg(RemoteSuperBlock *blocks, int maxCount)
+{
+    for (int i = 0; i < maxCount; i++)
+    {
+        m_mmsgIovecs[i].iov_base = (void *) &blocks[i];
+        m_mmsgIovecs[i].iov_len = RemoteUdpSize;
+        m_mmsgHeaders[i].msg_hdr.msg_iov = &m_mmsgIovecs[i];
+        m_mmsgHeaders[i].msg_hdr.msg_iovlen = 1;
+        m_mmsgHeaders[i].msg_hdr.msg_name = &m_mmsgSenders[i];
+        m_mmsgHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        m_mmsgHeaders[i].msg_hdr.msg_flags = 0;
+    }
+
+    // blocks until at least one datagram or the read timeout then takes whatever else is queued
+    int nbReceived = ::recvmmsg(m_socket, m_mmsgHeaders, maxCount, MSG_WAITFORONE, nullptr);
+
+    if (nbReceived < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+        {
+            qWarning("RemoteInputUDPReceiver::receiveMmsg: %s", strerror(errno));
+            msleep(m_readTimeoutMs); // do not spin on a persistent error
+        }
+
+        return 0;
+    }
+
+    // keep only complete datagrams, contiguous at the start of the span. A larger datagram fills
+    // the block exactly but is flagged as truncated.
+    int nbBlocks = 0;
+
+    for (int i = 0; i < nbReceived; i++)
+    {
+        if ((m_mmsgHeaders[i].msg_len != RemoteUdpSize) || (m_mmsgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC))
+        {
+            m_nbTruncated.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (i != nbBlocks) {
+            blocks[nbBlocks] = blocks[i];
+        }
+
+        nbBlocks++;
+    }
+
+    if (nbReceived > 0)
+    {
+        QHostAddress remoteAddress((const sockaddr *) &m_mmsgSenders[nbReceived - 1]);
+        QMutexLocker mutexLocker(&m_remoteAddressMutex);
+
+        if (remoteAddress != m_remoteAddress) {
+            m_remoteAddress = remoteAddress;
+        }
+    }
+
+    return nbBlocks;
+}
+#endif
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPRECEIVER_H_
+#define PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPRECEIVER_H_
+
+#include <atomic>
+
+#include <QThread>
+#include <QMutex>
+#include <QHostAddress>
+
+#include "channel/remotedatablock.h"
+
+#if defined(__linux__)
+#define REMOTEINPUT_RECVMMSG // receive a batch of datagrams with one system call
+#include <sys/socket.h>
+#endif
+
+class QUdpSocket;
+class RemoteInputFramePool;
+
+/**
+ * Receive stage of the Remote input. Drains the UDP socket in its own thread directly into
+ * the preallocated frame pool so that datagrams keep being read while the FEC decoder and
+ * the DSP side are busy. On Linux datagrams are received in batches with recvmmsg(2).
+ */
+class RemoteInputUDPReceiver : public QThread
+{
+    Q_OBJECT
+public:
+    RemoteInputUDPReceiver(RemoteInputFramePool& framePool, QObject* parent = nullptr);
+    ~RemoteInputUDPReceiver();
+
+    bool startWork(const QHostAddress& address, quint16 port); //!< bind the socket and start the thread. Returns false if the socket cannot be bound
+    void stopWork();
+
+    uint64_t getNbPackets() const { return m_nbPackets.load(std::memory_order_relaxed); }       //!< valid datagrams received since start
+    uint64_t getNbDropped() const { return m_nbDropped.load(std::memory_order_relaxed); }       //!< datagrams dropped because the pool was full
+    uint64_t getNbTruncated() const { return m_nbTruncated.load(std::memory_order_relaxed); }   //!< datagrams dropped because they were not of the block size (truncated or short)
+    QHostAddress getRemoteAddress() const;
+
+private:
+    static const int m_batchSize = 64;        //!< maximum number of datagrams per receive call
+    static const int m_readTimeoutMs = 100;   //!< socket read timeout so that the thread can notice a stop request
+
+    RemoteInputFramePool& m_framePool;
+    std::atomic<bool> m_running;
+    std::atomic<uint64_t> m_nbPackets;
+    std::atomic<uint64_t> m_nbDropped;
+    std::atomic<uint64_t> m_nbTruncated;
+    mutable QMutex m_remoteAddressMutex;
+    QHostAddress m_remoteAddress;
+    RemoteSuperBlock *m_scratchBlocks;        //!< receive target when the pool is full
+
+#ifdef REMOTEINPUT_RECVMMSG
+    int m_socket;
+    mmsghdr m_mmsgHeaders[m_batchSize];
+    iovec m_mmsgIovecs[m_batchSize];
+    sockaddr_storage m_mmsgSenders[m_batchSize];
+
+    bool openSocket(const QHostAddress& address, quint16 port);
+    void closeSocket();
+    int receiveMmsg(RemoteSuperBlock *blocks, int maxCount);
+#endif
+    QUdpSocket *m_udpSocket; //!< used where recvmmsg is not available
+
+    void run();
+    int receiveBlocks(RemoteSuperBlock *blocks, int maxCount);
+    int receiveDatagrams(RemoteSuperBlock *blocks, int maxCount);
+};
+
+#endif /* PLUGINS_SAMPLESOURCE_REMOTEINPUT_REMOTEINPUTUDPRECEIVER_H_ */
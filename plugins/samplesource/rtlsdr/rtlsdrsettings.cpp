@@ -41,6 +41,7 @@ void RTLSDRSettings::resetToDefaults()
 	m_transverterDeltaFrequency = 0;
 	m_rfBandwidth = 2500 * 1000; // Hz
 	m_fileRecordName = "";
+	m_fileRecordFormat = 0;
 	m_offsetTuning = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
@@ -70,6 +71,7 @@ QByteArray RTLSDRSettings::serialize() const
     s.writeString(17, m_reverseAPIAddress);
     s.writeU32(18, m_reverseAPIPort);
     s.writeU32(19, m_reverseAPIDeviceIndex);
+    s.writeS32(20, m_fileRecordFormat);
 
 	return s.final();
 }
@@ -116,6 +118,7 @@ bool RTLSDRSettings::deserialize(const QByteArray& data)
 
         d.readU32(19, &utmp, 0);
         m_reverseAPIDeviceIndex = utmp > 99 ? 99 : utmp;
+        d.readS32(20, &m_fileRecordFormat, 0);
 
 		return true;
 	}
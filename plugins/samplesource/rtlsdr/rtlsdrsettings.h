@@ -42,6 +42,7 @@ struct RTLSDRSettings {
 	qint64 m_transverterDeltaFrequency;
 	quint32 m_rfBandwidth; //!< RF filter bandwidth in Hz
 	QString m_fileRecordName;
+	int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
 	bool m_offsetTuning;
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
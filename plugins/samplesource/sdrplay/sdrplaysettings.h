@@ -46,6 +46,7 @@ struct SDRPlaySettings {
 	bool m_mixerAmpOn;
 	int  m_basebandGain;
     QString m_fileRecordName;
+    int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
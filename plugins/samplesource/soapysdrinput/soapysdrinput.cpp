@@ -94,6 +94,14 @@ bool SoapySDRInput::openDevice()
         qDebug("SoapySDRInput::openDevice: allocated SampleFifo");
     }
 
+#ifdef SDR_RX_FLOAT_BASEBAND
+    if (!m_sampleFifoF.setSize(96000 * 4))
+    {
+        qCritical("SoapySDRInput::openDevice: could not allocate float SampleFifo");
+        return false;
+    }
+#endif
+
     // look for Rx buddies and get reference to the device object
     if (m_deviceAPI->getSourceBuddies().size() > 0) // look source sibling first
     {
@@ -497,12 +505,14 @@ bool SoapySDRInput::start()
             qDebug("SoapySDRInput::start: expand channels. Re-allocate thread and take ownership");
 
             SampleSinkFifo **fifos = new SampleSinkFifo*[nbOriginalChannels];
+            FSampleSinkFifo **fifoFs = new FSampleSinkFifo*[nbOriginalChannels];
             unsigned int *log2Decims = new unsigned int[nbOriginalChannels];
             int *fcPoss = new int[nbOriginalChannels];
 
             for (int i = 0; i < nbOriginalChannels; i++) // save original FIFO references and data
             {
                 fifos[i] = soapySDRInputThread->getFifo(i);
+                fifoFs[i] = soapySDRInputThread->getFifoF(i);
                 log2Decims[i] = soapySDRInputThread->getLog2Decimation(i);
                 fcPoss[i] = soapySDRInputThread->getFcPos(i);
             }
@@ -515,6 +525,7 @@ bool SoapySDRInput::start()
             for (int i = 0; i < nbOriginalChannels; i++) // restore original FIFO references
             {
                 soapySDRInputThread->setFifo(i, fifos[i]);
+                soapySDRInputThread->setFifoF(i, fifoFs[i]);
                 soapySDRInputThread->setLog2Decimation(i, log2Decims[i]);
                 soapySDRInputThread->setFcPos(i, fcPoss[i]);
             }
@@ -529,6 +540,7 @@ bool SoapySDRInput::start()
 
             delete[] fcPoss;
             delete[] log2Decims;
+            delete[] fifoFs;
             delete[] fifos;
 
             needsStart = true;
@@ -547,6 +559,9 @@ bool SoapySDRInput::start()
     }
 
     soapySDRInputThread->setFifo(requestedChannel, &m_sampleFifo);
+#ifdef SDR_RX_FLOAT_BASEBAND
+    soapySDRInputThread->setFifoF(requestedChannel, &m_sampleFifoF);
+#endif
     soapySDRInputThread->setLog2Decimation(requestedChannel, m_settings.m_log2Decim);
     soapySDRInputThread->setFcPos(requestedChannel, (int) m_settings.m_fcPos);
 
@@ -617,6 +632,7 @@ void SoapySDRInput::stop()
         qDebug("SoapySDRInput::stop: MI mode. Reduce by deleting and re-creating the thread");
         soapySDRInputThread->stopWork();
         SampleSinkFifo **fifos = new SampleSinkFifo*[nbOriginalChannels-1];
+        FSampleSinkFifo **fifoFs = new FSampleSinkFifo*[nbOriginalChannels-1];
         unsigned int *log2Decims = new unsigned int[nbOriginalChannels-1];
         int *fcPoss = new int[nbOriginalChannels-1];
         int highestActiveChannelIndex = -1;
@@ -624,6 +640,7 @@ void SoapySDRInput::stop()
         for (int i = 0; i < nbOriginalChannels-1; i++) // save original FIFO references and get the channel with highest index
         {
             fifos[i] = soapySDRInputThread->getFifo(i);
+            fifoFs[i] = soapySDRInputThread->getFifoF(i);
 
             if ((soapySDRInputThread->getFifo(i) != 0) && (i > highestActiveChannelIndex)) {
                 highestActiveChannelIndex = i;
@@ -644,6 +661,7 @@ void SoapySDRInput::stop()
             for (int i = 0; i < highestActiveChannelIndex; i++)  // restore original FIFO references
             {
                 soapySDRInputThread->setFifo(i, fifos[i]);
+                soapySDRInputThread->setFifoF(i, fifoFs[i]);
                 soapySDRInputThread->setLog2Decimation(i, log2Decims[i]);
                 soapySDRInputThread->setFcPos(i, fcPoss[i]);
             }
@@ -669,12 +687,14 @@ void SoapySDRInput::stop()
 
         delete[] fcPoss;
         delete[] log2Decims;
+        delete[] fifoFs;
         delete[] fifos;
     }
     else // remove channel from existing thread
     {
         qDebug("SoapySDRInput::stop: MI mode. Not changing MI configuration. Just remove FIFO reference");
         soapySDRInputThread->setFifo(requestedChannel, 0); // remove FIFO
+        soapySDRInputThread->setFifoF(requestedChannel, 0);
     }
 
     m_running = false;
@@ -805,7 +825,7 @@ bool SoapySDRInput::handleMessage(const Message& message)
             if (m_settings.m_fileRecordName.size() != 0) {
                 m_fileSink->setFileName(m_settings.m_fileRecordName);
             } else {
-                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID());
+                m_fileSink->genUniqueFileName(m_deviceAPI->getDeviceUID(), m_settings.m_fileRecordFormat);
             }
 
             m_fileSink->startRecording();
@@ -1454,6 +1474,9 @@ int SoapySDRInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getSoapySdrInputSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat")) {
+        settings.m_fileRecordFormat = response.getSoapySdrInputSettings()->getFileRecordFormat();
+    }
     if (deviceSettingsKeys.contains("antenna")) {
         settings.m_antenna = *response.getSoapySdrInputSettings()->getAntenna();
     }
@@ -1623,6 +1646,8 @@ void SoapySDRInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
         response.getSoapySdrInputSettings()->setFileRecordName(new QString(settings.m_fileRecordName));
     }
 
+    response.getSoapySdrInputSettings()->setFileRecordFormat(settings.m_fileRecordFormat);
+
     if (response.getSoapySdrInputSettings()->getAntenna()) {
         *response.getSoapySdrInputSettings()->getAntenna() = settings.m_antenna;
     } else {
@@ -1827,6 +1852,17 @@ void SoapySDRInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& respo
             response.getSoapySdrInputReport()->getBandwidthsRanges()->back()->setMax(itBandwidth.maximum());
         }
     }
+
+    SoapySDRInputThread *soapySDRInputThread = findThread();
+
+    if (soapySDRInputThread)
+    {
+        DeviceSamplePipeline::Stats stats;
+        soapySDRInputThread->getPipelineStats(stats);
+        response.getSoapySdrInputReport()->setPipelineOverrunCount(stats.m_overruns);
+        response.getSoapySdrInputReport()->setPipelineLatencyAvg(stats.m_latencyAvg);
+        response.getSoapySdrInputReport()->setPipelineLatencyMax(stats.m_latencyMax);
+    }
 }
 
 QVariant SoapySDRInput::webapiVariantFromArgValue(SWGSDRangel::SWGArgValue *argValue)
@@ -1950,6 +1986,9 @@ void SoapySDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgSoapySDRInputSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("fileRecordFormat") || force) {
+        swgSoapySDRInputSettings->setFileRecordFormat(settings.m_fileRecordFormat);
+    }
     if (deviceSettingsKeys.contains("antenna") || force) {
         swgSoapySDRInputSettings->setAntenna(new QString(settings.m_antenna));
     }
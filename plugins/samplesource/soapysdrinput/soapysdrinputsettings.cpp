@@ -38,6 +38,7 @@ void SoapySDRInputSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_antenna = "NONE";
     m_bandwidth = 1000000;
     m_globalGain = 0;
@@ -82,6 +83,7 @@ QByteArray SoapySDRInputSettings::serialize() const
     s.writeString(24, m_reverseAPIAddress);
     s.writeU32(25, m_reverseAPIPort);
     s.writeU32(26, m_reverseAPIDeviceIndex);
+    s.writeS32(27, m_fileRecordFormat);
 
     return s.final();
 }
@@ -144,6 +146,7 @@ bool SoapySDRInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(26, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readS32(27, &m_fileRecordFormat, 0);
 
         return true;
     }
@@ -40,6 +40,7 @@ struct SoapySDRInputSettings {
     bool m_transverterMode;
     qint64 m_transverterDeltaFrequency;
     QString m_fileRecordName;
+    int m_fileRecordFormat; //!< FileRecord::RecordFormat of the generated record file names
     QString m_antenna;
     quint32 m_bandwidth;
     QMap<QString, double> m_tunableElements;
@@ -22,6 +22,7 @@
 #include <SoapySDR/Errors.hpp>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/fsamplesinkfifo.h"
 #include "soapysdr/devicesoapysdr.h"
 
 #include "soapysdrinputthread.h"
@@ -32,7 +33,8 @@ SoapySDRInputThread::SoapySDRInputThread(SoapySDR::Device* dev, unsigned int nbR
     m_dev(dev),
     m_sampleRate(0),
     m_nbChannels(nbRxChannels),
-    m_decimatorType(DecimatorFloat)
+    m_decimatorType(DecimatorFloat),
+    m_pipeline(this)
 {
     qDebug("SoapySDRInputThread::SoapySDRInputThread");
     m_channels = new Channel[nbRxChannels];
@@ -115,15 +117,14 @@ void SoapySDRInputThread::run()
 
         //allocate buffers for the stream read/write
         const unsigned int numElems = m_dev->getStreamMTU(stream); // number of samples (I+Q)
-        std::vector<std::vector<char>> buffMem(m_nbChannels, std::vector<char>(elemSize*numElems));
-        std::vector<void *> buffs(m_nbChannels);
-
-        for (std::size_t i = 0; i < m_nbChannels; i++) {
-            buffs[i] = buffMem[i].data();
-        }
+        m_pipeline.allocate(m_nbPipelineBuffers, m_nbChannels, elemSize*numElems);
 
         for (unsigned int i = 0; i < m_nbChannels; i++) {
             m_channels[i].m_convertBuffer.resize(numElems, Sample{0,0});
+
+            if (m_decimatorType == DecimatorFloat) {
+                m_channels[i].m_convertBufferF.resize(numElems);
+            }
         }
 
         m_dev->activateStream(stream);
@@ -137,9 +138,12 @@ void SoapySDRInputThread::run()
                 numElems, elemSize, initialTtimeoutUs, timeoutUs);
         qDebug("SoapySDRInputThread::run: start running loop");
 
+        m_pipeline.startWork();
+
         while (m_running)
         {
-            int ret = m_dev->readStream(stream, buffs.data(), numElems, flags, timeNs, timeoutUs);
+            DeviceSamplePipeline::Buffer *buffer = m_pipeline.acquireBuffer();
+            int ret = m_dev->readStream(stream, buffer->m_channelPointers.data(), numElems, flags, timeNs, timeoutUs);
 
             if (ret == SOAPY_SDR_TIMEOUT)
             {
@@ -152,33 +156,14 @@ void SoapySDRInputThread::run()
             else if (ret < 0)
             {
                 qCritical("SoapySDRInputThread::run: Unexpected read stream error: %s", SoapySDR::errToStr(ret));
+                m_pipeline.submitBuffer(buffer, 0);
                 break;
             }
 
-            if (m_nbChannels > 1)
-            {
-                callbackMI(buffs, numElems*2); // size given in number of I or Q samples (2 items per sample)
-            }
-            else
-            {
-                switch (m_decimatorType)
-                {
-                case Decimator8:
-                    callbackSI8((const qint8*) buffs[0], numElems*2);
-                    break;
-                case Decimator12:
-                    callbackSI12((const qint16*) buffs[0], numElems*2);
-                    break;
-                case Decimator16:
-                    callbackSI16((const qint16*) buffs[0], numElems*2);
-                    break;
-                case DecimatorFloat:
-                default:
-                    callbackSIF((const float*) buffs[0], numElems*2);
-                }
-            }
+            m_pipeline.submitBuffer(buffer, ret < 0 ? 0 : ret); // only the samples actually read
         }
 
+        m_pipeline.stopWork();
         qDebug("SoapySDRInputThread::run: stop running loop");
         m_dev->deactivateStream(stream);
         m_dev->closeStream(stream);
@@ -191,6 +176,34 @@ void SoapySDRInputThread::run()
     m_running = false;
 }
 
+void SoapySDRInputThread::processBuffer(const DeviceSamplePipeline::Buffer& buffer)
+{
+    int nbItems = buffer.m_nbSamples*2; // size given in number of I or Q samples (2 items per sample)
+
+    if (m_nbChannels > 1)
+    {
+        callbackMI(buffer.m_channelPointers, nbItems);
+    }
+    else
+    {
+        switch (m_decimatorType)
+        {
+        case Decimator8:
+            callbackSI8((const qint8*) buffer.m_channelPointers[0], nbItems);
+            break;
+        case Decimator12:
+            callbackSI12((const qint16*) buffer.m_channelPointers[0], nbItems);
+            break;
+        case Decimator16:
+            callbackSI16((const qint16*) buffer.m_channelPointers[0], nbItems);
+            break;
+        case DecimatorFloat:
+        default:
+            callbackSIF((const float*) buffer.m_channelPointers[0], nbItems);
+        }
+    }
+}
+
 unsigned int SoapySDRInputThread::getNbFifos()
 {
     unsigned int fifoCount = 0;
@@ -244,6 +257,22 @@ void SoapySDRInputThread::setFifo(unsigned int channel, SampleSinkFifo *sampleFi
     }
 }
 
+void SoapySDRInputThread::setFifoF(unsigned int channel, FSampleSinkFifo *sampleFifo)
+{
+    if (channel < m_nbChannels) {
+        m_channels[channel].m_sampleFifoF = sampleFifo;
+    }
+}
+
+FSampleSinkFifo *SoapySDRInputThread::getFifoF(unsigned int channel)
+{
+    if (channel < m_nbChannels) {
+        return m_channels[channel].m_sampleFifoF;
+    } else {
+        return 0;
+    }
+}
+
 SampleSinkFifo *SoapySDRInputThread::getFifo(unsigned int channel)
 {
     if (channel < m_nbChannels) {
@@ -253,7 +282,7 @@ SampleSinkFifo *SoapySDRInputThread::getFifo(unsigned int channel)
     }
 }
 
-void SoapySDRInputThread::callbackMI(std::vector<void *>& buffs, qint32 samplesPerChannel)
+void SoapySDRInputThread::callbackMI(const std::vector<void *>& buffs, qint32 samplesPerChannel)
 {
     for(unsigned int ichan = 0; ichan < m_nbChannels; ichan++)
     {
@@ -556,6 +585,12 @@ void SoapySDRInputThread::callbackSI16(const qint16* buf, qint32 len, unsigned i
 
 void SoapySDRInputThread::callbackSIF(const float* buf, qint32 len, unsigned int channel)
 {
+    if (m_channels[channel].m_sampleFifoF)
+    {
+        callbackSIFF(buf, len, channel);
+        return;
+    }
+
     SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
 
     if (m_channels[channel].m_log2Decim == 0)
@@ -646,3 +681,96 @@ void SoapySDRInputThread::callbackSIF(const float* buf, qint32 len, unsigned int
 
     m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
 }
+
+void SoapySDRInputThread::callbackSIFF(const float* buf, qint32 len, unsigned int channel)
+{
+    FSampleVector::iterator it = m_channels[channel].m_convertBufferF.begin();
+
+    if (m_channels[channel].m_log2Decim == 0)
+    {
+        m_channels[channel].m_decimatorsFloatF.decimate1(&it, buf, len);
+    }
+    else
+    {
+        if (m_channels[channel].m_fcPos == 0) // Infra
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                m_channels[channel].m_decimatorsFloatF.decimate2_inf(&it, buf, len);
+                break;
+            case 2:
+                m_channels[channel].m_decimatorsFloatF.decimate4_inf(&it, buf, len);
+                break;
+            case 3:
+                m_channels[channel].m_decimatorsFloatF.decimate8_inf(&it, buf, len);
+                break;
+            case 4:
+                m_channels[channel].m_decimatorsFloatF.decimate16_inf(&it, buf, len);
+                break;
+            case 5:
+                m_channels[channel].m_decimatorsFloatF.decimate32_inf(&it, buf, len);
+                break;
+            case 6:
+                m_channels[channel].m_decimatorsFloatF.decimate64_inf(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_channels[channel].m_fcPos == 1) // Supra
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                m_channels[channel].m_decimatorsFloatF.decimate2_sup(&it, buf, len);
+                break;
+            case 2:
+                m_channels[channel].m_decimatorsFloatF.decimate4_sup(&it, buf, len);
+                break;
+            case 3:
+                m_channels[channel].m_decimatorsFloatF.decimate8_sup(&it, buf, len);
+                break;
+            case 4:
+                m_channels[channel].m_decimatorsFloatF.decimate16_sup(&it, buf, len);
+                break;
+            case 5:
+                m_channels[channel].m_decimatorsFloatF.decimate32_sup(&it, buf, len);
+                break;
+            case 6:
+                m_channels[channel].m_decimatorsFloatF.decimate64_sup(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_channels[channel].m_fcPos == 2) // Center
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                m_channels[channel].m_decimatorsFloatF.decimate2_cen(&it, buf, len);
+                break;
+            case 2:
+                m_channels[channel].m_decimatorsFloatF.decimate4_cen(&it, buf, len);
+                break;
+            case 3:
+                m_channels[channel].m_decimatorsFloatF.decimate8_cen(&it, buf, len);
+                break;
+            case 4:
+                m_channels[channel].m_decimatorsFloatF.decimate16_cen(&it, buf, len);
+                break;
+            case 5:
+                m_channels[channel].m_decimatorsFloatF.decimate32_cen(&it, buf, len);
+                break;
+            case 6:
+                m_channels[channel].m_decimatorsFloatF.decimate64_cen(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    m_channels[channel].m_sampleFifoF->write(m_channels[channel].m_convertBufferF.begin(), it);
+}
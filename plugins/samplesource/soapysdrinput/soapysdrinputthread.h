@@ -21,6 +21,8 @@
 // SoapySDR is a device wrapper with a single stream supporting one or many Rx
 // Therefore only one thread can be allocated for the Rx side
 // All FIFOs must be registered before calling startWork()
+// This thread only reads the stream. Conversion, decimation and FIFO writes
+// are done in the worker thread of the sample pipeline.
 
 #include <QThread>
 #include <QMutex>
@@ -31,10 +33,13 @@
 #include "soapysdr/devicesoapysdrshared.h"
 #include "dsp/decimators.h"
 #include "dsp/decimatorsfi.h"
+#include "dsp/decimatorsff.h"
+#include "dsp/devicesamplepipeline.h"
 
 class SampleSinkFifo;
+class FSampleSinkFifo;
 
-class SoapySDRInputThread : public QThread {
+class SoapySDRInputThread : public QThread, public DeviceSamplePipeline::Processor {
     Q_OBJECT
 
 public:
@@ -53,21 +58,29 @@ public:
     int getFcPos(unsigned int channel) const;
     void setFifo(unsigned int channel, SampleSinkFifo *sampleFifo);
     SampleSinkFifo *getFifo(unsigned int channel);
+    void setFifoF(unsigned int channel, FSampleSinkFifo *sampleFifo); //!< float baseband FIFO used instead of the fixed point one with a float stream (0 to disable)
+    FSampleSinkFifo *getFifoF(unsigned int channel);
+    void getPipelineStats(DeviceSamplePipeline::Stats& stats) { m_pipeline.getStats(stats); }
+    virtual void processBuffer(const DeviceSamplePipeline::Buffer& buffer);
 
 private:
     struct Channel
     {
         SampleVector m_convertBuffer;
         SampleSinkFifo* m_sampleFifo;
+        FSampleVector m_convertBufferF;
+        FSampleSinkFifo* m_sampleFifoF;
         unsigned int m_log2Decim;
         int m_fcPos;
         Decimators<qint32, qint8, SDR_RX_SAMP_SZ, 8> m_decimators8;
         Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12> m_decimators12;
         Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 16> m_decimators16;
         DecimatorsFI m_decimatorsFloat;
+        DecimatorsFF m_decimatorsFloatF;
 
         Channel() :
             m_sampleFifo(0),
+            m_sampleFifoF(0),
             m_log2Decim(0),
             m_fcPos(0)
         {}
@@ -93,6 +106,9 @@ private:
     unsigned int m_sampleRate;
     unsigned int m_nbChannels;
     DecimatorType m_decimatorType;
+    DeviceSamplePipeline m_pipeline;
+
+    static const unsigned int m_nbPipelineBuffers = 8; //!< number of buffers between stream reader and decimation
 
     void run();
     unsigned int getNbFifos();
@@ -100,7 +116,8 @@ private:
     void callbackSI12(const qint16* buf, qint32 len, unsigned int channel = 0);
     void callbackSI16(const qint16* buf, qint32 len, unsigned int channel = 0);
     void callbackSIF(const float* buf, qint32 len, unsigned int channel = 0);
-    void callbackMI(std::vector<void *>& buffs, qint32 samplesPerChannel);
+    void callbackSIFF(const float* buf, qint32 len, unsigned int channel = 0);
+    void callbackMI(const std::vector<void *>& buffs, qint32 samplesPerChannel);
 };
 
 
@@ -43,6 +43,7 @@ void TestSourceSettings::resetToDefaults()
     m_qFactor = 0.0f;
     m_phaseImbalance = 0.0f;
     m_fileRecordName = "";
+    m_fileRecordFormat = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -72,6 +73,7 @@ QByteArray TestSourceSettings::serialize() const
     s.writeString(19, m_reverseAPIAddress);
     s.writeU32(20, m_reverseAPIPort);
     s.writeU32(21, m_reverseAPIDeviceIndex);
+    s.writeS32(22, m_fileRecordFormat);
     return s.final();
 }
 
@@ -133,6 +135,7 @@ bool TestSourceSettings::deserialize(const QByteArray& data)
 
         d.readU32(21, &utmp, 0);
         m_reverseAPIDeviceIndex = utmp > 99 ? 99 : utmp;
+        d.readS32(22, &m_fileRecordFormat, 0);
 
         return true;
     }
@@ -1527,6 +1527,17 @@ void XTRXInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response)
     response.getXtrxInputReport()->setFifoFill(fifolevel);
     response.getXtrxInputReport()->setTemperature(temp);
     response.getXtrxInputReport()->setGpsLock(gpsStatus ? 1 : 0);
+
+    XTRXInputThread *xtrxInputThread = findThread();
+
+    if (xtrxInputThread)
+    {
+        DeviceSamplePipeline::Stats stats;
+        xtrxInputThread->getPipelineStats(stats);
+        response.getXtrxInputReport()->setPipelineOverrunCount(stats.m_overruns);
+        response.getXtrxInputReport()->setPipelineLatencyAvg(stats.m_latencyAvg);
+        response.getXtrxInputReport()->setPipelineLatencyMax(stats.m_latencyMax);
+    }
 }
 
 void XTRXInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const XTRXInputSettings& settings, bool force)
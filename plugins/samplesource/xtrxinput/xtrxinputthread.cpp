@@ -29,7 +29,8 @@ XTRXInputThread::XTRXInputThread(struct xtrx_dev *dev, unsigned int nbChannels,
     m_running(false),
     m_dev(dev),
     m_nbChannels(nbChannels),
-    m_uniqueChannelIndex(uniqueChannelIndex)
+    m_uniqueChannelIndex(uniqueChannelIndex),
+    m_pipeline(this)
 {
     qDebug("XTRXInputThread::XTRXInputThread: nbChannels: %u uniqueChannelIndex: %u", nbChannels, uniqueChannelIndex);
     m_channels = new Channel[2];
@@ -37,6 +38,9 @@ XTRXInputThread::XTRXInputThread(struct xtrx_dev *dev, unsigned int nbChannels,
     for (unsigned int i = 0; i < 2; i++) {
         m_channels[i].m_convertBuffer.resize(DeviceXTRX::blockSize, Sample{0,0});
     }
+
+    const unsigned int elemSize = 4; // XTRX uses 4 byte I+Q samples
+    m_pipeline.allocate(m_nbPipelineBuffers, m_nbChannels, elemSize*DeviceXTRX::blockSize);
 }
 
 XTRXInputThread::~XTRXInputThread()
@@ -121,28 +125,24 @@ void XTRXInputThread::run()
             qDebug("XTRXInputThread::run: stream started");
         }
 
-        const unsigned int elemSize = 4; // XTRX uses 4 byte I+Q samples
-        std::vector<std::vector<char>> buffMem(m_nbChannels, std::vector<char>(elemSize*DeviceXTRX::blockSize));
-        std::vector<void *> buffs(m_nbChannels);
-
-        for (std::size_t i = 0; i < m_nbChannels; i++) {
-            buffs[i] = buffMem[i].data();
-        }
-
         xtrx_recv_ex_info_t nfo;
         nfo.samples = DeviceXTRX::blockSize;
         nfo.buffer_count = m_nbChannels;
-        nfo.buffers = (void* const*) buffs.data();
         nfo.flags = RCVEX_DONT_INSER_ZEROS | RCVEX_DROP_OLD_ON_OVERFLOW;
 
+        m_pipeline.startWork();
+
         while (m_running)
         {
+            DeviceSamplePipeline::Buffer *buffer = m_pipeline.acquireBuffer();
+            nfo.buffers = (void* const*) buffer->m_channelPointers.data();
             res = xtrx_recv_sync_ex(m_dev, &nfo);
 
             if (res < 0)
             {
                 qCritical("XTRXInputThread::run read error: %d", res);
                 qDebug("XTRXInputThread::run: out_samples: %u out_events: %u", nfo.out_samples, nfo.out_events);
+                m_pipeline.submitBuffer(buffer, 0);
                 break;
             }
 
@@ -150,13 +150,11 @@ void XTRXInputThread::run()
                 qDebug("XTRXInputThread::run: overflow");
             }
 
-            if (m_nbChannels > 1) {
-                callbackMI((const qint16*) buffs[0], (const qint16*) buffs[1], 2 * nfo.out_samples);
-            } else {
-                callbackSI((const qint16*) buffs[0], 2 * nfo.out_samples);
-            }
+            m_pipeline.submitBuffer(buffer, nfo.out_samples);
         }
 
+        m_pipeline.stopWork();
+
         res = xtrx_stop(m_dev, XTRX_RX);
 
         if (res != 0)
@@ -177,6 +175,15 @@ void XTRXInputThread::run()
     m_running = false;
 }
 
+void XTRXInputThread::processBuffer(const DeviceSamplePipeline::Buffer& buffer)
+{
+    if (m_nbChannels > 1) {
+        callbackMI((const qint16*) buffer.m_channels[0].data(), (const qint16*) buffer.m_channels[1].data(), 2 * buffer.m_nbSamples);
+    } else {
+        callbackSI((const qint16*) buffer.m_channels[0].data(), 2 * buffer.m_nbSamples);
+    }
+}
+
 unsigned int XTRXInputThread::getNbFifos()
 {
     unsigned int fifoCount = 0;
@@ -27,11 +27,16 @@
 
 #include "dsp/samplesinkfifo.h"
 #include "dsp/decimators.h"
+#include "dsp/devicesamplepipeline.h"
 #include "xtrx/devicextrxshared.h"
 
 struct xtrx_dev;
 
-class XTRXInputThread : public QThread, public DeviceXTRXShared::ThreadInterface
+/**
+ * This thread only reads the stream. Decimation and FIFO writes are done in the
+ * worker thread of the sample pipeline.
+ */
+class XTRXInputThread : public QThread, public DeviceXTRXShared::ThreadInterface, public DeviceSamplePipeline::Processor
 {
     Q_OBJECT
 
@@ -47,6 +52,8 @@ public:
     unsigned int getLog2Decimation(unsigned int channel) const;
     void setFifo(unsigned int channel, SampleSinkFifo *sampleFifo);
     SampleSinkFifo *getFifo(unsigned int channel);
+    void getPipelineStats(DeviceSamplePipeline::Stats& stats) { m_pipeline.getStats(stats); }
+    virtual void processBuffer(const DeviceSamplePipeline::Buffer& buffer);
 
 private:
     struct Channel
@@ -73,6 +80,9 @@ private:
     Channel *m_channels; //!< Array of channels dynamically allocated for the given number of Rx channels
     unsigned int m_nbChannels;
     unsigned int m_uniqueChannelIndex;
+    DeviceSamplePipeline m_pipeline;
+
+    static const unsigned int m_nbPipelineBuffers = 8; //!< number of buffers between stream reader and decimation
 
     void run();
     unsigned int getNbFifos();
@@ -72,7 +72,8 @@ QDataStream& operator>>(QDataStream& ds, AudioDeviceManager::OutputDeviceInfo& i
     return ds;
 }
 
-AudioDeviceManager::AudioDeviceManager()
+AudioDeviceManager::AudioDeviceManager() :
+    m_nullOutput(false)
 {
     qDebug("AudioDeviceManager::AudioDeviceManager: scan input devices");
     m_inputDevicesInfo = QAudioDeviceInfo::availableDevices(QAudio::AudioInput);
@@ -368,6 +369,12 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
     uint32_t decimationFactor;
     QString deviceName;
 
+    if (m_nullOutput)
+    {
+        qDebug("AudioDeviceManager::startAudioOutput: %d: null output", outputDeviceIndex);
+        return;
+    }
+
     if (getOutputDeviceName(outputDeviceIndex, deviceName))
     {
         if (m_audioOutputInfos.find(deviceName) == m_audioOutputInfos.end())
@@ -393,7 +400,18 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
             decimationFactor = m_audioOutputInfos[deviceName].udpDecimationFactor;
         }
 
-        m_audioOutputs[outputDeviceIndex]->start(outputDeviceIndex, sampleRate);
+        if (m_outputDirectory.isEmpty())
+        {
+            m_audioOutputs[outputDeviceIndex]->start(outputDeviceIndex, sampleRate);
+        }
+        else // offline
+        {
+            QString fileName = outputDeviceIndex < 0 ?
+                QString("%1/audio.wav").arg(m_outputDirectory) :
+                QString("%1/audio%2.wav").arg(m_outputDirectory).arg(outputDeviceIndex);
+            m_audioOutputs[outputDeviceIndex]->startToFile(fileName, sampleRate);
+        }
+
         m_audioOutputInfos[deviceName].sampleRate = m_audioOutputs[outputDeviceIndex]->getRate(); // update with actual rate
         m_audioOutputInfos[deviceName].udpAddress = udpAddress;
         m_audioOutputInfos[deviceName].udpPort = udpPort;
@@ -409,6 +427,21 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
     }
 }
 
+void AudioDeviceManager::getOutputProfileStages(DSPProfile& profile)
+{
+    for (QMap<int, AudioOutput*>::iterator it = m_audioOutputs.begin(); it != m_audioOutputs.end(); ++it)
+    {
+        QString deviceName;
+
+        if ((it.value()->getNbFifos() == 0) || !getOutputDeviceName(it.key(), deviceName)) {
+            continue;
+        }
+
+        it.value()->getProfileStage().setName(QString("AudioOutput(%1)").arg(deviceName));
+        profile.addStage(it.value()->getProfileStage(), DSPProfile::StageAudio);
+    }
+}
+
 void AudioDeviceManager::stopAudioOutput(int outputDeviceIndex)
 {
     m_audioOutputs[outputDeviceIndex]->stop();
@@ -521,6 +554,15 @@ int AudioDeviceManager::getOutputSampleRate(int outputDeviceIndex)
     }
 }
 
+quint32 AudioDeviceManager::getOutputUDPNbFramesDropped(int outputDeviceIndex)
+{
+    if (m_audioOutputs.find(outputDeviceIndex) == m_audioOutputs.end()) { // no audio output allocated for this device
+        return 0;
+    }
+
+    return m_audioOutputs[outputDeviceIndex]->getUdpNbFramesDropped();
+}
+
 
 void AudioDeviceManager::setInputDeviceInfo(int inputDeviceIndex, const InputDeviceInfo& deviceInfo)
 {
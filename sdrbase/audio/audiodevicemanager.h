@@ -107,12 +107,17 @@ public:
     bool getOutputDeviceInfo(const QString& deviceName, OutputDeviceInfo& deviceInfo) const;
     int getInputSampleRate(int inputDeviceIndex = -1);
     int getOutputSampleRate(int outputDeviceIndex = -1);
+    quint32 getOutputUDPNbFramesDropped(int outputDeviceIndex = -1); //!< audio frames the copy to UDP of a running output could not queue
     void setInputDeviceInfo(int inputDeviceIndex, const InputDeviceInfo& deviceInfo);
     void setOutputDeviceInfo(int outputDeviceIndex, const OutputDeviceInfo& deviceInfo);
     void unsetInputDeviceInfo(int inputDeviceIndex);
     void unsetOutputDeviceInfo(int outputDeviceIndex);
     void inputInfosCleanup();  //!< Remove input info from map for input devices not present
     void outputInfosCleanup(); //!< Remove output info from map for output devices not present
+    void getOutputProfileStages(DSPProfile& profile); //!< Append the profile snapshots of the audio outputs in use
+    void setOutputDirectory(const QString& directory) { m_outputDirectory = directory; } //!< offline mode: outputs started from now on are written in WAV files there. Empty to play them
+    const QString& getOutputDirectory() const { return m_outputDirectory; }
+    void setNullOutput(bool nullOutput) { m_nullOutput = nullOutput; } //!< benchmarks: outputs started from now on are neither played nor written. Their FIFOs are not read
 
     static const unsigned int m_defaultAudioSampleRate = 48000;
     static const float m_defaultAudioInputVolume;
@@ -129,6 +134,8 @@ private:
     QMap<int, QList<MessageQueue*> > m_outputDeviceSinkMessageQueues; //!< sink message queues attached to device
     QMap<int, AudioOutput*> m_audioOutputs; //!< audio device index to audio output map (index -1 is default device)
     QMap<QString, OutputDeviceInfo> m_audioOutputInfos; //!< audio device name to audio output info
+    QString m_outputDirectory; //!< where audio outputs are written in offline mode
+    bool m_nullOutput;         //!< audio outputs are not started
 
     QMap<AudioFifo*, int> m_audioSourceFifos; //< audio source FIFO to audio input device index-1 map
     QMap<AudioFifo*, MessageQueue*> m_audioFifoToSourceMessageQueues; //!< audio source FIFO to attached source message queue
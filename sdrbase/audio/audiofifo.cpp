@@ -25,6 +25,8 @@
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 
 AudioFifo::AudioFifo() :
+	m_blocking(false),
+	m_dataReady(0),
 	m_fifo(0),
 	m_sampleSize(sizeof(AudioSample))
 {
@@ -35,6 +37,8 @@ AudioFifo::AudioFifo() :
 }
 
 AudioFifo::AudioFifo(uint32_t numSamples) :
+	m_blocking(false),
+	m_dataReady(0),
 	m_fifo(0),
     m_sampleSize(sizeof(AudioSample))
 {
@@ -63,10 +67,17 @@ bool AudioFifo::setSize(uint32_t numSamples)
 	return create(numSamples);
 }
 
+void AudioFifo::setBlocking(bool blocking, QSemaphore *dataReady)
+{
+	QMutexLocker mutexLocker(&m_mutex); // the writer must not release a semaphore going away
+
+	m_blocking = blocking;
+	m_dataReady = blocking ? dataReady : 0;
+}
+
 uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 {
-	uint32_t total;
-	uint32_t remaining;
+	uint32_t total = 0;
 	uint32_t copyLen;
 
 	if (m_fifo == 0) {
@@ -75,25 +86,34 @@ uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 
 	m_mutex.lock();
 
-	total = MIN(numSamples, m_size - m_fill);
-	remaining = total;
-
-	while (remaining != 0)
+	while (total < numSamples)
 	{
 		if (isFull())
 		{
-			m_mutex.unlock();
-			return total - remaining; // written so far
+			if (m_dataReady) {
+				m_dataReady->release(); // the reader has to make room
+			}
+
+			// when blocking wait for the reader else return what was written so far
+			if (!m_blocking || !m_roomWaiter.wait(&m_mutex, m_blockingTimeoutMs)) {
+				break;
+			}
+
+			continue;
 		}
 
-		copyLen = MIN(remaining, m_size - m_fill);
+		copyLen = MIN(numSamples - total, m_size - m_fill);
 		copyLen = MIN(copyLen, m_size - m_tail);
 		memcpy(m_fifo + (m_tail * m_sampleSize), data, copyLen * m_sampleSize);
 		m_tail += copyLen;
 		m_tail %= m_size;
 		m_fill += copyLen;
 		data += copyLen * m_sampleSize;
-		remaining -= copyLen;
+		total += copyLen;
+	}
+
+	if (m_dataReady && (total > 0)) {
+		m_dataReady->release();
 	}
 
 	m_mutex.unlock();
@@ -134,6 +154,7 @@ uint AudioFifo::read(quint8* data, uint32_t numSamples)
 		remaining -= copyLen;
 	}
 
+	m_roomWaiter.wakeAll();
 	m_mutex.unlock();
 	return total;
 }
@@ -149,6 +170,7 @@ uint AudioFifo::drain(uint32_t numSamples)
 
 	m_head = (m_head + numSamples) % m_size;
 	m_fill -= numSamples;
+	m_roomWaiter.wakeAll();
 
 	return numSamples;
 }
@@ -160,6 +182,7 @@ void AudioFifo::clear()
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_roomWaiter.wakeAll();
 }
 
 bool AudioFifo::create(uint32_t numSamples)
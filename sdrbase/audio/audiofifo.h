@@ -22,6 +22,7 @@
 #include <QObject>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QSemaphore>
 
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -47,8 +48,15 @@ public:
 	inline bool isFull() const { return m_fill == m_size; }
 	inline uint32_t size() const { return m_size; }
 
+	void setBlocking(bool blocking, QSemaphore *dataReady = 0); //!< writes wait for the reader to make room instead of dropping samples. dataReady is released on each write
+
+	static const unsigned long m_blockingTimeoutMs = 1000; //!< a blocked write gives up after this time and drops what is left
+
 private:
 	QMutex m_mutex;
+	QWaitCondition m_roomWaiter; //!< signaled by the reader when room is made
+	volatile bool m_blocking;
+	QSemaphore *m_dataReady; //!< lets a blocking reader sleep until data is written
 
 	qint8* m_fifo;
 
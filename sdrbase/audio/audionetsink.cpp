@@ -19,17 +19,28 @@
 #include <algorithm>
 
 #include "audionetsink.h"
+#include "audionetsinkthread.h"
 #include "util/rtpsink.h"
 
 #include <QDebug>
 #include <QUdpSocket>
 
-const int AudioNetSink::m_udpBlockSize = 512;
+#ifdef AUDIONETSINK_SENDMMSG
+#include <netinet/in.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#endif
 
-AudioNetSink::AudioNetSink(QObject *parent) :
+const int AudioNetSink::m_udpBlockSize;
+
+AudioNetSink::AudioNetSink() :
     m_type(SinkUDP),
     m_codec(CodecL16),
+    m_udpSocket(0),
     m_rtpBufferAudio(0),
+    m_rtpSampleRate(0),
+    m_rtpStereo(false),
     m_sampleRate(48000),
     m_stereo(false),
     m_decimation(1),
@@ -37,16 +48,28 @@ AudioNetSink::AudioNetSink(QObject *parent) :
     m_codecInputSize(960),
     m_codecInputIndex(0),
     m_bufferIndex(0),
-    m_port(9998)
+    m_port(9998),
+    m_channelMode(ChannelLeft),
+    m_nbDatagrams(0)
 {
     std::fill(m_data, m_data+m_dataBlockSize, 0);
-    m_udpSocket = new QUdpSocket(parent);
+#ifdef AUDIONETSINK_SENDMMSG
+    m_mmsgSocket = -1;
+    memset(&m_mmsgAddress, 0, sizeof(m_mmsgAddress));
+    m_mmsgAddressLength = 0;
+    m_mmsgPort = 0;
+#endif
+    m_encoderThread = new AudioNetSinkThread(this);
+    m_encoderThread->startWork();
 }
 
-AudioNetSink::AudioNetSink(QObject *parent, int sampleRate, bool stereo) :
+AudioNetSink::AudioNetSink(int sampleRate, bool stereo) :
     m_type(SinkUDP),
     m_codec(CodecL16),
+    m_udpSocket(0),
     m_rtpBufferAudio(0),
+    m_rtpSampleRate(sampleRate),
+    m_rtpStereo(stereo),
     m_sampleRate(48000),
     m_stereo(false),
     m_decimation(1),
@@ -54,20 +77,52 @@ AudioNetSink::AudioNetSink(QObject *parent, int sampleRate, bool stereo) :
     m_codecInputSize(960),
     m_codecInputIndex(0),
     m_bufferIndex(0),
-    m_port(9998)
+    m_port(9998),
+    m_channelMode(ChannelLeft),
+    m_nbDatagrams(0)
 {
     std::fill(m_data, m_data+m_dataBlockSize, 0);
-    m_udpSocket = new QUdpSocket(parent);
-    m_rtpBufferAudio = new RTPSink(m_udpSocket, sampleRate, stereo);
+#ifdef AUDIONETSINK_SENDMMSG
+    m_mmsgSocket = -1;
+    memset(&m_mmsgAddress, 0, sizeof(m_mmsgAddress));
+    m_mmsgAddressLength = 0;
+    m_mmsgPort = 0;
+#endif
+    m_encoderThread = new AudioNetSinkThread(this);
+    m_encoderThread->startWork();
 }
 
 AudioNetSink::~AudioNetSink()
 {
-    if (m_rtpBufferAudio) {
+    m_encoderThread->stopWork(); // closes the sockets
+    delete m_encoderThread;
+}
+
+void AudioNetSink::openSockets()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_udpSocket = new QUdpSocket();
+
+    if (m_rtpSampleRate > 0) {
+        m_rtpBufferAudio = new RTPSink(m_udpSocket, m_rtpSampleRate, m_rtpStereo);
+    }
+}
+
+void AudioNetSink::closeSockets()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+#ifdef AUDIONETSINK_SENDMMSG
+    closeMmsgSocket();
+#endif
+
+    if (m_rtpBufferAudio)
+    {
         delete m_rtpBufferAudio;
+        m_rtpBufferAudio = 0;
     }
 
-    m_udpSocket->deleteLater(); // this thread is not the owner thread (was moved)
+    delete m_udpSocket;
+    m_udpSocket = 0;
 }
 
 bool AudioNetSink::isRTPCapable() const
@@ -77,6 +132,8 @@ bool AudioNetSink::isRTPCapable() const
 
 bool AudioNetSink::selectType(SinkType type)
 {
+    QMutexLocker mutexLocker(&m_mutex);
+
     if (type == SinkUDP)
     {
         m_type = SinkUDP;
@@ -91,6 +148,7 @@ bool AudioNetSink::selectType(SinkType type)
 
 void AudioNetSink::setDestination(const QString& address, uint16_t port)
 {
+    QMutexLocker mutexLocker(&m_mutex);
     m_address.setAddress(const_cast<QString&>(address));
     m_port = port;
 
@@ -101,6 +159,8 @@ void AudioNetSink::setDestination(const QString& address, uint16_t port)
 
 void AudioNetSink::addDestination(const QString& address, uint16_t port)
 {
+    QMutexLocker mutexLocker(&m_mutex);
+
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->addDestination(address, port);
     }
@@ -108,6 +168,8 @@ void AudioNetSink::addDestination(const QString& address, uint16_t port)
 
 void AudioNetSink::deleteDestination(const QString& address, uint16_t port)
 {
+    QMutexLocker mutexLocker(&m_mutex);
+
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->deleteDestination(address, port);
     }
@@ -120,6 +182,7 @@ void AudioNetSink::setParameters(Codec codec, bool stereo, int sampleRate)
             << " stereo: " << stereo
             << " sampleRate: " << sampleRate;
 
+    QMutexLocker mutexLocker(&m_mutex);
     m_codec = codec;
     m_stereo = stereo;
     m_sampleRate = sampleRate;
@@ -157,12 +220,200 @@ void AudioNetSink::setParameters(Codec codec, bool stereo, int sampleRate)
 
 void AudioNetSink::setDecimation(uint32_t decimation)
 {
+    QMutexLocker mutexLocker(&m_mutex);
     m_decimation = decimation < 1 ? 1 : decimation > 6 ? 6 : decimation;
     qDebug() << "AudioNetSink::setDecimation: " << m_decimation << " from: " << decimation;
     setNewCodecData();
     m_decimationCount = 0;
 }
 
+void AudioNetSink::setChannelMode(ChannelMode channelMode)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_channelMode = channelMode;
+}
+
+unsigned int AudioNetSink::push(const qint16 *frames, unsigned int nbFrames)
+{
+    return m_encoderThread->push(frames, nbFrames);
+}
+
+quint32 AudioNetSink::getNbFramesDropped() const
+{
+    return m_encoderThread->getNbFramesDropped();
+}
+
+void AudioNetSink::encode(const qint16 *frames, unsigned int nbFrames)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (unsigned int i = 0; i < nbFrames; i++)
+    {
+        qint16 sl = frames[2*i];
+        qint16 sr = frames[2*i+1];
+
+        switch (m_channelMode)
+        {
+        case ChannelStereo:
+            write(sl, sr);
+            break;
+        case ChannelMixed:
+            write(((qint32) sl + sr) / 2);
+            break;
+        case ChannelRight:
+            write(sr);
+            break;
+        case ChannelLeft:
+        default:
+            write(sl);
+            break;
+        }
+    }
+}
+
+void AudioNetSink::queueDatagram(const char *data, int size)
+{
+    if (size <= 0) {
+        return;
+    }
+
+    if (m_nbDatagrams == m_maxBatchSize) {
+        sendDatagrams();
+    }
+
+    memcpy(m_datagrams[m_nbDatagrams], data, size);
+    m_datagramSizes[m_nbDatagrams] = size;
+    m_nbDatagrams++;
+}
+
+void AudioNetSink::flush()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    sendDatagrams();
+}
+
+void AudioNetSink::sendDatagrams()
+{
+    if (m_nbDatagrams == 0) {
+        return;
+    }
+
+    int sent = 0;
+
+#ifdef AUDIONETSINK_SENDMMSG
+    if (setupMmsgDestination()) {
+        sent = sendDatagramsMmsg();
+    }
+#endif
+
+    for (int i = sent; i < m_nbDatagrams; i++) {
+        m_udpSocket->writeDatagram((const char*) m_datagrams[i], (qint64) m_datagramSizes[i], m_address, m_port);
+    }
+
+    m_nbDatagrams = 0;
+}
+
+#ifdef AUDIONETSINK_SENDMMSG
+bool AudioNetSink::setupMmsgDestination()
+{
+    if ((m_mmsgSocket >= 0) && (m_address == m_mmsgHostAddress) && (m_port == m_mmsgPort)) {
+        return true;
+    }
+
+    int previousFamily = m_mmsgAddress.ss_family;
+    memset(&m_mmsgAddress, 0, sizeof(m_mmsgAddress));
+
+    if (m_address.protocol() == QAbstractSocket::IPv4Protocol)
+    {
+        sockaddr_in *address = (sockaddr_in *) &m_mmsgAddress;
+        address->sin_family = AF_INET;
+        address->sin_port = htons(m_port);
+        address->sin_addr.s_addr = htonl(m_address.toIPv4Address());
+        m_mmsgAddressLength = sizeof(sockaddr_in);
+    }
+    else if (m_address.protocol() == QAbstractSocket::IPv6Protocol)
+    {
+        sockaddr_in6 *address = (sockaddr_in6 *) &m_mmsgAddress;
+        Q_IPV6ADDR ipv6 = m_address.toIPv6Address();
+        address->sin6_family = AF_INET6;
+        address->sin6_port = htons(m_port);
+        memcpy(&address->sin6_addr, &ipv6, sizeof(address->sin6_addr));
+        m_mmsgAddressLength = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        closeMmsgSocket();
+        return false;
+    }
+
+    if ((m_mmsgSocket >= 0) && (previousFamily != m_mmsgAddress.ss_family)) {
+        closeMmsgSocket();
+    }
+
+    if (m_mmsgSocket < 0)
+    {
+        m_mmsgSocket = ::socket(m_mmsgAddress.ss_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+        if (m_mmsgSocket < 0)
+        {
+            qWarning("AudioNetSink::setupMmsgDestination: cannot create socket: %s", strerror(errno));
+            return false;
+        }
+    }
+
+    m_mmsgHostAddress = m_address;
+    m_mmsgPort = m_port;
+    qDebug("AudioNetSink::setupMmsgDestination: %s:%u", qPrintable(m_address.toString()), m_port);
+
+    return true;
+}
+
+int AudioNetSink::sendDatagramsMmsg()
+{
+    for (int i = 0; i < m_nbDatagrams; i++)
+    {
+        m_mmsgIovecs[i].iov_base = (void *) m_datagrams[i];
+        m_mmsgIovecs[i].iov_len = m_datagramSizes[i];
+        memset(&m_mmsgHeaders[i], 0, sizeof(struct mmsghdr));
+        m_mmsgHeaders[i].msg_hdr.msg_name = (void *) &m_mmsgAddress;
+        m_mmsgHeaders[i].msg_hdr.msg_namelen = m_mmsgAddressLength;
+        m_mmsgHeaders[i].msg_hdr.msg_iov = &m_mmsgIovecs[i];
+        m_mmsgHeaders[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int sent = 0;
+
+    while (sent < m_nbDatagrams)
+    {
+        int ret = sendmmsg(m_mmsgSocket, &m_mmsgHeaders[sent], m_nbDatagrams - sent, 0);
+
+        if (ret < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            qWarning("AudioNetSink::sendDatagramsMmsg: sendmmsg failed: %s. Falling back to Qt socket", strerror(errno));
+            closeMmsgSocket();
+            break;
+        }
+
+        sent += ret;
+    }
+
+    return sent;
+}
+
+void AudioNetSink::closeMmsgSocket()
+{
+    if (m_mmsgSocket >= 0)
+    {
+        ::close(m_mmsgSocket);
+        m_mmsgSocket = -1;
+    }
+}
+#endif
+
 void AudioNetSink::setNewCodecData()
 {
     if (m_codec == CodecOpus)
@@ -231,7 +482,7 @@ void AudioNetSink::write(qint16 isample)
         {
             if (m_bufferIndex >= 2*m_udpBlockSize)
             {
-                m_udpSocket->writeDatagram((const char*) m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+                queueDatagram((const char*) m_data, m_udpBlockSize);
                 m_bufferIndex = 0;
             }
         }
@@ -239,7 +490,7 @@ void AudioNetSink::write(qint16 isample)
         {
             if (m_bufferIndex >= m_udpBlockSize)
             {
-                m_udpSocket->writeDatagram((const char*) m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+                queueDatagram((const char*) m_data, m_udpBlockSize);
                 m_bufferIndex = 0;
             }
         }
@@ -278,7 +529,7 @@ void AudioNetSink::write(qint16 isample)
             {
                 int nbBytes = m_opus.encode(m_codecInputSize, m_opusIn, (uint8_t *) m_data);
                 nbBytes = nbBytes > m_udpBlockSize ? m_udpBlockSize : nbBytes;
-                m_udpSocket->writeDatagram((const char*) m_data, (qint64 ) nbBytes, m_address, m_port);
+                queueDatagram((const char*) m_data, nbBytes);
                 m_codecInputIndex = 0;
             }
 
@@ -384,7 +635,7 @@ void AudioNetSink::write(qint16 ilSample, qint16 irSample)
     {
         if (m_bufferIndex >= m_udpBlockSize)
         {
-            m_udpSocket->writeDatagram((const char*) m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+            queueDatagram((const char*) m_data, m_udpBlockSize);
             m_bufferIndex = 0;
         }
 
@@ -400,7 +651,7 @@ void AudioNetSink::write(qint16 ilSample, qint16 irSample)
             {
                 int nbBytes = m_opus.encode(m_codecInputSize, m_opusIn, (uint8_t *) m_data);
                 nbBytes = nbBytes > m_udpBlockSize ? m_udpBlockSize : nbBytes;
-                m_udpSocket->writeDatagram((const char*) m_data, (qint64 ) nbBytes, m_address, m_port);
+                queueDatagram((const char*) m_data, nbBytes);
                 m_codecInputIndex = 0;
             }
 
@@ -476,8 +727,3 @@ void AudioNetSink::write(qint16 ilSample, qint16 irSample)
     }
 }
 
-void AudioNetSink::moveToThread(QThread *thread)
-{
-    m_udpSocket->moveToThread(thread);
-}
-
@@ -28,11 +28,17 @@
 
 #include <QObject>
 #include <QHostAddress>
+#include <QMutex>
 #include <stdint.h>
 
+#if defined(__linux__)
+#define AUDIONETSINK_SENDMMSG // send a batch of datagrams with one system call
+#include <sys/socket.h>
+#endif
+
 class QUdpSocket;
 class RTPSink;
-class QThread;
+class AudioNetSinkThread;
 
 class SDRBASE_API AudioNetSink {
 public:
@@ -52,8 +58,16 @@ public:
         CodecOpus  //!< Opus compressed 8 bit samples at 64kbits/s (8kS/s out). Various input sample rates
     } Codec;
 
-    AudioNetSink(QObject *parent); //!< without RTP
-    AudioNetSink(QObject *parent, int sampleRate, bool stereo); //!< with RTP
+    typedef enum
+    {
+        ChannelLeft,   //!< Send left channel
+        ChannelRight,  //!< Send right channel
+        ChannelMixed,  //!< Send mix of left and right channels
+        ChannelStereo  //!< Send both channels
+    } ChannelMode;
+
+    AudioNetSink(); //!< without RTP
+    AudioNetSink(int sampleRate, bool stereo); //!< with RTP
     ~AudioNetSink();
 
     void setDestination(const QString& address, uint16_t port);
@@ -61,29 +75,45 @@ public:
     void deleteDestination(const QString& address, uint16_t port);
     void setParameters(Codec codec, bool stereo, int sampleRate);
     void setDecimation(uint32_t decimation);
+    void setChannelMode(ChannelMode channelMode);
 
-    void write(qint16 sample);
-    void write(qint16 lSample, qint16 rSample);
+    unsigned int push(const qint16 *frames, unsigned int nbFrames); //!< Queue interleaved stereo frames for encoding. Only copies so that it can be called from the audio device callback
+    quint32 getNbFramesDropped() const;
 
     bool isRTPCapable() const;
     bool selectType(SinkType type);
 
-    void moveToThread(QThread *thread);
-
-    static const int m_udpBlockSize;
+    static const int m_udpBlockSize = 512;
     static const int m_dataBlockSize = 65536; // room for G722 conversion (64000 = 12800*5 largest to date)
     static const int m_g722BlockSize = 12800; // number of resulting G722 bytes (80*20ms frames)
     static const int m_opusBlockSize = 960*2; // provision for 20ms of 2 int16 channels at 48 kS/s
     static const int m_opusOutputSize = 160;  // output frame: 20ms of 8 bit data @ 64 kbits/s = 160 bytes
+    static const int m_maxBatchSize = 32;     // maximum number of UDP datagrams sent at once
 
 protected:
     void setNewCodecData();       // actions to take when changes affecting codec dependent data occurs
     void setDecimationFilters();  // set decimation filters limits depending on effective sample rate and codec
 
+    void openSockets();                                       //!< encoder thread: create the sockets so that they belong to the encoder thread
+    void closeSockets();                                      //!< encoder thread: delete the sockets
+    void encode(const qint16 *frames, unsigned int nbFrames); //!< encoder thread: encode a block of stereo frames according to channel mode
+    void flush();                                             //!< encoder thread: send the datagrams batched so far
+    void write(qint16 sample);
+    void write(qint16 lSample, qint16 rSample);
+    void queueDatagram(const char *data, int size);
+    void sendDatagrams();
+#ifdef AUDIONETSINK_SENDMMSG
+    int sendDatagramsMmsg();
+    bool setupMmsgDestination();
+    void closeMmsgSocket();
+#endif
+
     SinkType m_type;
     Codec m_codec;
-    QUdpSocket *m_udpSocket;
+    QUdpSocket *m_udpSocket;         //!< only used in the encoder thread
     RTPSink *m_rtpBufferAudio;
+    int m_rtpSampleRate;             //!< RTP session sample rate or 0 without RTP
+    bool m_rtpStereo;
     AudioCompressor m_audioCompressor;
     AudioG722 m_g722;
     AudioOpus m_opus;
@@ -100,6 +130,24 @@ protected:
     unsigned int m_bufferIndex;
     QHostAddress m_address;
     unsigned int m_port;
+    ChannelMode m_channelMode;
+    QMutex m_mutex;                  //!< settings vs encoder thread
+    AudioNetSinkThread *m_encoderThread;
+    char m_datagrams[m_maxBatchSize][m_udpBlockSize]; //!< UDP datagrams waiting to be sent
+    int m_datagramSizes[m_maxBatchSize];
+    int m_nbDatagrams;
+
+#ifdef AUDIONETSINK_SENDMMSG
+    int m_mmsgSocket;                      //!< native socket used with sendmmsg
+    sockaddr_storage m_mmsgAddress;        //!< destination
+    socklen_t m_mmsgAddressLength;
+    QHostAddress m_mmsgHostAddress;        //!< destination for which m_mmsgAddress was built
+    uint16_t m_mmsgPort;
+    struct mmsghdr m_mmsgHeaders[m_maxBatchSize];
+    struct iovec m_mmsgIovecs[m_maxBatchSize];
+#endif
+
+    friend class AudioNetSinkThread;
 };
 
 #endif /* SDRBASE_AUDIO_AUDIONETSINK_H_ */
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include <QDebug>
+
+#include "audionetsink.h"
+#include "audionetsinkthread.h"
+
+AudioNetSinkThread::AudioNetSinkThread(AudioNetSink *audioNetSink, QObject *parent) :
+    QThread(parent),
+    m_running(false),
+    m_audioNetSink(audioNetSink),
+    m_writeIndex(0),
+    m_readIndex(0),
+    m_nbFramesDropped(0)
+{
+    m_ring.resize(2*m_ringSize);
+}
+
+AudioNetSinkThread::~AudioNetSinkThread()
+{
+    if (m_running) {
+        stopWork();
+    }
+}
+
+void AudioNetSinkThread::startWork()
+{
+    qDebug("AudioNetSinkThread::startWork");
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void AudioNetSinkThread::stopWork()
+{
+    qDebug("AudioNetSinkThread::stopWork");
+    m_running = false;
+    m_dataAvailable.release(); // wake up the thread
+    wait();
+}
+
+unsigned int AudioNetSinkThread::push(const qint16 *frames, unsigned int nbFrames)
+{
+    quint32 writeIndex = m_writeIndex.loadAcquire();
+    quint32 free = m_ringSize - (writeIndex - m_readIndex.loadAcquire());
+    unsigned int count = std::min(nbFrames, (unsigned int) free);
+    unsigned int writePos = writeIndex % m_ringSize;
+    unsigned int part1 = std::min(count, m_ringSize - writePos);
+
+    memcpy(&m_ring[2*writePos], frames, part1 * 2 * sizeof(qint16));
+
+    if (count > part1) {
+        memcpy(&m_ring[0], &frames[2*part1], (count - part1) * 2 * sizeof(qint16));
+    }
+
+    m_writeIndex.storeRelease(writeIndex + count);
+
+    if (count > 0) {
+        m_dataAvailable.release();
+    }
+
+    if (count < nbFrames) {
+        m_nbFramesDropped.fetchAndAddRelaxed(nbFrames - count);
+    }
+
+    return count;
+}
+
+void AudioNetSinkThread::run()
+{
+    qDebug("AudioNetSinkThread::run: begin");
+    m_audioNetSink->openSockets(); // all socket operations are done in this thread
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        if (!m_dataAvailable.tryAcquire(1, 100)) {
+            continue;
+        }
+
+        m_dataAvailable.tryAcquire(m_dataAvailable.available()); // all blocks queued so far are taken below
+        quint32 readIndex = m_readIndex.loadAcquire();
+        unsigned int count = m_writeIndex.loadAcquire() - readIndex;
+
+        if (count == 0) {
+            continue;
+        }
+
+        unsigned int readPos = readIndex % m_ringSize;
+        unsigned int part1 = std::min(count, m_ringSize - readPos);
+
+        m_audioNetSink->encode(&m_ring[2*readPos], part1);
+
+        if (count > part1) {
+            m_audioNetSink->encode(&m_ring[0], count - part1);
+        }
+
+        m_audioNetSink->flush();
+        m_readIndex.storeRelease(readIndex + count);
+    }
+
+    m_audioNetSink->closeSockets();
+    qDebug("AudioNetSinkThread::run: end");
+}
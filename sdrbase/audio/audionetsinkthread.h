@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_AUDIO_AUDIONETSINKTHREAD_H_
+#define SDRBASE_AUDIO_AUDIONETSINKTHREAD_H_
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QSemaphore>
+#include <QAtomicInteger>
+
+#include "export.h"
+
+class AudioNetSink;
+
+/**
+ * Encoder thread of AudioNetSink. The audio device callback pushes blocks of stereo frames in
+ * a single producer single consumer lock free ring buffer with only a memcpy and wakes up this thread.
+ * This thread takes them out and has the sink encode and send them so that codec or network hiccups cannot
+ * make the audio device underrun. Frames that do not fit in the ring buffer are dropped.
+ * The sink sockets (Qt, RTP and sendmmsg) are created and deleted in this thread so that they are only
+ * used by the thread they belong to.
+ */
+class SDRBASE_API AudioNetSinkThread : public QThread {
+    Q_OBJECT
+
+public:
+    AudioNetSinkThread(AudioNetSink *audioNetSink, QObject *parent = 0);
+    ~AudioNetSinkThread();
+
+    void startWork();
+    void stopWork();
+
+    unsigned int push(const qint16 *frames, unsigned int nbFrames); //!< called from the audio device thread. Returns number of frames queued
+    quint32 getNbFramesDropped() const { return m_nbFramesDropped.loadAcquire(); }
+
+    static const unsigned int m_ringSize = 1<<16; //!< ring buffer size in stereo frames (more than a second at 48 kS/s)
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    volatile bool m_running;
+
+    AudioNetSink *m_audioNetSink;
+    std::vector<qint16> m_ring;           //!< interleaved L/R frames
+    QAtomicInteger<quint32> m_writeIndex; //!< frames written (free running) only updated by the audio thread
+    QAtomicInteger<quint32> m_readIndex;  //!< frames read (free running) only updated by this thread
+    QAtomicInteger<quint32> m_nbFramesDropped;
+    QSemaphore m_dataAvailable;           //!< released by push() for each block queued and by stopWork()
+
+    void run();
+};
+
+#endif /* SDRBASE_AUDIO_AUDIONETSINKTHREAD_H_ */
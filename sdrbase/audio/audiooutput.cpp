@@ -23,11 +23,13 @@
 #include "audiooutput.h"
 #include "audiofifo.h"
 #include "audionetsink.h"
+#include "audiooutputfile.h"
 
 AudioOutput::AudioOutput() :
 	m_mutex(QMutex::Recursive),
 	m_audioOutput(0),
 	m_audioNetSink(0),
+	m_audioOutputFile(0),
 	m_copyAudioToUdp(false),
 	m_udpChannelMode(UDPChannelLeft),
 	m_udpChannelCodec(UDPCodecL16),
@@ -112,8 +114,10 @@ bool AudioOutput::start(int device, int rate)
             return false;
         }
 
+        m_profileStage.setSampleRate(m_audioFormat.sampleRate());
         m_audioOutput = new QAudioOutput(devInfo, m_audioFormat);
-        m_audioNetSink = new AudioNetSink(0, m_audioFormat.sampleRate(), false);
+        m_audioNetSink = new AudioNetSink(m_audioFormat.sampleRate(), false);
+        m_audioNetSink->setChannelMode((AudioNetSink::ChannelMode) m_udpChannelMode);
 
         QIODevice::open(QIODevice::ReadOnly);
 
@@ -130,16 +134,68 @@ bool AudioOutput::start(int device, int rate)
 	return true;
 }
 
+bool AudioOutput::startToFile(const QString& fileName, int rate)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_audioFormat.setSampleRate(rate);
+    m_audioFormat.setChannelCount(2);
+    m_audioFormat.setSampleSize(16);
+    m_audioFormat.setCodec("audio/pcm");
+    m_audioFormat.setByteOrder(QAudioFormat::LittleEndian);
+    m_audioFormat.setSampleType(QAudioFormat::SignedInt);
+    m_profileStage.setSampleRate(rate);
+
+    m_audioOutputFile = new AudioOutputFile(this);
+
+    if (!m_audioOutputFile->open(fileName, rate))
+    {
+        delete m_audioOutputFile;
+        m_audioOutputFile = 0;
+        return false;
+    }
+
+    for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it) {
+        (*it)->setBlocking(true, m_audioOutputFile->getDataReady());
+    }
+
+    QIODevice::open(QIODevice::ReadOnly);
+    m_audioOutputFile->startWork();
+
+    return true;
+}
+
 void AudioOutput::stop()
 {
     qDebug("AudioOutput::stop");
 
+    if (m_audioOutputFile) // offline mode
+    {
+        m_audioOutputFile->stopWork(); // outside the lock as the file thread mixes under it
+        QMutexLocker mutexLocker(&m_mutex);
+
+        for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it) {
+            (*it)->setBlocking(false);
+        }
+
+        m_audioOutputFile->close();
+        delete m_audioOutputFile;
+        m_audioOutputFile = 0;
+        QIODevice::close();
+        return;
+    }
+
+    if (m_audioOutput == 0) { // not started
+        return;
+    }
+
     QMutexLocker mutexLocker(&m_mutex);
     m_audioOutput->stop();
     QIODevice::close();
     delete m_audioNetSink;
     m_audioNetSink = 0;
     delete m_audioOutput;
+    m_audioOutput = 0;
 
 //    if (m_audioUsageCount > 0)
 //    {
@@ -162,13 +218,22 @@ void AudioOutput::addFifo(AudioFifo* audioFifo)
 	QMutexLocker mutexLocker(&m_mutex);
 
 	m_audioFifos.push_back(audioFifo);
+
+	if (m_audioOutputFile) {
+		audioFifo->setBlocking(true, m_audioOutputFile->getDataReady()); // the channel waits for the file writer
+	}
 }
 
 void AudioOutput::removeFifo(AudioFifo* audioFifo)
 {
+	if (m_audioOutputFile) {
+		m_audioOutputFile->flush(); // write the end of this FIFO before it goes away
+	}
+
 	QMutexLocker mutexLocker(&m_mutex);
 
 	m_audioFifos.remove(audioFifo);
+	audioFifo->setBlocking(false);
 }
 
 /*
@@ -200,6 +265,10 @@ void AudioOutput::setUdpUseRTP(bool useRTP)
 void AudioOutput::setUdpChannelMode(UDPChannelMode udpChannelMode)
 {
     m_udpChannelMode = udpChannelMode;
+
+    if (m_audioNetSink) {
+        m_audioNetSink->setChannelMode((AudioNetSink::ChannelMode) m_udpChannelMode);
+    }
 }
 
 void AudioOutput::setUdpChannelFormat(UDPChannelCodec udpChannelCodec, bool stereo, int sampleRate)
@@ -218,6 +287,12 @@ void AudioOutput::setUdpDecimation(uint32_t decimation)
 	}
 }
 
+quint32 AudioOutput::getUdpNbFramesDropped()
+{
+	QMutexLocker mutexLocker(&m_mutex); // the sink is deleted when the output stops
+	return m_audioNetSink ? m_audioNetSink->getNbFramesDropped() : 0;
+}
+
 qint64 AudioOutput::readData(char* data, qint64 maxLen)
 {
     //qDebug("AudioOutput::readData: %lld", maxLen);
@@ -245,12 +320,19 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 		}
 	}
 
+	qint64 start = DSPProfileStage::now();
+	unsigned int fillMax = 0;
+
 	memset(&m_mixBuffer[0], 0x00, 2 * samplesPerBuffer * sizeof(m_mixBuffer[0])); // start with silence
 
 	// sum up a block from all fifos
 
 	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
 	{
+		if ((*it)->fill() > fillMax) {
+			fillMax = (*it)->fill();
+		}
+
 		// use outputBuffer as temp - yes, one memcpy could be saved
 		unsigned int samples = (*it)->read((quint8*) data, samplesPerBuffer);
 		const qint16* src = (const qint16*) data;
@@ -310,31 +392,55 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 		}
 
 		*dst++ = sr;
+	}
 
-		if ((m_copyAudioToUdp) && (m_audioNetSink))
-		{
-	        switch (m_udpChannelMode)
-	        {
-            case UDPChannelStereo:
-                m_audioNetSink->write(sl, sr);
-                break;
-            case UDPChannelMixed:
-                m_audioNetSink->write((sl+sr)/2);
-                break;
-            case UDPChannelRight:
-                m_audioNetSink->write(sr);
-                break;
-	        case UDPChannelLeft:
-	        default:
-	            m_audioNetSink->write(sl);
-	            break;
-	        }
-		}
+	// encoding and sending is done in the network sink own thread
+	if ((m_copyAudioToUdp) && (m_audioNetSink)) {
+		m_audioNetSink->push((const qint16*) data, samplesPerBuffer);
 	}
 
+	// audio still to be played is in the fullest FIFO and in the audio device buffer
+	m_profileStage.recordFill(fillMax + (m_audioOutput ? (m_audioOutput->bufferSize() - m_audioOutput->bytesFree()) / 4 : 0));
+	m_profileStage.record(DSPProfileStage::now() - start, samplesPerBuffer);
+
 	return samplesPerBuffer * 4;
 }
 
+/**
+ * Offline mode. Only frames present in all the FIFOs are mixed so that the channels stay in step.
+ * A FIFO that lags behind (e.g. its channel does not write audio at all) is padded with silence
+ * as soon as another FIFO is half full, or at once when flushing, so that nobody waits forever.
+ */
+unsigned int AudioOutput::mixFifos(qint16* data, unsigned int maxFrames, bool flush)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (m_audioFifos.size() == 0) {
+		return 0;
+	}
+
+	unsigned int fillMin = (*m_audioFifos.begin())->fill();
+	unsigned int fillMax = 0;
+	bool halfFull = false;
+
+	for (std::list<AudioFifo*>::const_iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
+	{
+		unsigned int fill = (*it)->fill();
+		fillMin = fill < fillMin ? fill : fillMin;
+		fillMax = fill > fillMax ? fill : fillMax;
+		halfFull = halfFull || (fill >= (*it)->size() / 2);
+	}
+
+	unsigned int nbFrames = (flush || halfFull) ? fillMax : fillMin;
+	nbFrames = nbFrames < maxFrames ? nbFrames : maxFrames;
+
+	if (nbFrames == 0) {
+		return 0;
+	}
+
+	return readData((char *) data, nbFrames * 4) / 4;
+}
+
 qint64 AudioOutput::writeData(const char* data, qint64 len)
 {
 	Q_UNUSED(data);
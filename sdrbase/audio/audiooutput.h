@@ -25,12 +25,14 @@
 #include <list>
 #include <vector>
 #include <stdint.h>
+#include "dsp/dspprofile.h"
 #include "export.h"
 
 class QAudioOutput;
 class AudioFifo;
 class AudioOutputPipe;
 class AudioNetSink;
+class AudioOutputFile;
 
 class SDRBASE_API AudioOutput : QIODevice {
 public:
@@ -56,6 +58,7 @@ public:
 	virtual ~AudioOutput();
 
 	bool start(int device, int rate);
+	bool startToFile(const QString& fileName, int rate); //!< offline mode: write the mixed audio in a WAV file instead of playing it
 	void stop();
 
 	void addFifo(AudioFifo* audioFifo);
@@ -71,11 +74,15 @@ public:
 	void setUdpChannelMode(UDPChannelMode udpChannelMode);
 	void setUdpChannelFormat(UDPChannelCodec udpChannelCodec, bool stereo, int sampleRate);
 	void setUdpDecimation(uint32_t decimation);
+	quint32 getUdpNbFramesDropped(); //!< frames the copy to UDP could not queue since it was started
+
+	DSPProfileStage& getProfileStage() { return m_profileStage; } //!< mixing time and audio queued ahead of the output
 
 private:
 	QMutex m_mutex;
 	QAudioOutput* m_audioOutput;
 	AudioNetSink* m_audioNetSink;
+	AudioOutputFile* m_audioOutputFile; //!< replaces the audio device in offline mode
 	bool m_copyAudioToUdp;
 	UDPChannelMode m_udpChannelMode;
 	UDPChannelCodec m_udpChannelCodec;
@@ -86,12 +93,15 @@ private:
 	std::vector<qint32> m_mixBuffer;
 
 	QAudioFormat m_audioFormat;
+	DSPProfileStage m_profileStage;
 
 	//virtual bool open(OpenMode mode);
 	virtual qint64 readData(char* data, qint64 maxLen);
 	virtual qint64 writeData(const char* data, qint64 len);
+	unsigned int mixFifos(qint16* data, unsigned int maxFrames, bool flush); //!< offline mode: mix what can be taken from the FIFOs
 
 	friend class AudioOutputPipe;
+	friend class AudioOutputFile;
 };
 
 #endif // INCLUDE_AUDIOOUTPUT_H
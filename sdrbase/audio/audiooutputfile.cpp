@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QDebug>
+#include <QDataStream>
+#include <QtEndian>
+
+#include "audiooutput.h"
+#include "audiooutputfile.h"
+
+AudioOutputFile::AudioOutputFile(AudioOutput *audioOutput, QObject *parent) :
+    QThread(parent),
+    m_running(false),
+    m_audioOutput(audioOutput),
+    m_nbFrames(0)
+{
+    m_buffer.resize(2*m_bufferFrames);
+}
+
+AudioOutputFile::~AudioOutputFile()
+{
+    if (m_running) {
+        stopWork();
+    }
+
+    close();
+}
+
+bool AudioOutputFile::open(const QString& fileName, int sampleRate)
+{
+    QMutexLocker mutexLocker(&m_fileMutex);
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("AudioOutputFile::open: cannot open %s: %s", qPrintable(fileName), qPrintable(m_file.errorString()));
+        return false;
+    }
+
+    m_nbFrames = 0;
+    writeHeader(sampleRate, 0); // sizes are patched on close
+    qInfo("AudioOutputFile::open: writing %d S/s audio to %s", sampleRate, qPrintable(fileName));
+
+    return true;
+}
+
+void AudioOutputFile::close()
+{
+    QMutexLocker mutexLocker(&m_fileMutex);
+
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    m_file.seek(0);
+    writeHeader(m_audioOutput->getRate(), m_nbFrames * 4);
+    m_file.close();
+    qInfo("AudioOutputFile::close: %s: %llu frames written", qPrintable(m_file.fileName()), m_nbFrames);
+}
+
+void AudioOutputFile::startWork()
+{
+    qDebug("AudioOutputFile::startWork");
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void AudioOutputFile::stopWork()
+{
+    qDebug("AudioOutputFile::stopWork");
+    m_running = false;
+    m_dataReady.release();
+    wait();
+    flush();
+}
+
+void AudioOutputFile::flush()
+{
+    // bounded as other channels may keep writing meanwhile. Audio FIFOs are much smaller than this
+    for (int i = 0; i < 64; i++)
+    {
+        if (writeMix(true) == 0) {
+            break;
+        }
+    }
+}
+
+unsigned int AudioOutputFile::writeMix(bool flush)
+{
+    QMutexLocker mutexLocker(&m_fileMutex);
+
+    if (!m_file.isOpen()) {
+        return 0;
+    }
+
+    unsigned int nbFrames = m_audioOutput->mixFifos(&m_buffer[0], m_bufferFrames, flush);
+
+    if (nbFrames > 0)
+    {
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+        for (unsigned int i = 0; i < 2*nbFrames; i++) {
+            m_buffer[i] = qToLittleEndian(m_buffer[i]);
+        }
+#endif
+        m_file.write((const char *) &m_buffer[0], nbFrames * 4);
+        m_nbFrames += nbFrames;
+    }
+
+    return nbFrames;
+}
+
+void AudioOutputFile::writeHeader(int sampleRate, quint32 dataSize)
+{
+    QDataStream stream(&m_file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream.writeRawData("RIFF", 4);
+    stream << (quint32) (36 + dataSize);
+    stream.writeRawData("WAVE", 4);
+    stream.writeRawData("fmt ", 4);
+    stream << (quint32) 16;             // fmt chunk size
+    stream << (quint16) 1;              // PCM
+    stream << (quint16) 2;              // stereo
+    stream << (quint32) sampleRate;
+    stream << (quint32) (sampleRate*4); // byte rate
+    stream << (quint16) 4;              // block align
+    stream << (quint16) 16;             // bits per sample
+    stream.writeRawData("data", 4);
+    stream << dataSize;
+}
+
+void AudioOutputFile::run()
+{
+    qDebug("AudioOutputFile::run: begin");
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        if (writeMix(false) == 0) {
+            m_dataReady.tryAcquire(1, 100); // until the next FIFO write
+        } else {
+            m_dataReady.tryAcquire(m_dataReady.available()); // what was written so far has just been mixed
+        }
+    }
+
+    qDebug("AudioOutputFile::run: end");
+}
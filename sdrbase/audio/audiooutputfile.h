@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_AUDIO_AUDIOOUTPUTFILE_H_
+#define SDRBASE_AUDIO_AUDIOOUTPUTFILE_H_
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QSemaphore>
+#include <QFile>
+
+#include "export.h"
+
+class AudioOutput;
+
+/**
+ * Used by AudioOutput in offline mode in place of the audio device. This thread mixes the audio
+ * FIFOs of the output as soon as the channels have written in them and appends the result to
+ * a 16 bit stereo WAV file. The FIFOs are made blocking so that the channels are slowed down
+ * to the pace at which the file is written rather than dropping audio samples.
+ */
+class SDRBASE_API AudioOutputFile : public QThread {
+    Q_OBJECT
+
+public:
+    AudioOutputFile(AudioOutput *audioOutput, QObject *parent = 0);
+    ~AudioOutputFile();
+
+    bool open(const QString& fileName, int sampleRate); //!< create the file and write the WAV header
+    void close();                                       //!< patch the WAV header with the final sizes and close the file
+
+    void startWork();
+    void stopWork();
+
+    void flush(); //!< write all that is left in the FIFOs regardless of their alignment. Called when a FIFO is removed
+    quint64 getNbFrames() const { return m_nbFrames; }
+    QSemaphore *getDataReady() { return &m_dataReady; } //!< given to the blocking FIFOs to wake up this thread when they are written
+
+    static const unsigned int m_bufferFrames = 4800; //!< mixing block size in stereo frames
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    volatile bool m_running;
+    QSemaphore m_dataReady; //!< released by the FIFO writes
+
+    AudioOutput *m_audioOutput;
+    QMutex m_fileMutex; //!< serializes the file writes of this thread and of flush()
+    QFile m_file;
+    quint64 m_nbFrames; //!< stereo frames written to the file
+    std::vector<qint16> m_buffer;
+
+    unsigned int writeMix(bool flush);
+    void writeHeader(int sampleRate, quint32 dataSize);
+    void run();
+};
+
+#endif /* SDRBASE_AUDIO_AUDIOOUTPUTFILE_H_ */
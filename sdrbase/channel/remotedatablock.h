@@ -31,7 +31,9 @@
 #include <QString>
 #include "dsp/dsptypes.h"
 
-#define UDPSINKFEC_UDPSIZE 512
+#ifndef UDPSINKFEC_UDPSIZE
+#define UDPSINKFEC_UDPSIZE 512 // may be set at build time (REMOTE_UDP_SIZE) up to 9000 for jumbo frames on LANs
+#endif
 #define UDPSINKFEC_NBORIGINALBLOCKS 128
 //#define UDPSINKFEC_NBTXBLOCKS 8
 
@@ -98,6 +100,9 @@ static const int RemoteUdpSize = UDPSINKFEC_UDPSIZE;
 static const int RemoteNbOrginalBlocks = UDPSINKFEC_NBORIGINALBLOCKS;
 static const int RemoteNbBytesPerBlock = UDPSINKFEC_UDPSIZE - sizeof(RemoteHeader);
 
+static_assert((UDPSINKFEC_UDPSIZE >= 512) && (UDPSINKFEC_UDPSIZE <= 9000), "UDP datagram size must be between 512 and 9000 bytes");
+static_assert(RemoteNbBytesPerBlock % 8 == 0, "UDP block payload must hold a whole number of 24 bit I/Q samples");
+
 struct RemoteProtectedBlock
 {
     uint8_t buf[RemoteNbBytesPerBlock];
@@ -16,68 +16,492 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QGlobalStatic>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
+#include <QSettings>
+#include <QDebug>
 
 #include "plugin/pluginmanager.h"
 #include "deviceenumerator.h"
 
+/** Enumeration of one plugin shared between the enumerator and the pool thread running it */
+struct DeviceEnumerator::EnumerationResult
+{
+    PluginInterface *m_plugin;
+    bool m_rxElseTx;
+    QString m_group;
+    PluginInterface::SamplingDevices m_devices;
+    QSemaphore m_done;
+    QAtomicInt m_finished;
+
+    EnumerationResult(PluginInterface *plugin, bool rxElseTx, const QString& group) :
+        m_plugin(plugin),
+        m_rxElseTx(rxElseTx),
+        m_group(group),
+        m_finished(0)
+    {}
+};
+
+/** Enumerates the plugins of one hardware group one after the other under the group lock */
+class DeviceEnumerator::EnumerationTask : public QRunnable
+{
+public:
+    EnumerationTask(const QList<QSharedPointer<EnumerationResult> >& results, const QSharedPointer<QMutex>& lock) :
+        m_results(results),
+        m_lock(lock)
+    {}
+
+    virtual void run()
+    {
+        for (int i = 0; i < m_results.size(); i++)
+        {
+            EnumerationResult *result = m_results[i].data();
+            m_lock->lock();
+            result->m_devices = result->m_rxElseTx ? result->m_plugin->enumSampleSources() : result->m_plugin->enumSampleSinks();
+            m_lock->unlock();
+            result->m_finished.store(1);
+            result->m_done.release();
+        }
+    }
+
+private:
+    QList<QSharedPointer<EnumerationResult> > m_results;
+    QSharedPointer<QMutex> m_lock;
+};
+
+/** Runs the Rx then the Tx enumerations. The input and output plugins of the same hardware are also kept apart by the group lock */
+class DeviceEnumerator::RescanTask : public QRunnable
+{
+public:
+    RescanTask(
+            DeviceEnumerator *enumerator,
+            const PluginAPI::SamplingDeviceRegistrations& rxRegistrations,
+            const PluginAPI::SamplingDeviceRegistrations& txRegistrations,
+            const DevicesEnumeration& rxPrevious,
+            const DevicesEnumeration& txPrevious) :
+        m_enumerator(enumerator),
+        m_rxRegistrations(rxRegistrations),
+        m_txRegistrations(txRegistrations),
+        m_rxPrevious(rxPrevious),
+        m_txPrevious(txPrevious)
+    {}
+
+    virtual void run()
+    {
+        DevicesEnumeration rxEnumeration, txEnumeration;
+        m_enumerator->enumerateDevices(m_rxRegistrations, true, m_rxPrevious, rxEnumeration);
+        m_enumerator->enumerateDevices(m_txRegistrations, false, m_txPrevious, txEnumeration);
+        m_enumerator->m_mutex.lock();
+        m_enumerator->m_rescanRxEnumeration.swap(rxEnumeration);
+        m_enumerator->m_rescanTxEnumeration.swap(txEnumeration);
+        m_enumerator->m_mutex.unlock();
+        m_enumerator->m_rescanDone.release();
+        QMetaObject::invokeMethod(m_enumerator, "rescanFinished", Qt::QueuedConnection);
+    }
+
+private:
+    DeviceEnumerator *m_enumerator;
+    PluginAPI::SamplingDeviceRegistrations m_rxRegistrations;
+    PluginAPI::SamplingDeviceRegistrations m_txRegistrations;
+    DevicesEnumeration m_rxPrevious;
+    DevicesEnumeration m_txPrevious;
+};
+
 Q_GLOBAL_STATIC(DeviceEnumerator, deviceEnumerator)
 DeviceEnumerator *DeviceEnumerator::instance()
 {
     return deviceEnumerator;
 }
 
-DeviceEnumerator::DeviceEnumerator()
+DeviceEnumerator::DeviceEnumerator() :
+    m_rescanning(false),
+    m_pluginTimeout(10000),
+    m_threadPool(new QThreadPool())
 {}
 
 DeviceEnumerator::~DeviceEnumerator()
-{}
+{
+    if (m_rescanning) {
+        m_rescanDone.tryAcquire(1, 2*m_pluginTimeout + 1000);
+    }
+
+    bool late = false;
+
+    for (int i = 0; i < m_lateEnumerations.size(); i++) {
+        late = late || (m_lateEnumerations[i]->m_finished.load() == 0);
+    }
+
+    // a plugin stuck in its enumeration would block the thread pool destructor
+    if (late) {
+        qWarning("DeviceEnumerator::~DeviceEnumerator: device enumerations still running. Leaving thread pool.");
+    } else {
+        delete m_threadPool;
+    }
+}
 
 void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
 {
-    m_rxEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& rxDeviceRegistrations = pluginManager->getSourceDeviceRegistrations();
-    int index = 0;
+    DevicesEnumeration enumeration;
+    enumerateDevices(pluginManager->getSourceDeviceRegistrations(), true, m_rxEnumeration, enumeration);
+    m_rxEnumeration.swap(enumeration);
+}
+
+void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+{
+    DevicesEnumeration enumeration;
+    enumerateDevices(pluginManager->getSinkDeviceRegistrations(), false, m_txEnumeration, enumeration);
+    m_txEnumeration.swap(enumeration);
+}
+
+void DeviceEnumerator::enumerateDevices(
+        const PluginAPI::SamplingDeviceRegistrations& registrations,
+        bool rxElseTx,
+        const DevicesEnumeration& previous,
+        DevicesEnumeration& enumeration)
+{
+    QList<QSharedPointer<EnumerationResult> > results;
+    QElapsedTimer timer;
+    timer.start();
+
+    m_mutex.lock();
+
+    for (int i = 0; i < m_lateEnumerations.size();)
+    {
+        if (m_lateEnumerations[i]->m_finished.load() != 0) {
+            m_lateEnumerations.removeAt(i);
+        } else {
+            i++;
+        }
+    }
+
+    QMap<QString, QList<QSharedPointer<EnumerationResult> > > groups;
+    std::vector<int> ranks; // position of each plugin in its group
 
-    for (int i = 0; i < rxDeviceRegistrations.count(); i++)
+    for (int i = 0; i < registrations.count(); i++)
     {
-        PluginInterface::SamplingDevices samplingDevices = rxDeviceRegistrations[i].m_plugin->enumSampleSources();
+        QString group = getHardwareGroup(registrations[i].m_deviceId);
+        bool busy = false;
 
-        for (int j = 0; j < samplingDevices.count(); j++)
+        // a plugin of the group stuck in a previous enumeration still holds the group lock
+        for (int j = 0; j < m_lateEnumerations.size(); j++)
         {
-            m_rxEnumeration.push_back(
-                DeviceEnumeration(
-                    samplingDevices[j],
-                    rxDeviceRegistrations[i].m_plugin,
-                    index
-                )
-            );
-            index++;
+            if (m_lateEnumerations[j]->m_group == group) {
+                busy = true;
+            }
+        }
+
+        if (busy)
+        {
+            qWarning() << "DeviceEnumerator::enumerateDevices: previous enumeration still running for" << group << "skipping" << registrations[i].m_deviceId;
+            results.append(QSharedPointer<EnumerationResult>());
+            ranks.push_back(0);
+        }
+        else
+        {
+            QSharedPointer<EnumerationResult> result(new EnumerationResult(registrations[i].m_plugin, rxElseTx, group));
+            results.append(result);
+            ranks.push_back(groups[group].size());
+            groups[group].append(result);
+        }
+    }
+
+    // groups run at the same time even if some threads are still stuck in a previous enumeration
+    m_threadPool->setMaxThreadCount(m_threadPool->activeThreadCount() + groups.size() + 1);
+
+    for (QMap<QString, QList<QSharedPointer<EnumerationResult> > >::const_iterator it = groups.begin(); it != groups.end(); ++it) {
+        m_threadPool->start(new EnumerationTask(it.value(), getHardwareLock(it.key())));
+    }
+
+    m_mutex.unlock();
+
+    // keep the registrations order so that the list does not depend on the plugins timing
+    for (int i = 0; i < registrations.count(); i++)
+    {
+        // each plugin is given m_pluginTimeout after the ones before it in its group
+        int remaining = (ranks[i] + 1) * m_pluginTimeout - (int) timer.elapsed();
+
+        if (results[i] && results[i]->m_done.tryAcquire(1, remaining < 0 ? 0 : remaining))
+        {
+            for (int j = 0; j < results[i]->m_devices.count(); j++)
+            {
+                enumeration.push_back(
+                    DeviceEnumeration(
+                        results[i]->m_devices[j],
+                        registrations[i].m_plugin,
+                        enumeration.size()
+                    )
+                );
+            }
+        }
+        else
+        {
+            if (results[i])
+            {
+                qWarning() << "DeviceEnumerator::enumerateDevices: timeout on" << registrations[i].m_deviceId << "keeping previous devices";
+                m_mutex.lock();
+                m_lateEnumerations.append(results[i]);
+                m_mutex.unlock();
+            }
+
+            for (DevicesEnumeration::const_iterator it = previous.begin(); it != previous.end(); ++it)
+            {
+                if (it->m_pluginInterface == registrations[i].m_plugin) {
+                    enumeration.push_back(DeviceEnumeration(it->m_samplingDevice, it->m_pluginInterface, enumeration.size()));
+                }
+            }
         }
     }
+
+    qDebug("DeviceEnumerator::enumerateDevices: %s: %d devices from %d plugins in %lld ms",
+        rxElseTx ? "Rx" : "Tx", (int) enumeration.size(), registrations.count(), (long long) timer.elapsed());
 }
 
-void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+void DeviceEnumerator::rescan(PluginManager *pluginManager)
+{
+    if (m_rescanning) {
+        return;
+    }
+
+    m_rescanning = true;
+    m_threadPool->start(new RescanTask(
+        this,
+        pluginManager->getSourceDeviceRegistrations(),
+        pluginManager->getSinkDeviceRegistrations(),
+        m_rxEnumeration,
+        m_txEnumeration
+    ));
+}
+
+void DeviceEnumerator::rescanFinished()
+{
+    if (!m_rescanning || !m_rescanDone.tryAcquire()) {
+        return;
+    }
+
+    DevicesEnumeration rxEnumeration, txEnumeration;
+
+    m_mutex.lock();
+    rxEnumeration.swap(m_rescanRxEnumeration);
+    txEnumeration.swap(m_rescanTxEnumeration);
+    m_mutex.unlock();
+    m_rescanning = false;
+
+    mergeClaimed(m_rxEnumeration, rxEnumeration);
+    mergeClaimed(m_txEnumeration, txEnumeration);
+
+    if (sameDevices(m_rxEnumeration, rxEnumeration) && sameDevices(m_txEnumeration, txEnumeration))
+    {
+        qDebug("DeviceEnumerator::rescanFinished: no change");
+        return;
+    }
+
+    m_rxEnumeration.swap(rxEnumeration);
+    m_txEnumeration.swap(txEnumeration);
+    saveCache();
+    qInfo("DeviceEnumerator::rescanFinished: devices list changed: %d Rx %d Tx", (int) m_rxEnumeration.size(), (int) m_txEnumeration.size());
+    emit deviceListChanged();
+}
+
+/** Plugins sharing a vendor library or hardware: the input and output plugins of the same hardware and
+ * SoapySDR that loads the vendor modules of LimeSDR, PlutoSDR and XTRX */
+QString DeviceEnumerator::getHardwareGroup(const QString& deviceId)
+{
+    QString group = deviceId.section('.', -1); // e.g. sdrangel.samplesource.bladerf2input
+
+    if (group.endsWith("input")) {
+        group.chop(5);
+    } else if (group.endsWith("output")) {
+        group.chop(6);
+    }
+
+    if ((group == "limesdr") || (group == "plutosdr") || (group == "xtrx")) {
+        group = "soapysdr";
+    }
+
+    return group;
+}
+
+/** To be called with m_mutex held */
+QSharedPointer<QMutex> DeviceEnumerator::getHardwareLock(const QString& group)
+{
+    if (!m_hardwareLocks.contains(group)) {
+        m_hardwareLocks.insert(group, QSharedPointer<QMutex>(new QMutex()));
+    }
+
+    return m_hardwareLocks[group];
+}
+
+DeviceEnumerator::HardwareLocker::HardwareLocker(const QString& deviceId)
+{
+    DeviceEnumerator *enumerator = DeviceEnumerator::instance();
+    enumerator->m_mutex.lock();
+    QSharedPointer<QMutex> lock = enumerator->getHardwareLock(getHardwareGroup(deviceId));
+    enumerator->m_mutex.unlock();
+
+    if (lock->tryLock(enumerator->getPluginTimeout())) {
+        m_lock = lock;
+    } else {
+        qWarning() << "DeviceEnumerator::HardwareLocker: enumeration of" << deviceId << "does not finish. Opening it anyway";
+    }
+}
+
+DeviceEnumerator::HardwareLocker::~HardwareLocker()
+{
+    unlock();
+}
+
+void DeviceEnumerator::HardwareLocker::unlock()
+{
+    if (m_lock)
+    {
+        m_lock->unlock();
+        m_lock.clear();
+    }
+}
+
+/** Devices in use keep their claim and stay in the list even if the rescan did not find them */
+void DeviceEnumerator::mergeClaimed(const DevicesEnumeration& current, DevicesEnumeration& enumeration)
+{
+    for (DevicesEnumeration::const_iterator it = current.begin(); it != current.end(); ++it)
+    {
+        if (it->m_samplingDevice.claimed < 0) {
+            continue;
+        }
+
+        int index = getSamplingDeviceIndex(enumeration, it->m_samplingDevice.id, it->m_samplingDevice.sequence, it->m_samplingDevice.deviceItemIndex);
+
+        if (index < 0) {
+            enumeration.push_back(DeviceEnumeration(it->m_samplingDevice, it->m_pluginInterface, enumeration.size()));
+        } else {
+            enumeration[index].m_samplingDevice.claimed = it->m_samplingDevice.claimed;
+        }
+    }
+}
+
+bool DeviceEnumerator::sameDevices(const DevicesEnumeration& a, const DevicesEnumeration& b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < a.size(); i++)
+    {
+        const PluginInterface::SamplingDevice& da = a[i].m_samplingDevice;
+        const PluginInterface::SamplingDevice& db = b[i].m_samplingDevice;
+
+        if ((a[i].m_pluginInterface != b[i].m_pluginInterface)
+            || (da.displayedName != db.displayedName)
+            || (da.hardwareId != db.hardwareId)
+            || (da.id != db.id)
+            || (da.serial != db.serial)
+            || (da.sequence != db.sequence)
+            || (da.deviceNbItems != db.deviceNbItems)
+            || (da.deviceItemIndex != db.deviceItemIndex)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DeviceEnumerator::loadCache(PluginManager *pluginManager)
+{
+    QSettings s;
+    DevicesEnumeration rxEnumeration, txEnumeration;
+
+    s.beginGroup("deviceEnumeration");
+    loadEnumeration(s, pluginManager->getSourceDeviceRegistrations(), "rx", rxEnumeration);
+    loadEnumeration(s, pluginManager->getSinkDeviceRegistrations(), "tx", txEnumeration);
+    s.endGroup();
+
+    if (rxEnumeration.size() == 0) {
+        return false;
+    }
+
+    m_rxEnumeration.swap(rxEnumeration);
+    m_txEnumeration.swap(txEnumeration);
+    qDebug("DeviceEnumerator::loadCache: %d Rx %d Tx devices", (int) m_rxEnumeration.size(), (int) m_txEnumeration.size());
+    return true;
+}
+
+void DeviceEnumerator::saveCache() const
 {
-    m_txEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& txDeviceRegistrations = pluginManager->getSinkDeviceRegistrations();
-    int index = 0;
+    QSettings s;
 
-    for (int i = 0; i < txDeviceRegistrations.count(); i++)
+    s.beginGroup("deviceEnumeration");
+    saveEnumeration(s, m_rxEnumeration, "rx");
+    saveEnumeration(s, m_txEnumeration, "tx");
+    s.endGroup();
+}
+
+void DeviceEnumerator::saveEnumeration(QSettings& s, const DevicesEnumeration& enumeration, const QString& arrayName)
+{
+    s.remove(arrayName);
+    s.beginWriteArray(arrayName, enumeration.size());
+
+    for (unsigned int i = 0; i < enumeration.size(); i++)
     {
-        PluginInterface::SamplingDevices samplingDevices = txDeviceRegistrations[i].m_plugin->enumSampleSinks();
+        const PluginInterface::SamplingDevice& samplingDevice = enumeration[i].m_samplingDevice;
+        s.setArrayIndex(i);
+        s.setValue("displayedName", samplingDevice.displayedName);
+        s.setValue("hardwareId", samplingDevice.hardwareId);
+        s.setValue("id", samplingDevice.id);
+        s.setValue("serial", samplingDevice.serial);
+        s.setValue("sequence", samplingDevice.sequence);
+        s.setValue("type", (int) samplingDevice.type);
+        s.setValue("deviceNbItems", samplingDevice.deviceNbItems);
+        s.setValue("deviceItemIndex", samplingDevice.deviceItemIndex);
+    }
 
-        for (int j = 0; j < samplingDevices.count(); j++)
+    s.endArray();
+}
+
+void DeviceEnumerator::loadEnumeration(
+        QSettings& s,
+        const PluginAPI::SamplingDeviceRegistrations& registrations,
+        const QString& arrayName,
+        DevicesEnumeration& enumeration)
+{
+    int size = s.beginReadArray(arrayName);
+
+    for (int i = 0; i < size; i++)
+    {
+        s.setArrayIndex(i);
+        QString id = s.value("id").toString();
+        PluginInterface *plugin = 0;
+
+        for (int j = 0; j < registrations.count(); j++)
         {
-            m_txEnumeration.push_back(
-                DeviceEnumeration(
-                    samplingDevices[j],
-                    txDeviceRegistrations[i].m_plugin,
-                    index
-                )
-            );
-            index++;
+            if (registrations[j].m_deviceId == id) {
+                plugin = registrations[j].m_plugin;
+            }
+        }
+
+        if (!plugin) { // plugin not loaded this time
+            continue;
         }
+
+        enumeration.push_back(
+            DeviceEnumeration(
+                PluginInterface::SamplingDevice(
+                    s.value("displayedName").toString(),
+                    s.value("hardwareId").toString(),
+                    id,
+                    s.value("serial").toString(),
+                    s.value("sequence").toInt(),
+                    (PluginInterface::SamplingDevice::SamplingDeviceType) s.value("type").toInt(),
+                    arrayName == "rx",
+                    s.value("deviceNbItems").toInt(),
+                    s.value("deviceItemIndex").toInt()
+                ),
+                plugin,
+                enumeration.size()
+            )
+        );
     }
+
+    s.endArray();
 }
 
 void DeviceEnumerator::listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const
@@ -198,3 +622,26 @@ int DeviceEnumerator::getTxSamplingDeviceIndex(const QString& deviceId, int sequ
     return -1;
 }
 
+int DeviceEnumerator::getRxSamplingDeviceIndex(const QString& deviceId, int sequence, int deviceItemIndex)
+{
+    return getSamplingDeviceIndex(m_rxEnumeration, deviceId, sequence, deviceItemIndex);
+}
+
+int DeviceEnumerator::getTxSamplingDeviceIndex(const QString& deviceId, int sequence, int deviceItemIndex)
+{
+    return getSamplingDeviceIndex(m_txEnumeration, deviceId, sequence, deviceItemIndex);
+}
+
+int DeviceEnumerator::getSamplingDeviceIndex(const DevicesEnumeration& enumeration, const QString& deviceId, int sequence, int deviceItemIndex)
+{
+    for (DevicesEnumeration::const_iterator it = enumeration.begin(); it != enumeration.end(); ++it)
+    {
+        if ((it->m_samplingDevice.id == deviceId)
+            && (it->m_samplingDevice.sequence == sequence)
+            && (it->m_samplingDevice.deviceItemIndex == deviceItemIndex)) {
+            return it->m_index;
+        }
+    }
+
+    return -1;
+}
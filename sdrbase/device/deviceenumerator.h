@@ -20,21 +20,59 @@
 
 #include <vector>
 
+#include <QObject>
+#include <QMutex>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QMap>
+
 #include "plugin/plugininterface.h"
+#include "plugin/pluginapi.h"
 #include "export.h"
 
 class PluginManager;
+class QThreadPool;
+class QSettings;
 
-class SDRBASE_API DeviceEnumerator
+/**
+ * Sampling devices enumeration. The plugins are asked for their devices concurrently
+ * on a thread pool with a timeout per plugin. The last enumeration is saved in the
+ * settings so that it can be restored at startup and refreshed by an asynchronous
+ * rescan. deviceListChanged() is emitted when a rescan changes the list.
+ * The plugins open the hardware to probe it. The plugins sharing a vendor library or
+ * hardware are probed one after the other under a lock of their hardware group and the
+ * device sets take the same lock with HardwareLocker while they open a device so that
+ * a rescan never probes the hardware being opened.
+ */
+class SDRBASE_API DeviceEnumerator : public QObject
 {
+    Q_OBJECT
 public:
     DeviceEnumerator();
     ~DeviceEnumerator();
 
     static DeviceEnumerator *instance();
 
-    void enumerateRxDevices(PluginManager *pluginManager);
-    void enumerateTxDevices(PluginManager *pluginManager);
+    /** Holds the hardware group lock of a device while it is opened. Gives up after the plugin timeout */
+    class SDRBASE_API HardwareLocker
+    {
+    public:
+        HardwareLocker(const QString& deviceId); //!< device type id of the plugin
+        ~HardwareLocker();
+        void unlock();
+
+    private:
+        QSharedPointer<QMutex> m_lock; //!< null when not locked
+    };
+
+    void enumerateRxDevices(PluginManager *pluginManager); //!< blocking enumeration of Rx devices
+    void enumerateTxDevices(PluginManager *pluginManager); //!< blocking enumeration of Tx devices
+    void rescan(PluginManager *pluginManager);             //!< asynchronous enumeration of all devices
+    bool isRescanning() const { return m_rescanning; }
+    bool loadCache(PluginManager *pluginManager);          //!< restore last enumeration from the settings. False if there is none
+    void saveCache() const;                                //!< save current enumeration to the settings
+    void setPluginTimeout(int msecs) { m_pluginTimeout = msecs; }
+    int getPluginTimeout() const { return m_pluginTimeout; }
     void listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void listTxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void changeRxSelection(int tabIndex, int deviceIndex);
@@ -51,6 +89,14 @@ public:
     int getFileSinkDeviceIndex() const;
     int getRxSamplingDeviceIndex(const QString& deviceId, int sequence);
     int getTxSamplingDeviceIndex(const QString& deviceId, int sequence);
+    int getRxSamplingDeviceIndex(const QString& deviceId, int sequence, int deviceItemIndex);
+    int getTxSamplingDeviceIndex(const QString& deviceId, int sequence, int deviceItemIndex);
+
+signals:
+    void deviceListChanged(); //!< emitted when a rescan has changed the Rx or Tx devices list
+
+private slots:
+    void rescanFinished();
 
 private:
     struct DeviceEnumeration
@@ -68,8 +114,39 @@ private:
 
     typedef std::vector<DeviceEnumeration> DevicesEnumeration;
 
+    struct EnumerationResult;
+    class EnumerationTask;
+    class RescanTask;
+
     DevicesEnumeration m_rxEnumeration;
     DevicesEnumeration m_txEnumeration;
+    DevicesEnumeration m_rescanRxEnumeration; //!< result of the asynchronous rescan
+    DevicesEnumeration m_rescanTxEnumeration; //!< result of the asynchronous rescan
+    bool m_rescanning;
+    int m_pluginTimeout;                      //!< maximum time in ms given to each plugin for its enumeration
+    QThreadPool *m_threadPool;
+    QList<QSharedPointer<EnumerationResult> > m_lateEnumerations; //!< enumerations still running after their timeout
+    QMap<QString, QSharedPointer<QMutex> > m_hardwareLocks; //!< by hardware group
+    QMutex m_mutex;
+    QSemaphore m_rescanDone;
+
+    QSharedPointer<QMutex> getHardwareLock(const QString& group);
+    static QString getHardwareGroup(const QString& deviceId);
+
+    void enumerateDevices(
+            const PluginAPI::SamplingDeviceRegistrations& registrations,
+            bool rxElseTx,
+            const DevicesEnumeration& previous,
+            DevicesEnumeration& enumeration);
+    static void mergeClaimed(const DevicesEnumeration& current, DevicesEnumeration& enumeration);
+    static bool sameDevices(const DevicesEnumeration& a, const DevicesEnumeration& b);
+    static int getSamplingDeviceIndex(const DevicesEnumeration& enumeration, const QString& deviceId, int sequence, int deviceItemIndex);
+    static void saveEnumeration(QSettings& s, const DevicesEnumeration& enumeration, const QString& arrayName);
+    static void loadEnumeration(
+            QSettings& s,
+            const PluginAPI::SamplingDeviceRegistrations& registrations,
+            const QString& arrayName,
+            DevicesEnumeration& enumeration);
 };
 
 #endif /* SDRBASE_DEVICE_DEVICEENUMERATOR_H_ */
@@ -22,6 +22,8 @@
 #include "plugin/plugininterface.h"
 #include "settings/preset.h"
 #include "dsp/dspengine.h"
+#include "dsp/polyphasechannelizer.h"
+#include "dsp/threadedbasebandsamplesink.h"
 #include "channel/channelsinkapi.h"
 
 DeviceSourceAPI::DeviceSourceAPI(int deviceTabIndex,
@@ -35,7 +37,10 @@ DeviceSourceAPI::DeviceSourceAPI(int deviceTabIndex,
     m_sampleSourcePluginInstanceUI(0),
     m_buddySharedPtr(0),
     m_isBuddyLeader(false),
-    m_masterTimer(DSPEngine::instance()->getMasterTimer())
+    m_masterTimer(DSPEngine::instance()->getMasterTimer()),
+    m_polyphaseChannelizer(0),
+    m_threadedPolyphaseChannelizer(0),
+    m_polyphaseChannelizerUsers(0)
 {
 }
 
@@ -63,6 +68,35 @@ void DeviceSourceAPI::removeThreadedSink(ThreadedBasebandSampleSink* sink)
     m_deviceSourceEngine->removeThreadedSink(sink);
 }
 
+PolyphaseChannelizer *DeviceSourceAPI::acquirePolyphaseChannelizer()
+{
+    if (m_polyphaseChannelizerUsers == 0)
+    {
+        m_polyphaseChannelizer = new PolyphaseChannelizer();
+        m_threadedPolyphaseChannelizer = new ThreadedBasebandSampleSink(m_polyphaseChannelizer, this);
+        m_deviceSourceEngine->addThreadedSink(m_threadedPolyphaseChannelizer);
+    }
+
+    m_polyphaseChannelizerUsers++;
+    return m_polyphaseChannelizer;
+}
+
+void DeviceSourceAPI::releasePolyphaseChannelizer()
+{
+    if (m_polyphaseChannelizerUsers == 0) {
+        return;
+    }
+
+    if (--m_polyphaseChannelizerUsers == 0)
+    {
+        m_deviceSourceEngine->removeThreadedSink(m_threadedPolyphaseChannelizer);
+        delete m_threadedPolyphaseChannelizer;
+        delete m_polyphaseChannelizer;
+        m_threadedPolyphaseChannelizer = 0;
+        m_polyphaseChannelizer = 0;
+    }
+}
+
 void DeviceSourceAPI::addChannelAPI(ChannelSinkAPI* channelAPI)
 {
     m_channelAPIs.append(channelAPI);
@@ -35,6 +35,7 @@ class PluginInterface;
 class Preset;
 class DeviceSinkAPI;
 class ChannelSinkAPI;
+class PolyphaseChannelizer;
 
 class SDRBASE_API DeviceSourceAPI : public QObject {
     Q_OBJECT
@@ -49,6 +50,8 @@ public:
     void removeSink(BasebandSampleSink* sink);    //!< Remove a sample sink from device engine
     void addThreadedSink(ThreadedBasebandSampleSink* sink);     //!< Add a sample sink that will run on its own thread to device engine
     void removeThreadedSink(ThreadedBasebandSampleSink* sink);  //!< Remove a sample sink that runs on its own thread from device engine
+    PolyphaseChannelizer *acquirePolyphaseChannelizer(); //!< Get the channelizer shared by the channels of this device. It is created on first use
+    void releasePolyphaseChannelizer();                  //!< Release the shared channelizer. It is deleted when the last user releases it
     void addChannelAPI(ChannelSinkAPI* channelAPI);
     void removeChannelAPI(ChannelSinkAPI* channelAPI);
     void setSampleSource(DeviceSampleSource* source); //!< Set device sample source
@@ -130,6 +133,10 @@ protected:
 
     QList<ChannelSinkAPI*> m_channelAPIs;
 
+    PolyphaseChannelizer *m_polyphaseChannelizer;                  //!< Sub-band channelizer shared by narrowband channels
+    ThreadedBasebandSampleSink *m_threadedPolyphaseChannelizer;
+    int m_polyphaseChannelizerUsers;
+
     friend class DeviceSinkAPI;
 
 private:
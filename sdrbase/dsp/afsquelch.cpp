@@ -16,6 +16,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>
+#include <algorithm>
 #include "dsp/afsquelch.h"
 
 #undef M_PI
@@ -38,20 +39,16 @@ AFSquelch::AFSquelch() :
 			m_threshold(0.0)
 {
 	m_k = new double[m_nTones];
-	m_coef = new double[m_nTones];
 	m_toneSet = new double[m_nTones];
-	m_u0 = new double[m_nTones];
-	m_u1 = new double[m_nTones];
-	m_power = new double[m_nTones];
+	m_power = new float[m_nTones];
     m_movingAverages.resize(m_nTones, MovingAverage<double>(m_nbAvg, 0.0f));
+    m_goertzelBank.resize(m_nTones);
 
     for (unsigned int j = 0; j < m_nTones; ++j)
 	{
 		m_toneSet[j] = j == 0 ? 1000.0 : 6000.0;
         m_k[j] = ((double)m_N * m_toneSet[j]) / (double) m_sampleRate;
-        m_coef[j] = 2.0 * cos((2.0 * M_PI * m_toneSet[j])/(double) m_sampleRate);
-        m_u0[j] = 0.0;
-        m_u1[j] = 0.0;
+        m_goertzelBank.setFrequency(j, m_toneSet[j], m_sampleRate);
         m_power[j] = 0.0;
         m_movingAverages[j].fill(0.0);
 	}
@@ -61,10 +58,7 @@ AFSquelch::AFSquelch() :
 AFSquelch::~AFSquelch()
 {
 	delete[] m_k;
-	delete[] m_coef;
 	delete[] m_toneSet;
-	delete[] m_u0;
-	delete[] m_u1;
 	delete[] m_power;
 }
 
@@ -103,12 +97,12 @@ void AFSquelch::setCoefficients(
 	{
         m_toneSet[j] = tones[j] < ((double) m_sampleRate) * 0.4 ? tones[j] : ((double) m_sampleRate) * 0.4; // guarantee 80% Nyquist rate
 		m_k[j] = ((double)m_N * m_toneSet[j]) / (double)m_sampleRate;
-		m_coef[j] = 2.0 * cos((2.0 * M_PI * m_toneSet[j])/(double)m_sampleRate);
-		m_u0[j] = 0.0;
-		m_u1[j] = 0.0;
+		m_goertzelBank.setFrequency(j, m_toneSet[j], m_sampleRate);
         m_power[j] = 0.0;
         m_movingAverages[j].fill(0.0);
 	}
+
+	m_goertzelBank.reset();
 }
 
 
@@ -141,28 +135,52 @@ bool AFSquelch::analyze(double sample)
 }
 
 
-void AFSquelch::feedback(double in)
+// Analyze a block of input samples. A block of the algorithm spans N+1 samples
+// like in the sample by sample version above.
+bool AFSquelch::analyze(const Real *samples, int n)
 {
-	double t;
+    bool result = false;
 
-	// feedback for each tone
-    for (unsigned int j = 0; j < m_nTones; ++j)
-	{
-		t = m_u0[j];
-		m_u0[j] = in + (m_coef[j] * m_u0[j]) - m_u1[j];
-		m_u1[j] = t;
-	}
+    while (n > 0)
+    {
+        int count = std::min(n, (int) (m_N + 1 - m_samplesProcessed));
+        m_goertzelBank.feed(samples, count); // Goertzel feedback
+        samples += count;
+        n -= count;
+
+        if (m_samplesProcessed + count <= m_N)
+        {
+            m_samplesProcessed += count;
+        }
+        else
+        {
+            feedForward(); // calculate the power at each tone
+            m_samplesProcessed = 0;
+
+            if (m_samplesAvgProcessed < m_nbAvg) {
+                m_samplesAvgProcessed++;
+            } else {
+                result = true; // have a result
+            }
+        }
+    }
+
+    return result;
+}
+
+
+void AFSquelch::feedback(double in)
+{
+	m_goertzelBank.feed(in); // feedback for each tone
 }
 
 
 void AFSquelch::feedForward()
 {
-    for (unsigned int j = 0; j < m_nTones; ++j)
-	{
-		m_power[j] = (m_u0[j] * m_u0[j]) + (m_u1[j] * m_u1[j]) - (m_coef[j] * m_u0[j] * m_u1[j]);
+    m_goertzelBank.power(m_power); // also resets for next block
+
+    for (unsigned int j = 0; j < m_nTones; ++j) {
 		m_movingAverages[j].feed(m_power[j]);
-		m_u0[j] = 0.0;
-		m_u1[j] = 0.0; // reset for next block.
 	}
 
 	evaluate();
@@ -173,12 +191,11 @@ void AFSquelch::reset()
 {
     for (unsigned int j = 0; j < m_nTones; ++j)
 	{
-        m_u0[j] = 0.0;
-        m_u1[j] = 0.0;
         m_power[j] = 0.0;
         m_movingAverages[j].fill(0.0);
 	}
 
+	m_goertzelBank.reset();
 	m_samplesProcessed = 0;
 	m_maxPowerIndex = 0;
 	m_isOpen = false;
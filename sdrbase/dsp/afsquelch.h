@@ -20,10 +20,11 @@
 
 #include "dsp/dsptypes.h"
 #include "dsp/movingaverage.h"
+#include "dsp/goertzelbank.h"
 #include "export.h"
 
 /** AFSquelch: AF squelch class based on the Modified Goertzel
- * algorithm.
+ * algorithm. The tone recurrences run in a SIMD Goertzel bank.
  */
 class SDRBASE_API AFSquelch {
 public:
@@ -46,6 +47,7 @@ public:
     // analyze a sample set and optionally filter
     // the tone frequencies.
     bool analyze(double sample); // input signal sample
+    bool analyze(const Real *samples, int n); // block of input signal samples. True if at least one result
     bool evaluate(); // evaluate result
 
     // get the tone set
@@ -80,11 +82,9 @@ private:
     bool m_isOpen;
     double m_threshold;
     double *m_k;
-    double *m_coef;
     double *m_toneSet;
-    double *m_u0;
-    double *m_u1;
-    double *m_power;
+    float *m_power;
+    GoertzelBank m_goertzelBank;
     std::vector<MovingAverage<double> > m_movingAverages;
 };
 
@@ -12,6 +12,20 @@ BasebandSampleSink::~BasebandSampleSink()
 {
 }
 
+void BasebandSampleSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	m_feedFBuffer.resize(end - begin);
+	SampleVector::iterator out = m_feedFBuffer.begin();
+
+	for (FSampleVector::const_iterator it = begin; it != end; ++it, ++out)
+	{
+		out->setReal(it->real() * SDR_RX_SCALEF);
+		out->setImag(it->imag() * SDR_RX_SCALEF);
+	}
+
+	feed(m_feedFBuffer.begin(), m_feedFBuffer.end(), positiveOnly);
+}
+
 void BasebandSampleSink::handleInputMessages()
 {
 	Message* message;
@@ -25,3 +39,9 @@ void BasebandSampleSink::handleInputMessages()
 	}
 }
 
+
+void BasebandSampleSink::getProfileStages(DSPProfile& profile, DSPProfile::StageType type)
+{
+	m_profileStage.setName(objectName());
+	profile.addStage(m_profileStage, type);
+}
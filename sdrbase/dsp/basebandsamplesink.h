@@ -21,6 +21,7 @@
 
 #include <QObject>
 #include "dsp/dsptypes.h"
+#include "dsp/dspprofile.h"
 #include "export.h"
 #include "util/messagequeue.h"
 #include "util/message.h"
@@ -57,15 +58,24 @@ public:
 	virtual void start() = 0;
 	virtual void stop() = 0;
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly) = 0;
+	/** Float baseband with samples normalized to +/-1.0. This default converts to fixed point and calls feed().
+	 *  Sinks that can work on float samples directly override it to save the conversions. */
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	virtual bool handleMessage(const Message& cmd) = 0; //!< Processing of a message. Returns true if message has actually been processed
 
 	MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
     MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
 
+	DSPProfileStage& getProfileStage() { return m_profileStage; } //!< Processing counters of this sink recorded by the caller of feed()
+	/** Append the snapshots of this sink stage and of the sinks it feeds */
+	virtual void getProfileStages(DSPProfile& profile, DSPProfile::StageType type);
+
 protected:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
+    SampleVector m_feedFBuffer;       //!< Conversion buffer of the default feedF()
+    DSPProfileStage m_profileStage;
 
 protected slots:
 	void handleInputMessages();
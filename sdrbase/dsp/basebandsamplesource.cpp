@@ -16,6 +16,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include "dsp/basebandsamplesource.h"
 #include "util/message.h"
 
@@ -61,10 +63,21 @@ void BasebandSampleSource::handleWriteToFifo(SampleSourceFifo *sampleFifo, int n
     sampleFifo->getWriteIterator(writeAt);
     pullAudio(nbSamples); // Pre-fetch input audio samples this is mandatory to keep things running smoothly
 
-    for (int i = 0; i < nbSamples; i++)
+    unsigned int remainder = nbSamples;
+
+    while (remainder > 0) // write in contiguous chunks up to the end of the FIFO buffer
     {
-        pull((*writeAt));
-        sampleFifo->bumpIndex(writeAt);
+        unsigned int chunkSize = std::min(remainder, sampleFifo->getWriteChunkSize());
+        pull(writeAt, chunkSize);
+        sampleFifo->bumpIndex(writeAt, chunkSize);
+        remainder -= chunkSize;
+    }
+}
+
+void BasebandSampleSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+        pull(*begin);
     }
 }
 
@@ -5,6 +5,7 @@
  *      Author: f4exb
  */
 #include <math.h>
+#include <algorithm>
 #include "dsp/ctcssdetector.h"
 
 #undef M_PI
@@ -20,11 +21,9 @@ CTCSSDetector::CTCSSDetector() :
 {
 	nTones = 32;
 	k = new Real[nTones];
-	coef = new Real[nTones];
 	toneSet = new Real[nTones];
-	u0 = new Real[nTones];
-	u1 = new Real[nTones];
 	power = new Real[nTones];
+	goertzelBank.resize(nTones);
 
 	// The 32 EIA standard tones
 	toneSet[0]  = 67.0;
@@ -71,11 +70,9 @@ CTCSSDetector::CTCSSDetector(int _nTones, Real *tones) :
 {
 	nTones = _nTones;
 	k = new Real[nTones];
-	coef = new Real[nTones];
 	toneSet = new Real[nTones];
-	u0 = new Real[nTones];
-	u1 = new Real[nTones];
 	power = new Real[nTones];
+	goertzelBank.resize(nTones);
 
 	for (int j = 0; j < nTones; ++j)
 	{
@@ -87,10 +84,7 @@ CTCSSDetector::CTCSSDetector(int _nTones, Real *tones) :
 CTCSSDetector::~CTCSSDetector()
 {
 	delete[] k;
-	delete[] coef;
 	delete[] toneSet;
-	delete[] u0;
-	delete[] u1;
 	delete[] power;
 }
 
@@ -110,8 +104,12 @@ void CTCSSDetector::setCoefficients(int zN, int _samplerate )
 	for (int j = 0; j < nTones; ++j)
 	{
 		k[j] = ((double)N * toneSet[j]) / (double)sampleRate;
-		coef[j] = 2.0 * cos((2.0 * M_PI * toneSet[j])/(double)sampleRate);
+		goertzelBank.setFrequency(j, toneSet[j], sampleRate);
 	}
+
+	// restart the block: a partial block was accumulated for the previous N
+	goertzelBank.reset();
+	samplesProcessed = 0;
 }
 
 
@@ -122,7 +120,7 @@ bool CTCSSDetector::analyze(Real *sample)
 	feedback(*sample); // Goertzel feedback
 	samplesProcessed += 1;
 
-	if (samplesProcessed == N) // completed a block of N
+	if (samplesProcessed >= N) // completed a block of N
 	{
 		feedForward(); // calculate the power at each tone
 		samplesProcessed = 0;
@@ -135,30 +133,46 @@ bool CTCSSDetector::analyze(Real *sample)
 }
 
 
-void CTCSSDetector::feedback(Real in)
+// Analyze a block of input samples. The Goertzel feedback runs on
+// the whole run of samples up to the end of the current block of N.
+bool CTCSSDetector::analyze(const Real *samples, int n)
 {
-	Real t;
+	bool result = false;
 
-	// feedback for each tone
-	for (int j = 0; j < nTones; ++j)
+	if (N <= 0) {
+		return false;
+	}
+
+	while (n > 0)
 	{
-		t = u0[j];
-		u0[j] = in + (coef[j] * u0[j]) - u1[j];
-		u1[j] = t;
+		int count = std::max(1, std::min(n, N - samplesProcessed));
+		goertzelBank.feed(samples, count); // Goertzel feedback
+		samples += count;
+		n -= count;
+		samplesProcessed += count;
+
+		if (samplesProcessed >= N) // completed a block of N
+		{
+			feedForward(); // calculate the power at each tone
+			samplesProcessed = 0;
+			result = true;
+		}
 	}
+
+	return result;
 }
 
 
-void CTCSSDetector::feedForward()
+void CTCSSDetector::feedback(Real in)
 {
-	initializePower();
+	goertzelBank.feed(in); // feedback for each tone
+}
 
-	for (int j = 0; j < nTones; ++j)
-	{
-		power[j] = (u0[j] * u0[j]) + (u1[j] * u1[j]) - (coef[j] * u0[j] * u1[j]);
-		u0[j] = u1[j] = 0.0; // reset for next block.
-	}
 
+void CTCSSDetector::feedForward()
+{
+	initializePower();
+	goertzelBank.power(power); // also resets for next block
 	evaluatePower();
 }
 
@@ -167,9 +181,10 @@ void CTCSSDetector::reset()
 {
 	for (int j = 0; j < nTones; ++j)
 	{
-		power[j] = u0[j] = u1[j] = 0.0; // reset
+		power[j] = 0.0; // reset
 	}
 
+	goertzelBank.reset();
 	samplesProcessed = 0;
 	maxPower = 0.0;
 	maxPowerIndex = 0;
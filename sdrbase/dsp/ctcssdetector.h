@@ -10,11 +10,13 @@
 #define INCLUDE_GPL_DSP_CTCSSDETECTOR_H_
 
 #include "dsp/dsptypes.h"
+#include "dsp/goertzelbank.h"
 #include "export.h"
 
 /** CTCSSDetector: Continuous Tone Coded Squelch System
  * tone detector class based on the Modified Goertzel
- * algorithm.
+ * algorithm. The recurrences of all tones are run
+ * together in a SIMD Goertzel bank.
  */
 class SDRBASE_API CTCSSDetector {
 public:
@@ -36,6 +38,10 @@ public:
     // the tone frequencies.
     bool analyze(Real *sample); // input signal sample
 
+    // analyze a block of samples. Returns true if at least one
+    // analysis block was completed (the last one gives the result)
+    bool analyze(const Real *samples, int n);
+
     // get the number of defined tones.
     int getNTones() const {
     	return nTones;
@@ -78,11 +84,9 @@ private:
     bool toneDetected;
     Real maxPower;
     Real *k;
-    Real *coef;
     Real *toneSet;
-    Real *u0;
-    Real *u1;
     Real *power;
+    GoertzelBank goertzelBank;
 };
 
 
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "devicesamplepipeline.h"
+
+DeviceSamplePipeline::DeviceSamplePipeline(Processor *processor, QObject *parent) :
+    QThread(parent),
+    m_processor(processor),
+    m_running(false),
+    m_nbBuffers(0),
+    m_overruns(0),
+    m_latencySum(0),
+    m_latencyCount(0),
+    m_latencyMax(0)
+{
+    m_clock.start();
+}
+
+DeviceSamplePipeline::~DeviceSamplePipeline()
+{
+    stopWork();
+}
+
+void DeviceSamplePipeline::allocate(unsigned int nbBuffers, unsigned int nbChannels, unsigned int channelSize)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_freeBuffers.clear();
+    m_readyBuffers.clear();
+    m_buffers.resize(nbBuffers < m_minNbBuffers ? m_minNbBuffers : nbBuffers);
+
+    for (std::vector<Buffer>::iterator it = m_buffers.begin(); it != m_buffers.end(); ++it)
+    {
+        it->m_channels.assign(nbChannels, std::vector<char>(channelSize));
+        it->m_channelPointers.resize(nbChannels);
+
+        for (unsigned int i = 0; i < nbChannels; i++) {
+            it->m_channelPointers[i] = it->m_channels[i].data();
+        }
+
+        it->m_nbSamples = 0;
+        it->m_timestamp = 0;
+        m_freeBuffers.push_back(&(*it));
+    }
+
+    qDebug("DeviceSamplePipeline::allocate: %u buffers of %u x %u bytes", (unsigned int) m_buffers.size(), nbChannels, channelSize);
+}
+
+void DeviceSamplePipeline::startWork()
+{
+    if (m_running) {
+        return;
+    }
+
+    m_mutex.lock();
+    m_nbBuffers = 0;
+    m_overruns = 0;
+    m_latencySum = 0;
+    m_latencyCount = 0;
+    m_latencyMax = 0;
+    m_mutex.unlock();
+
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void DeviceSamplePipeline::stopWork()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_mutex.lock();
+    m_running = false;
+    m_readyCondition.wakeAll();
+    m_mutex.unlock();
+    wait();
+
+    // buffers not processed go back to the pool
+    m_mutex.lock();
+
+    while (!m_readyBuffers.empty())
+    {
+        m_freeBuffers.push_back(m_readyBuffers.front());
+        m_readyBuffers.pop_front();
+    }
+
+    m_mutex.unlock();
+}
+
+DeviceSamplePipeline::Buffer *DeviceSamplePipeline::acquireBuffer()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Buffer *buffer;
+
+    if (!m_freeBuffers.empty())
+    {
+        buffer = m_freeBuffers.front();
+        m_freeBuffers.pop_front();
+    }
+    else // worker is late: drop the oldest pending buffer
+    {
+        buffer = m_readyBuffers.front();
+        m_readyBuffers.pop_front();
+        m_overruns++;
+    }
+
+    return buffer;
+}
+
+void DeviceSamplePipeline::submitBuffer(Buffer *buffer, int nbSamples)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (nbSamples > 0)
+    {
+        buffer->m_nbSamples = nbSamples;
+        buffer->m_timestamp = m_clock.nsecsElapsed();
+        m_readyBuffers.push_back(buffer);
+        m_readyCondition.wakeOne();
+    }
+    else
+    {
+        m_freeBuffers.push_back(buffer);
+    }
+}
+
+void DeviceSamplePipeline::getStats(Stats& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    stats.m_nbBuffers = m_nbBuffers;
+    stats.m_overruns = m_overruns;
+    stats.m_latencyAvg = m_latencyCount == 0 ? 0.0f : (m_latencySum / (float) m_latencyCount) / 1000.0f;
+    stats.m_latencyMax = m_latencyMax / 1000.0f;
+    m_latencySum = 0;
+    m_latencyCount = 0;
+    m_latencyMax = 0;
+}
+
+void DeviceSamplePipeline::run()
+{
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    m_mutex.lock();
+
+    while (m_running)
+    {
+        if (m_readyBuffers.empty())
+        {
+            m_readyCondition.wait(&m_mutex, 100);
+            continue;
+        }
+
+        Buffer *buffer = m_readyBuffers.front();
+        m_readyBuffers.pop_front();
+        m_mutex.unlock();
+
+        m_processor->processBuffer(*buffer);
+        qint64 latency = m_clock.nsecsElapsed() - buffer->m_timestamp;
+
+        m_mutex.lock();
+        m_freeBuffers.push_back(buffer);
+        m_nbBuffers++;
+        m_latencySum += latency;
+        m_latencyCount++;
+
+        if (latency > m_latencyMax) {
+            m_latencyMax = latency;
+        }
+    }
+
+    m_mutex.unlock();
+}
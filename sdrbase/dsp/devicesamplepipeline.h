@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DEVICESAMPLEPIPELINE_H_
+#define SDRBASE_DSP_DEVICESAMPLEPIPELINE_H_
+
+#include <vector>
+#include <deque>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+#include "export.h"
+
+/**
+ * Two stage pipeline for device input threads. The device thread only reads the
+ * device stream into buffers taken from a pool of recycled buffers and submits them.
+ * This worker thread takes the submitted buffers in order and hands them to the
+ * processor (sample conversion, decimation and FIFO write) then recycles them.
+ *
+ * The reader never waits for the worker: when no buffer is free the oldest buffer not
+ * yet processed is reused and counted as an overrun. The reader must submit each
+ * acquired buffer before acquiring the next one. The time between the submission
+ * of a buffer and the end of its processing is measured as the pipeline latency.
+ */
+class SDRBASE_API DeviceSamplePipeline : public QThread
+{
+    Q_OBJECT
+
+public:
+    struct Buffer
+    {
+        std::vector<std::vector<char> > m_channels; //!< raw samples of each device channel
+        std::vector<void*> m_channelPointers;       //!< start of each channel buffer as expected by multiple channels read functions
+        int m_nbSamples;                            //!< number of I/Q samples read in each channel
+        qint64 m_timestamp;                         //!< submission time in ns
+    };
+
+    class Processor
+    {
+    public:
+        virtual ~Processor() {}
+        virtual void processBuffer(const Buffer& buffer) = 0; //!< called in the worker thread
+    };
+
+    struct Stats
+    {
+        quint64 m_nbBuffers;  //!< number of buffers processed since start
+        quint64 m_overruns;   //!< number of buffers dropped since start
+        float m_latencyAvg;   //!< average latency in microseconds since the last call to getStats
+        float m_latencyMax;   //!< maximum latency in microseconds since the last call to getStats
+    };
+
+    explicit DeviceSamplePipeline(Processor *processor, QObject *parent = 0);
+    ~DeviceSamplePipeline();
+
+    void allocate(unsigned int nbBuffers, unsigned int nbChannels, unsigned int channelSize); //!< channel size in bytes. Call when not running
+    void startWork();
+    void stopWork();
+    bool isRunning() const { return m_running; }
+
+    Buffer *acquireBuffer();                          //!< reader: buffer to read the device stream into
+    void submitBuffer(Buffer *buffer, int nbSamples); //!< reader: queue buffer for processing. With no samples it is just recycled
+    void getStats(Stats& stats);
+
+    static const unsigned int m_minNbBuffers = 3; //!< one being read, one being processed and at least one queued
+
+private:
+    Processor *m_processor;
+    std::vector<Buffer> m_buffers;
+    std::deque<Buffer*> m_freeBuffers;
+    std::deque<Buffer*> m_readyBuffers;
+    QMutex m_mutex;
+    QWaitCondition m_readyCondition;
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    bool m_running;
+    QElapsedTimer m_clock;
+    quint64 m_nbBuffers;
+    quint64 m_overruns;
+    qint64 m_latencySum;     //!< ns
+    quint64 m_latencyCount;
+    qint64 m_latencyMax;     //!< ns
+
+    void run();
+};
+
+#endif /* SDRBASE_DSP_DEVICESAMPLEPIPELINE_H_ */
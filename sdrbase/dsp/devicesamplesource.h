@@ -23,6 +23,7 @@
 #include <QByteArray>
 
 #include "samplesinkfifo.h"
+#include "fsamplesinkfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 #include "export.h"
@@ -65,6 +66,7 @@ public:
     virtual void setCenterFrequency(qint64 centerFrequency) = 0;
 
 	virtual bool handleMessage(const Message& message) = 0;
+	virtual bool isEndOfStream() const { return false; } //!< true when a finite input such as a recording has been read to the end
 
 	virtual int webapiSettingsGet(
             SWGSDRangel::SWGDeviceSettings& response,
@@ -120,6 +122,7 @@ public:
 	virtual void setMessageQueueToGUI(MessageQueue *queue) = 0; // pure virtual so that child classes must have to deal with this
 	MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
     SampleSinkFifo* getSampleFifo() { return &m_sampleFifo; }
+    FSampleSinkFifo* getSampleFifoF() { return &m_sampleFifoF; } //!< used instead of the fixed point FIFO by float baseband sources
 
     static qint64 calculateDeviceCenterFrequency(
             quint64 centerFrequency,
@@ -153,6 +156,7 @@ protected slots:
 
 protected:
     SampleSinkFifo m_sampleFifo;
+    FSampleSinkFifo m_sampleFifoF; //!< float baseband FIFO. Only sized by sources delivering float samples
 	MessageQueue m_inputMessageQueue; //!< Input queue to the source
 	MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
 };
@@ -19,6 +19,7 @@
 #include <dsp/downchannelizer.h>
 #include "dsp/inthalfbandfilter.h"
 #include "dsp/dspcommands.h"
+#include "dsp/polyphasechannelizer.h"
 
 #include <QString>
 #include <QDebug>
@@ -31,7 +32,10 @@ DownChannelizer::DownChannelizer(BasebandSampleSink* sampleSink) :
 	m_requestedOutputSampleRate(0),
 	m_requestedCenterFrequency(0),
 	m_currentOutputSampleRate(0),
-	m_currentCenterFrequency(0)
+	m_currentCenterFrequency(0),
+	m_blockProcessing(true),
+	m_polyphaseChannelizer(0),
+	m_subband(-1)
 {
 	QString name = "DownChannelizer(" + m_sampleSink->objectName() + ")";
 	setObjectName(name);
@@ -39,6 +43,7 @@ DownChannelizer::DownChannelizer(BasebandSampleSink* sampleSink) :
 
 DownChannelizer::~DownChannelizer()
 {
+	detachSubband();
 	freeFilterChain();
 }
 
@@ -55,40 +60,223 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 		return;
 	}
 
-	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
+	if (m_subband >= 0) // samples come from the polyphase channelizer sub-band
 	{
-		m_sampleSink->feed(begin, end, positiveOnly);
+		m_mutex.lock();
+		feedSubband();
+		m_mutex.unlock();
+
+		feedSink(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
+		m_sampleBuffer.clear();
+	}
+	else if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
+	{
+		feedSink(begin, end, positiveOnly);
+	}
+	else if (m_blockProcessing)
+	{
+		m_mutex.lock();
+		unsigned int nbOut = feedStageMajor(begin, end);
+		m_mutex.unlock();
+
+		feedSink(m_stageBuffer.begin(), m_stageBuffer.begin() + nbOut, positiveOnly);
 	}
 	else
 	{
 		m_mutex.lock();
+		feedSampleMajor(begin, end);
+		m_mutex.unlock();
 
-		for(SampleVector::const_iterator sample = begin; sample != end; ++sample)
-		{
-			Sample s(*sample);
-			FilterStages::iterator stage = m_filterStages.begin();
+		feedSink(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
+		m_sampleBuffer.clear();
+	}
+}
 
-			for (; stage != m_filterStages.end(); ++stage)
-			{
-				if(!(*stage)->work(&s))
-				{
-					break;
-				}
-			}
+/**
+ * Float baseband samples always go through the filter chain stage by stage. The float half-band
+ * filters have unity gain so unlike feed() there is no rescaling and the decimated samples are
+ * passed as float to the sink.
+ */
+void DownChannelizer::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	if(m_sampleSink == 0) {
+		return;
+	}
+
+	if (m_subband >= 0) // the polyphase channelizer sub-band is fixed point
+	{
+		m_mutex.lock();
+		feedSubband();
+		m_mutex.unlock();
 
-			if(stage == m_filterStages.end())
+		feedSink(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
+		m_sampleBuffer.clear();
+	}
+	else if (m_filterStages.size() == 0)
+	{
+		feedSinkF(begin, end, positiveOnly);
+	}
+	else
+	{
+		m_mutex.lock();
+		unsigned int nbOut = feedStageMajorF(begin, end);
+		m_mutex.unlock();
+
+		feedSinkF(m_stageBufferF.begin(), m_stageBufferF.begin() + nbOut, positiveOnly);
+	}
+}
+
+/**
+ * The demodulator feed is timed on its own so that the profile of the channelizer
+ * only accounts for the channelizer itself.
+ */
+void DownChannelizer::feedSink(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+	qint64 start = DSPProfileStage::now();
+	m_sampleSink->feed(begin, end, positiveOnly);
+	qint64 elapsed = DSPProfileStage::now() - start;
+	m_sampleSink->getProfileStage().record(elapsed, end - begin);
+	m_profileStage.recordChild(elapsed);
+}
+
+void DownChannelizer::feedSinkF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	qint64 start = DSPProfileStage::now();
+	m_sampleSink->feedF(begin, end, positiveOnly);
+	qint64 elapsed = DSPProfileStage::now() - start;
+	m_sampleSink->getProfileStage().record(elapsed, end - begin);
+	m_profileStage.recordChild(elapsed);
+}
+
+void DownChannelizer::getProfileStages(DSPProfile& profile, DSPProfile::StageType type)
+{
+	BasebandSampleSink::getProfileStages(profile, type);
+
+	if (m_sampleSink) {
+		m_sampleSink->getProfileStages(profile, DSPProfile::StageChannel);
+	}
+}
+
+/**
+ * The device stream is only used as a clock: whatever the polyphase channelizer has
+ * written to the sub-band FIFO so far is appended to m_sampleBuffer.
+ */
+void DownChannelizer::feedSubband()
+{
+	if (m_subband < 0) {
+		return;
+	}
+
+	uint count = m_subbandFifo.fill();
+
+	if (count == 0) {
+		return;
+	}
+
+	SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+	m_subbandFifo.readBegin(count, &part1Begin, &part1End, &part2Begin, &part2End);
+	m_sampleBuffer.insert(m_sampleBuffer.end(), part1Begin, part1End);
+	m_sampleBuffer.insert(m_sampleBuffer.end(), part2Begin, part2End);
+	m_subbandFifo.readCommit(count);
+}
+
+void DownChannelizer::feedSampleMajor(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+	for(SampleVector::const_iterator sample = begin; sample != end; ++sample)
+	{
+		Sample s(*sample);
+		FilterStages::iterator stage = m_filterStages.begin();
+
+		for (; stage != m_filterStages.end(); ++stage)
+		{
+			if(!(*stage)->work(&s))
 			{
-			    s.m_real /= (1<<(m_filterStages.size()));
-			    s.m_imag /= (1<<(m_filterStages.size()));
-				m_sampleBuffer.push_back(s);
+				break;
 			}
 		}
 
-		m_mutex.unlock();
+		if(stage == m_filterStages.end())
+		{
+			s.m_real /= (1<<(m_filterStages.size()));
+			s.m_imag /= (1<<(m_filterStages.size()));
+			m_sampleBuffer.push_back(s);
+		}
+	}
+}
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
-		m_sampleBuffer.clear();
+/**
+ * Each stage decimates the whole block before the next stage runs. The first stage reads the input
+ * and writes to m_stageBuffer then the following stages work in place in m_stageBuffer.
+ * Returns the number of output samples at the start of m_stageBuffer.
+ */
+unsigned int DownChannelizer::feedStageMajor(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+	unsigned int nbIn = end - begin;
+
+	if (nbIn == 0) {
+		return 0;
 	}
+
+	if (m_stageBuffer.size() < nbIn/2 + 1) {
+		m_stageBuffer.resize(nbIn/2 + 1);
+	}
+
+	FilterStages::iterator stage = m_filterStages.begin();
+	unsigned int nbOut = (*stage)->workBlock(&(*begin), nbIn, m_stageBuffer.data());
+
+	for (++stage; stage != m_filterStages.end(); ++stage) {
+		nbOut = (*stage)->workBlock(m_stageBuffer.data(), nbOut, m_stageBuffer.data());
+	}
+
+	SampleVector::iterator it = m_stageBuffer.begin();
+	int scale = 1<<(m_filterStages.size());
+
+	for (unsigned int i = 0; i < nbOut; i++, ++it)
+	{
+		it->m_real /= scale;
+		it->m_imag /= scale;
+	}
+
+	return nbOut;
+}
+
+unsigned int DownChannelizer::feedStageMajorF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+	unsigned int nbIn = end - begin;
+
+	if (nbIn == 0) {
+		return 0;
+	}
+
+	if (m_stageBufferF.size() < nbIn/2 + 1) {
+		m_stageBufferF.resize(nbIn/2 + 1);
+	}
+
+	FilterStages::iterator stage = m_filterStages.begin();
+	unsigned int nbOut = (*stage)->workBlockF(&(*begin), nbIn, m_stageBufferF.data());
+
+	for (++stage; stage != m_filterStages.end(); ++stage) {
+		nbOut = (*stage)->workBlockF(m_stageBufferF.data(), nbOut, m_stageBufferF.data());
+	}
+
+	return nbOut;
+}
+
+void DownChannelizer::setBlockProcessing(bool blockProcessing)
+{
+	m_mutex.lock();
+	m_blockProcessing = blockProcessing;
+	m_mutex.unlock();
+}
+
+void DownChannelizer::setPolyphaseChannelizer(PolyphaseChannelizer *polyphaseChannelizer)
+{
+	m_mutex.lock();
+	detachSubband();
+	m_polyphaseChannelizer = polyphaseChannelizer;
+	m_mutex.unlock();
+
+	applyConfiguration();
 }
 
 void DownChannelizer::start()
@@ -166,21 +354,24 @@ void DownChannelizer::applyConfiguration()
 	m_mutex.lock();
 
 	freeFilterChain();
+	detachSubband();
 
 	m_currentCenterFrequency = createFilterChain(
 		m_inputSampleRate / -2, m_inputSampleRate / 2,
 		m_requestedCenterFrequency - m_requestedOutputSampleRate / 2, m_requestedCenterFrequency + m_requestedOutputSampleRate / 2);
 
-	m_mutex.unlock();
-
 	//debugFilterChain();
 
 	m_currentOutputSampleRate = m_inputSampleRate / (1 << m_filterStages.size());
+	bool subband = attachSubband();
+
+	m_mutex.unlock();
 
 	qDebug() << "DownChannelizer::applyConfiguration in=" << m_inputSampleRate
 			<< ", req=" << m_requestedOutputSampleRate
 			<< ", out=" << m_currentOutputSampleRate
-			<< ", fc=" << m_currentCenterFrequency;
+			<< ", fc=" << m_currentCenterFrequency
+			<< ", subband=" << (subband ? m_subband : -1);
 
 	if (m_sampleSink != 0)
 	{
@@ -189,45 +380,94 @@ void DownChannelizer::applyConfiguration()
 	}
 }
 
+/**
+ * Use a sub-band of the polyphase channelizer instead of the own filter chain when the channel
+ * fits in the sub-band passband and the sub-band rate is not more than twice the rate the filter
+ * chain would give. In this case the filter chain is freed. Call with m_mutex locked.
+ */
+bool DownChannelizer::attachSubband()
+{
+	if ((m_polyphaseChannelizer == 0) || (m_requestedOutputSampleRate <= 0)) {
+		return false;
+	}
+
+	int subband = m_polyphaseChannelizer->getSubbandIndex(m_inputSampleRate, m_requestedCenterFrequency, m_requestedOutputSampleRate);
+	int subbandSampleRate = m_polyphaseChannelizer->getSubbandSampleRate(m_inputSampleRate);
+
+	if ((subband < 0) || (subbandSampleRate > 2*m_currentOutputSampleRate)) {
+		return false;
+	}
+
+	freeFilterChain();
+	m_subbandFifo.setSize(subbandSampleRate / 2); // half a second
+	m_currentOutputSampleRate = subbandSampleRate;
+	m_currentCenterFrequency = m_requestedCenterFrequency - m_polyphaseChannelizer->getSubbandFrequency(m_inputSampleRate, subband);
+	m_polyphaseChannelizer->attach(subband, &m_subbandFifo);
+	m_subband = subband;
+
+	return true;
+}
+
+/** Call with m_mutex locked */
+void DownChannelizer::detachSubband()
+{
+	if (m_subband < 0) {
+		return;
+	}
+
+	m_polyphaseChannelizer->detach(&m_subbandFifo);
+	m_subband = -1;
+}
+
 #ifdef SDR_RX_SAMPLE_24BIT
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
     m_filter(new IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>),
+    m_filterF(new IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>),
     m_workFunction(0),
+    m_workFunctionF(0),
     m_mode(mode),
     m_sse(true)
 {
     switch(mode) {
         case ModeCenter:
             m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
             break;
 
         case ModeLowerHalf:
             m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
             break;
 
         case ModeUpperHalf:
             m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
             break;
     }
 }
 #else
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
     m_filter(new IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>),
+    m_filterF(new IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>),
     m_workFunction(0),
+    m_workFunctionF(0),
     m_mode(mode),
     m_sse(true)
 {
     switch(mode) {
         case ModeCenter:
             m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
             break;
 
         case ModeLowerHalf:
             m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
             break;
 
         case ModeUpperHalf:
             m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
+            m_workFunctionF = &IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
             break;
     }
 }
@@ -236,6 +476,7 @@ DownChannelizer::FilterStage::FilterStage(Mode mode) :
 DownChannelizer::FilterStage::~FilterStage()
 {
 	delete m_filter;
+	delete m_filterF;
 }
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
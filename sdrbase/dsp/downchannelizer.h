@@ -25,10 +25,13 @@
 #include "export.h"
 #include "util/message.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "dsp/inthalfbandfiltereof.h"
+#include "dsp/samplesinkfifo.h"
 
 #define DOWNCHANNELIZER_HB_FILTER_ORDER 48
 
 class MessageQueue;
+class PolyphaseChannelizer;
 
 class SDRBASE_API DownChannelizer : public BasebandSampleSink {
 	Q_OBJECT
@@ -66,7 +69,14 @@ public:
 	virtual void start();
 	virtual void stop();
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	virtual bool handleMessage(const Message& cmd);
+	virtual void getProfileStages(DSPProfile& profile, DSPProfile::StageType type);
+
+	void setBlockProcessing(bool blockProcessing); //!< Process whole blocks stage by stage (true) or each sample through all stages (false)
+	bool getBlockProcessing() const { return m_blockProcessing; }
+	void setPolyphaseChannelizer(PolyphaseChannelizer *polyphaseChannelizer); //!< Take samples from a sub-band of this channelizer when the channel fits (0 to always use own filter chain)
+	int getSubband() const { return m_subband; } //!< Polyphase channelizer sub-band in use or -1 if none
 
 protected:
 	struct FilterStage {
@@ -84,7 +94,11 @@ protected:
         IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
 #endif
 
+		typedef bool (IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunctionF)(FSample* s);
+		IntHalfbandFilterEOF<DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filterF; //!< float baseband filter
+
 		WorkFunction m_workFunction;
+		WorkFunctionF m_workFunctionF;
 		Mode m_mode;
 		bool m_sse;
 
@@ -95,6 +109,40 @@ protected:
 		{
 			return (m_filter->*m_workFunction)(sample);
 		}
+
+		/** Decimate a block of samples. sOut may be the same buffer as sIn. Returns the number of samples written to sOut */
+		unsigned int workBlock(const Sample* sIn, unsigned int nbIn, Sample* sOut)
+		{
+			unsigned int nbOut = 0;
+
+			for (unsigned int i = 0; i < nbIn; i++)
+			{
+				Sample s(sIn[i]);
+
+				if ((m_filter->*m_workFunction)(&s)) {
+					sOut[nbOut++] = s;
+				}
+			}
+
+			return nbOut;
+		}
+
+		/** Float baseband version of workBlock. The float filter has unity gain so no rescaling is needed afterwards */
+		unsigned int workBlockF(const FSample* sIn, unsigned int nbIn, FSample* sOut)
+		{
+			unsigned int nbOut = 0;
+
+			for (unsigned int i = 0; i < nbIn; i++)
+			{
+				FSample s(sIn[i]);
+
+				if ((m_filterF->*m_workFunctionF)(&s)) {
+					sOut[nbOut++] = s;
+				}
+			}
+
+			return nbOut;
+		}
 	};
 	typedef std::list<FilterStage*> FilterStages;
 	FilterStages m_filterStages;
@@ -105,9 +153,23 @@ protected:
 	int m_currentOutputSampleRate;
 	int m_currentCenterFrequency;
 	SampleVector m_sampleBuffer;
+	SampleVector m_stageBuffer; //!< Decimated samples of the current block when processing stage by stage
+	FSampleVector m_stageBufferF; //!< Same for float baseband
+	bool m_blockProcessing;
+	PolyphaseChannelizer *m_polyphaseChannelizer; //!< Shared device channelizer or 0
+	int m_subband;                 //!< Attached sub-band of m_polyphaseChannelizer or -1
+	SampleSinkFifo m_subbandFifo;  //!< Sub-band samples written by m_polyphaseChannelizer
 	QMutex m_mutex;
 
+	void feedSampleMajor(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	unsigned int feedStageMajor(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	unsigned int feedStageMajorF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+	void feedSubband();
+	void feedSink(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);   //!< feed the demodulator and profile it
+	void feedSinkF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	void applyConfiguration();
+	bool attachSubband();
+	void detachSubband();
 	bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
 	Real createFilterChain(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd);
 	void freeFilterChain();
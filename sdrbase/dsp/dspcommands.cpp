@@ -27,6 +27,7 @@ MESSAGE_CLASS_DEFINITION(DSPGenerationStop, Message)
 MESSAGE_CLASS_DEFINITION(DSPGetSourceDeviceDescription, Message)
 MESSAGE_CLASS_DEFINITION(DSPGetSinkDeviceDescription, Message)
 MESSAGE_CLASS_DEFINITION(DSPGetErrorMessage, Message)
+MESSAGE_CLASS_DEFINITION(DSPGetProfile, Message)
 MESSAGE_CLASS_DEFINITION(DSPSetSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPSetSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddBasebandSampleSink, Message)
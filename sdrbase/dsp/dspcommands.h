@@ -28,6 +28,7 @@ class DeviceSampleSource;
 class BasebandSampleSink;
 class ThreadedBasebandSampleSink;
 class DeviceSampleSink;
+class DSPProfile;
 class BasebandSampleSource;
 class ThreadedBasebandSampleSource;
 class AudioFifo;
@@ -89,6 +90,18 @@ private:
 	QString m_errorMessage;
 };
 
+class SDRBASE_API DSPGetProfile : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPGetProfile(DSPProfile& profile) : Message(), m_profile(profile) { }
+
+	DSPProfile& getProfile() { return m_profile; }
+
+private:
+	DSPProfile& m_profile;
+};
+
 class SDRBASE_API DSPSetSource : public Message {
 	MESSAGE_CLASS_DECLARATION
 
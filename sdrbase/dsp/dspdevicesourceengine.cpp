@@ -22,6 +22,7 @@
 #include <dsp/devicesamplesource.h>
 #include <dsp/downchannelizer.h>
 #include <stdio.h>
+#include <algorithm>
 #include <QDebug>
 #include "dsp/dspcommands.h"
 #include "util/fixed.h"
@@ -35,6 +36,7 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_deviceSampleSource(0),
 	m_sampleSourceSequence(0),
 	m_basebandSampleSinks(),
+	m_offline(false),
 	m_sampleRate(0),
 	m_centerFrequency(0),
 	m_dcOffsetCorrection(false),
@@ -165,6 +167,12 @@ QString DSPDeviceSourceEngine::errorMessage()
 	return cmd.getErrorMessage();
 }
 
+void DSPDeviceSourceEngine::getProfile(DSPProfile& profile)
+{
+	DSPGetProfile cmd(profile);
+	m_syncMessenger.sendWait(cmd);
+}
+
 QString DSPDeviceSourceEngine::sourceDeviceDescription()
 {
 	qDebug() << "DSPDeviceSourceEngine::sourceDeviceDescription";
@@ -262,6 +270,44 @@ void DSPDeviceSourceEngine::iqCorrections(SampleVector::iterator begin, SampleVe
     }
 }
 
+void DSPDeviceSourceEngine::iqCorrectionsF(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection)
+{
+    for(FSampleVector::iterator it = begin; it < end; it++)
+    {
+        m_iBetaF(it->real());
+        m_qBetaF(it->imag());
+
+        float xi = it->m_real - m_iBetaF.asFloat();
+        float xq = it->m_imag - m_qBetaF.asFloat();
+
+        if (imbalanceCorrection)
+        {
+            // phase imbalance
+            m_avgIIF(xi*xi); // <I", I">
+            m_avgIQF(xi*xq); // <I", Q">
+
+            if (m_avgIIF.asDouble() != 0) {
+                m_avgPhiF(m_avgIQF.asDouble()/m_avgIIF.asDouble());
+            }
+
+            float yq = xq - m_avgPhiF.asDouble()*xi;
+
+            // amplitude I/Q imbalance
+            m_avgII2F(xi*xi); // <I, I>
+            m_avgQQ2F(yq*yq); // <Q, Q>
+
+            if (m_avgQQ2F.asDouble() != 0) {
+                m_avgAmpF(sqrt(m_avgII2F.asDouble() / m_avgQQ2F.asDouble()));
+            }
+
+            xq = m_avgAmpF.asDouble() * yq;
+        }
+
+        it->m_real = xi;
+        it->m_imag = xq;
+    }
+}
+
 void DSPDeviceSourceEngine::dcOffset(SampleVector::iterator begin, SampleVector::iterator end)
 {
 	// sum and correct in one pass
@@ -336,7 +382,20 @@ void DSPDeviceSourceEngine::work()
 		SampleVector::iterator part2begin;
 		SampleVector::iterator part2end;
 
-		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
+		std::size_t nbSamples = sampleFifo->fill();
+
+		if (m_offline) // backpressure: never get more than the threaded sinks can take
+		{
+			nbSamples = std::min(nbSamples, (std::size_t) waitThreadedSinksRoom(false));
+
+			if (nbSamples == 0) {
+				break;
+			}
+		}
+
+		std::size_t count = sampleFifo->readBegin(nbSamples, &part1begin, &part1end, &part2begin, &part2end);
+		qint64 start = DSPProfileStage::now();
+		m_profileStage.recordFill(count);
 
 		// first part of FIFO data
 		if (part1begin != part1end)
@@ -358,16 +417,10 @@ void DSPDeviceSourceEngine::work()
 //			}
 
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
-			}
+			feedSinks(part1begin, part1end, positiveOnly);
 
-			// feed data to threaded sinks
-			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
-			}
+			// feed data to threaded sinks. Written once and read by all.
+			m_threadedBasebandSampleSinksFifo.write(part1begin, part1end);
 		}
 
 		// second part of FIFO data (used when block wraps around)
@@ -390,21 +443,132 @@ void DSPDeviceSourceEngine::work()
 //			}
 
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
-			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
+			feedSinks(part2begin, part2end, positiveOnly);
+
+			// feed data to threaded sinks. Written once and read by all.
+			m_threadedBasebandSampleSinksFifo.write(part2begin, part2end);
+		}
+
+		// adjust FIFO pointers
+		sampleFifo->readCommit((unsigned int) count);
+		samplesDone += count;
+		m_profileStage.record(DSPProfileStage::now() - start, count);
+	}
+}
+
+/**
+ * Float baseband counterpart of work(). Sinks are fed with feedF() so that the channelizers and
+ * the demodulators that support it stay in float all along.
+ */
+void DSPDeviceSourceEngine::workF()
+{
+	FSampleSinkFifo* sampleFifo = m_deviceSampleSource->getSampleFifoF();
+	std::size_t samplesDone = 0;
+	bool positiveOnly = false;
+
+	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
+	{
+		FSampleVector::iterator part1begin;
+		FSampleVector::iterator part1end;
+		FSampleVector::iterator part2begin;
+		FSampleVector::iterator part2end;
+
+		std::size_t nbSamples = sampleFifo->fill();
+
+		if (m_offline)
+		{
+			nbSamples = std::min(nbSamples, (std::size_t) waitThreadedSinksRoom(true));
+
+			if (nbSamples == 0) {
+				break;
 			}
+		}
 
-			// feed data to threaded sinks
-			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
+		std::size_t count = sampleFifo->readBegin(nbSamples, &part1begin, &part1end, &part2begin, &part2end);
+		qint64 start = DSPProfileStage::now();
+		m_profileStage.recordFill(count);
+
+		if (part1begin != part1end)
+		{
+			if (m_dcOffsetCorrection) {
+				iqCorrectionsF(part1begin, part1end, m_iqImbalanceCorrection);
 			}
+
+			feedSinksF(part1begin, part1end, positiveOnly);
+
+			m_threadedBasebandSampleSinksFifoF.write(part1begin, part1end);
+		}
+
+		if (part2begin != part2end)
+		{
+			if (m_dcOffsetCorrection) {
+				iqCorrectionsF(part2begin, part2end, m_iqImbalanceCorrection);
+			}
+
+			feedSinksF(part2begin, part2end, positiveOnly);
+
+			m_threadedBasebandSampleSinksFifoF.write(part2begin, part2end);
 		}
 
-		// adjust FIFO pointers
 		sampleFifo->readCommit((unsigned int) count);
 		samplesDone += count;
+		m_profileStage.record(DSPProfileStage::now() - start, count);
+	}
+}
+
+/**
+ * Offline processing only. The threaded sinks are given time to make room in their FIFO rather
+ * than having samples dropped. The engine sleeps until the slowest of them commits a read. If
+ * none does within 100 ms processing is resumed from the event loop so that messages sent to the
+ * engine meanwhile are not held up.
+ */
+uint DSPDeviceSourceEngine::waitThreadedSinksRoom(bool floatBaseband)
+{
+	uint room = floatBaseband ?
+		m_threadedBasebandSampleSinksFifoF.waitRoom(1, 100) :
+		m_threadedBasebandSampleSinksFifo.waitRoom(1, 100);
+
+	if (room > 0) {
+		return room;
+	}
+
+	QMetaObject::invokeMethod(this, "handleData", Qt::QueuedConnection);
+	return 0;
+}
+
+bool DSPDeviceSourceEngine::isDrained() const
+{
+	if (m_deviceSampleSource == 0) {
+		return true;
+	}
+
+	return (m_deviceSampleSource->getSampleFifo()->fill() == 0)
+		&& (m_deviceSampleSource->getSampleFifoF()->fill() == 0)
+		&& m_threadedBasebandSampleSinksFifo.isEmpty()
+		&& m_threadedBasebandSampleSinksFifoF.isEmpty();
+}
+
+void DSPDeviceSourceEngine::feedSinks(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+	{
+		qint64 start = DSPProfileStage::now();
+		(*it)->feed(begin, end, positiveOnly);
+		qint64 elapsed = DSPProfileStage::now() - start;
+		(*it)->getProfileStage().record(elapsed, end - begin);
+		m_profileStage.recordChild(elapsed);
+	}
+}
+
+void DSPDeviceSourceEngine::feedSinksF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+	{
+		qint64 start = DSPProfileStage::now();
+		(*it)->feedF(begin, end, positiveOnly);
+		qint64 elapsed = DSPProfileStage::now() - start;
+		(*it)->getProfileStage().record(elapsed, end - begin);
+		m_profileStage.recordChild(elapsed);
 	}
 }
 
@@ -449,6 +613,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoIdle()
 	m_deviceSampleSource->stop();
 	m_deviceDescription.clear();
 	m_sampleRate = 0;
+	m_profileStage.setSampleRate(0);
 
 	return StIdle;
 }
@@ -485,6 +650,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 	m_deviceDescription = m_deviceSampleSource->getDeviceDescription();
 	m_centerFrequency = m_deviceSampleSource->getCenterFrequency();
 	m_sampleRate = m_deviceSampleSource->getSampleRate();
+	m_profileStage.setSampleRate(m_sampleRate);
 
 	qDebug() << "DSPDeviceSourceEngine::gotoInit: "
 	        << " m_deviceDescription: " << m_deviceDescription.toStdString().c_str()
@@ -590,6 +756,7 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
+		connect(m_deviceSampleSource->getSampleFifoF(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
 	}
 	else
 	{
@@ -602,6 +769,7 @@ void DSPDeviceSourceEngine::handleData()
 	if(m_state == StRunning)
 	{
 		work();
+		workF();
 	}
 }
 
@@ -636,6 +804,20 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		((DSPGetErrorMessage*) message)->setErrorMessage(m_errorMessage);
 	}
+	else if (DSPGetProfile::match(*message))
+	{
+		DSPProfile& profile = ((DSPGetProfile*) message)->getProfile();
+		m_profileStage.setName(QString("DSPDeviceSourceEngine(%1)").arg(m_deviceDescription));
+		profile.addStage(m_profileStage, DSPProfile::StageEngine);
+
+		for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it) {
+			(*it)->getProfileStages(profile, DSPProfile::StageSink);
+		}
+
+		for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it) {
+			(*it)->getProfileStages(profile);
+		}
+	}
 	else if (DSPSetSource::match(*message)) {
 		handleSetSource(((DSPSetSource*) message)->getSampleSource());
 	}
@@ -665,6 +847,8 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		ThreadedBasebandSampleSink *threadedSink = ((DSPAddThreadedBasebandSampleSink*) message)->getThreadedSampleSink();
 		m_threadedBasebandSampleSinks.push_back(threadedSink);
+		threadedSink->setBroadcastFifo(&m_threadedBasebandSampleSinksFifo);
+		threadedSink->setBroadcastFifoF(&m_threadedBasebandSampleSinksFifoF);
 		// initialize sample rate and center frequency in the sink:
 		DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
 		threadedSink->handleSinkMessage(msg);
@@ -677,6 +861,8 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		ThreadedBasebandSampleSink* threadedSink = ((DSPRemoveThreadedBasebandSampleSink*) message)->getThreadedSampleSink();
 		threadedSink->stop();
+		threadedSink->setBroadcastFifo(0);
+		threadedSink->setBroadcastFifoF(0);
 		m_threadedBasebandSampleSinks.remove(threadedSink);
 	}
 
@@ -729,6 +915,7 @@ void DSPDeviceSourceEngine::handleInputMessages()
 			// update DSP values
 
 			m_sampleRate = notif->getSampleRate();
+			m_profileStage.setSampleRate(m_sampleRate);
 			m_centerFrequency = notif->getCenterFrequency();
 
 			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
@@ -25,6 +25,9 @@
 #include <QWaitCondition>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/samplesinkbroadcastfifo.h"
+#include "dsp/fsamplesinkbroadcastfifo.h"
+#include "dsp/dspprofile.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "export.h"
@@ -76,6 +79,9 @@ public:
 
 	QString errorMessage(); //!< Return the current error message
 	QString sourceDeviceDescription(); //!< Return the source device description
+	void getProfile(DSPProfile& profile); //!< Snapshot of the processing counters of the engine and its sinks
+	void setOffline(bool offline) { m_offline = offline; } //!< wait for the threaded sinks instead of dropping samples. Set before starting acquisition
+	bool isDrained() const; //!< nothing left to process in the source and threaded sinks FIFOs (approximate when called from another thread)
 
 private:
 	uint m_uid; //!< unique ID
@@ -96,7 +102,11 @@ private:
 
 	typedef std::list<ThreadedBasebandSampleSink*> ThreadedBasebandSampleSinks;
 	ThreadedBasebandSampleSinks m_threadedBasebandSampleSinks; //!< sample sinks on their own threads (usually channels)
+	SampleSinkBroadcastFifo m_threadedBasebandSampleSinksFifo; //!< samples are written once here for all threaded sinks
+	FSampleSinkBroadcastFifo m_threadedBasebandSampleSinksFifoF; //!< same for float baseband sources
+	DSPProfileStage m_profileStage; //!< engine processing counters
 
+	bool m_offline; //!< backpressure from the threaded sinks when processing recordings offline
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
 
@@ -126,6 +136,16 @@ private:
     MovingAverageUtil<double, double, 128> m_avgAmp;
 #endif
 
+    // Float baseband DC + IQ corrections
+    MovingAverageUtil<float, double, 1024> m_iBetaF;
+    MovingAverageUtil<float, double, 1024> m_qBetaF;
+    MovingAverageUtil<float, double, 128> m_avgIIF;
+    MovingAverageUtil<float, double, 128> m_avgIQF;
+    MovingAverageUtil<float, double, 128> m_avgII2F;
+    MovingAverageUtil<float, double, 128> m_avgQQ2F;
+    MovingAverageUtil<double, double, 128> m_avgPhiF;
+    MovingAverageUtil<double, double, 128> m_avgAmpF;
+
     qint32 m_iRange;
 	qint32 m_qRange;
 	qint32 m_imbalance;
@@ -135,7 +155,12 @@ private:
 	void iqCorrections(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection);
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
+	void iqCorrectionsF(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection);
 	void work(); //!< transfer samples from source to sinks if in running state
+	void workF(); //!< same for the float baseband FIFO of the source
+	uint waitThreadedSinksRoom(bool floatBaseband); //!< offline: wait for room in the threaded sinks FIFO. 0 if processing has to be resumed later
+	void feedSinks(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly); //!< feed and profile the direct sinks
+	void feedSinksF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
@@ -31,6 +31,7 @@ DSPEngine::DSPEngine() :
     m_audioOutputDeviceIndex(-1)    // default device
 {
 	m_dvSerialSupport = false;
+	m_offline = false;
     m_masterTimer.start(50);
 }
 
@@ -55,6 +56,7 @@ DSPDeviceSourceEngine *DSPEngine::addDeviceSourceEngine()
 {
     m_deviceSourceEngines.push_back(new DSPDeviceSourceEngine(m_deviceSourceEnginesUIDSequence));
     m_deviceSourceEnginesUIDSequence++;
+    m_deviceSourceEngines.back()->setOffline(m_offline);
     return m_deviceSourceEngines.back();
 }
 
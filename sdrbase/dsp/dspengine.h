@@ -74,6 +74,9 @@ public:
 
     const QTimer& getMasterTimer() const { return m_masterTimer; }
 
+    void setOffline(bool offline) { m_offline = offline; } //!< recordings are processed as fast as the DSP chain can go instead of in real time
+    bool isOffline() const { return m_offline; }
+
 private:
 	std::vector<DSPDeviceSourceEngine*> m_deviceSourceEngines;
 	uint m_deviceSourceEnginesUIDSequence;
@@ -84,6 +87,7 @@ private:
     int m_audioOutputDeviceIndex;
     QTimer m_masterTimer;
 	bool m_dvSerialSupport;
+	bool m_offline;
 #ifdef DSD_USE_SERIALDV
 	DVSerialEngine m_dvSerialEngine;
 #endif
@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "dspprofile.h"
+
+DSPProfileStage::DSPProfileStage() :
+    m_calls(0),
+    m_samples(0),
+    m_busy(0),
+    m_childBusy(0),
+    m_fillSum(0),
+    m_fillCount(0),
+    m_sampleRate(0)
+{
+    qint64 time = now();
+
+    for (int i = 0; i < NbConsumers; i++)
+    {
+        m_busyMax[i].store(0);
+        m_fillHighWater[i].store(0);
+        m_last[i].m_time = time;
+        m_last[i].m_calls = 0;
+        m_last[i].m_samples = 0;
+        m_last[i].m_busy = 0;
+        m_last[i].m_childBusy = 0;
+        m_last[i].m_fillSum = 0;
+        m_last[i].m_fillCount = 0;
+    }
+}
+
+void DSPProfileStage::setName(const QString& name)
+{
+    QMutexLocker mutexLocker(&m_snapshotMutex);
+    m_name = name;
+}
+
+void DSPProfileStage::record(qint64 elapsed, quint32 nbSamples)
+{
+    quint64 busy = elapsed < 0 ? 0 : elapsed;
+    m_calls.fetchAndAddRelaxed(1);
+    m_samples.fetchAndAddRelaxed(nbSamples);
+    m_busy.fetchAndAddRelaxed(busy);
+
+    for (int i = 0; i < NbConsumers; i++)
+    {
+        quint64 busyMax = m_busyMax[i].load();
+
+        // the reader may reset the maximum concurrently
+        while ((busy > busyMax) && !m_busyMax[i].testAndSetRelaxed(busyMax, busy)) {
+            busyMax = m_busyMax[i].load();
+        }
+    }
+}
+
+void DSPProfileStage::recordChild(qint64 elapsed)
+{
+    m_childBusy.fetchAndAddRelaxed(elapsed < 0 ? 0 : elapsed);
+}
+
+void DSPProfileStage::recordFill(quint32 fill)
+{
+    m_fillSum.fetchAndAddRelaxed(fill);
+    m_fillCount.fetchAndAddRelaxed(1);
+
+    for (int i = 0; i < NbConsumers; i++)
+    {
+        quint32 fillHighWater = m_fillHighWater[i].load();
+
+        while ((fill > fillHighWater) && !m_fillHighWater[i].testAndSetRelaxed(fillHighWater, fill)) {
+            fillHighWater = m_fillHighWater[i].load();
+        }
+    }
+}
+
+void DSPProfileStage::snapshot(Snapshot& snapshot, int consumer)
+{
+    if ((consumer < 0) || (consumer >= NbConsumers)) {
+        consumer = ConsumerAPI;
+    }
+
+    QMutexLocker mutexLocker(&m_snapshotMutex);
+    LastSnapshot& last = m_last[consumer];
+    qint64 time = now();
+    quint64 calls = m_calls.load();
+    quint64 samples = m_samples.load();
+    quint64 busy = m_busy.load();
+    quint64 childBusy = m_childBusy.load();
+    quint64 fillSum = m_fillSum.load();
+    quint32 fillCount = m_fillCount.load();
+
+    quint64 deltaCalls = calls - last.m_calls;
+    quint64 deltaBusy = busy - last.m_busy;
+    quint64 deltaChildBusy = childBusy - last.m_childBusy;
+    quint32 deltaFillCount = fillCount - last.m_fillCount;
+    float interval = (time - last.m_time) / 1e9f;
+
+    if (deltaChildBusy > deltaBusy) { // counters are not read atomically as a whole
+        deltaChildBusy = deltaBusy;
+    }
+
+    snapshot.m_name = m_name;
+    snapshot.m_calls = calls;
+    snapshot.m_samples = samples;
+    snapshot.m_interval = interval;
+    snapshot.m_samplesPerSecond = interval > 0.0f ? (samples - last.m_samples) / interval : 0.0f;
+    snapshot.m_load = interval > 0.0f ? ((deltaBusy - deltaChildBusy) / 1e9f) / interval : 0.0f;
+    snapshot.m_timeAvg = deltaCalls == 0 ? 0.0f : (deltaBusy / (float) deltaCalls) / 1000.0f;
+    snapshot.m_timeMax = m_busyMax[consumer].fetchAndStoreRelaxed(0) / 1000.0f;
+    snapshot.m_fillAvg = deltaFillCount == 0 ? 0 : (fillSum - last.m_fillSum) / deltaFillCount;
+    snapshot.m_fillHighWater = m_fillHighWater[consumer].fetchAndStoreRelaxed(0);
+    snapshot.m_sampleRate = m_sampleRate.load();
+
+    last.m_time = time;
+    last.m_calls = calls;
+    last.m_samples = samples;
+    last.m_busy = busy;
+    last.m_childBusy = childBusy;
+    last.m_fillSum = fillSum;
+    last.m_fillCount = fillCount;
+}
+
+void DSPProfile::addStage(DSPProfileStage& stage, StageType type)
+{
+    m_stages.push_back(DSPProfileStage::Snapshot());
+    stage.snapshot(m_stages.back(), m_consumer);
+    m_stages.back().m_type = (int) type;
+}
+
+void DSPProfile::estimateLatency(float& latencyAvg, float& latencyMax) const
+{
+    float engineAvg = 0.0f, engineMax = 0.0f;
+    float sinkAvg = 0.0f, sinkMax = 0.0f;
+    float audioAvg = 0.0f, audioMax = 0.0f;
+    quint32 deviceSampleRate = 0;
+
+    for (std::vector<DSPProfileStage::Snapshot>::const_iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+        switch (it->m_type)
+        {
+        case StageEngine:
+            deviceSampleRate = it->m_sampleRate;
+
+            if (deviceSampleRate != 0)
+            {
+                engineAvg = (it->m_fillAvg * 1000.0f) / deviceSampleRate;
+                engineMax = (it->m_fillHighWater * 1000.0f) / deviceSampleRate;
+            }
+
+            engineAvg += it->m_timeAvg / 1000.0f;
+            engineMax += it->m_timeMax / 1000.0f;
+            break;
+        case StageSink:
+            if (deviceSampleRate != 0)
+            {
+                sinkAvg = std::max(sinkAvg, (it->m_fillAvg * 1000.0f) / deviceSampleRate + it->m_timeAvg / 1000.0f);
+                sinkMax = std::max(sinkMax, (it->m_fillHighWater * 1000.0f) / deviceSampleRate + it->m_timeMax / 1000.0f);
+            }
+            break;
+        case StageAudio:
+            if (it->m_sampleRate != 0)
+            {
+                audioAvg = std::max(audioAvg, (it->m_fillAvg * 1000.0f) / it->m_sampleRate);
+                audioMax = std::max(audioMax, (it->m_fillHighWater * 1000.0f) / it->m_sampleRate);
+            }
+            break;
+        default: // channel stages time is included in their sink time
+            break;
+        }
+    }
+
+    latencyAvg = engineAvg + sinkAvg + audioAvg;
+    latencyMax = engineMax + sinkMax + audioMax;
+}
+
+QString DSPProfile::toString() const
+{
+    QString str = QString("%1 %2 %3 %4 %5 %6 %7\n")
+        .arg("Stage", -48)
+        .arg("kS/s", 10)
+        .arg("load%", 7)
+        .arg("avg us", 10)
+        .arg("max us", 10)
+        .arg("fill", 9)
+        .arg("fill max", 9);
+
+    for (std::vector<DSPProfileStage::Snapshot>::const_iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+    {
+        QString name = it->m_type == StageSink ? "  " + it->m_name : it->m_type == StageChannel ? "    " + it->m_name : it->m_name;
+        str += QString("%1 %2 %3 %4 %5 %6 %7\n")
+            .arg(name.left(48), -48)
+            .arg(it->m_samplesPerSecond / 1000.0f, 10, 'f', 1)
+            .arg(it->m_load * 100.0f, 7, 'f', 1)
+            .arg(it->m_timeAvg, 10, 'f', 1)
+            .arg(it->m_timeMax, 10, 'f', 1)
+            .arg(it->m_fillAvg, 9)
+            .arg(it->m_fillHighWater, 9);
+    }
+
+    float latencyAvg, latencyMax;
+    estimateLatency(latencyAvg, latencyMax);
+    str += QString("Latency estimate: avg %1 ms max %2 ms").arg(latencyAvg, 0, 'f', 1).arg(latencyMax, 0, 'f', 1);
+
+    return str;
+}
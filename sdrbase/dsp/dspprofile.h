@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DSPPROFILE_H_
+#define SDRBASE_DSP_DSPPROFILE_H_
+
+#include <vector>
+#include <chrono>
+
+#include <QString>
+#include <QMutex>
+#include <QAtomicInteger>
+
+#include "export.h"
+
+/**
+ * Processing counters of one DSP stage (device engine, channelizer, demodulator, audio output...).
+ * Counters are written by the single thread running the stage with relaxed atomic operations
+ * only so that recording costs a few additions per processed block. They can be read at any time
+ * from any thread with snapshot(). Rates, load and maximums are given over the interval since
+ * the previous snapshot of the same consumer so that the periodic log and the REST API do not
+ * shorten each other's intervals.
+ */
+class SDRBASE_API DSPProfileStage
+{
+public:
+    enum Consumer
+    {
+        ConsumerLog, //!< periodic dump in the log
+        ConsumerAPI, //!< REST API requests
+        NbConsumers
+    };
+
+    struct Snapshot
+    {
+        QString m_name;
+        int m_type;               //!< DSPProfile::StageType
+        quint64 m_calls;          //!< number of processed blocks since start
+        quint64 m_samples;        //!< number of input samples since start
+        float m_interval;         //!< seconds covered by the figures below
+        float m_samplesPerSecond; //!< input samples rate
+        float m_load;             //!< fraction of one core used by this stage excluding the stages it feeds
+        float m_timeAvg;          //!< average time per block in microseconds including the stages it feeds
+        float m_timeMax;          //!< maximum time per block in microseconds including the stages it feeds
+        quint32 m_fillAvg;        //!< average input queue fill in samples when a block is taken
+        quint32 m_fillHighWater;  //!< maximum input queue fill in samples when a block is taken
+        quint32 m_sampleRate;     //!< nominal input sample rate in S/s or 0 if not known by the stage
+    };
+
+    DSPProfileStage();
+
+    void setName(const QString& name);
+    void setSampleRate(quint32 sampleRate) { m_sampleRate.store(sampleRate); }
+
+    /** Monotonic time in nanoseconds to time the stages */
+    static qint64 now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void record(qint64 elapsed, quint32 nbSamples); //!< one block of nbSamples processed in elapsed ns
+    void recordChild(qint64 elapsed);               //!< elapsed ns of record() spent in the stages fed by this one
+    void recordFill(quint32 fill);                  //!< input queue fill when a block is taken
+
+    void snapshot(Snapshot& snapshot, int consumer = ConsumerAPI);
+
+private:
+    QAtomicInteger<quint64> m_calls;
+    QAtomicInteger<quint64> m_samples;
+    QAtomicInteger<quint64> m_busy;      //!< ns
+    QAtomicInteger<quint64> m_childBusy; //!< ns
+    QAtomicInteger<quint64> m_busyMax[NbConsumers]; //!< ns reset at each snapshot of the consumer
+    QAtomicInteger<quint64> m_fillSum;
+    QAtomicInteger<quint32> m_fillCount;
+    QAtomicInteger<quint32> m_fillHighWater[NbConsumers]; //!< reset at each snapshot of the consumer
+    QAtomicInteger<quint32> m_sampleRate;
+
+    // reader side
+    struct LastSnapshot
+    {
+        qint64 m_time;
+        quint64 m_calls;
+        quint64 m_samples;
+        quint64 m_busy;
+        quint64 m_childBusy;
+        quint64 m_fillSum;
+        quint32 m_fillCount;
+    };
+
+    QMutex m_snapshotMutex;
+    QString m_name;
+    LastSnapshot m_last[NbConsumers];
+};
+
+/**
+ * Snapshots of the stages of a device set in processing order with an estimation of the
+ * end to end latency. The latency is the sum of the time spent in the queues, deduced from
+ * their fill and sample rate, and the processing time of the slowest path:
+ * device FIFO -> engine -> sink FIFO -> sink (channelizer and demodulator) -> audio FIFO and buffer
+ */
+class SDRBASE_API DSPProfile
+{
+public:
+    enum StageType
+    {
+        StageEngine,  //!< device engine reading the device FIFO
+        StageSink,    //!< sink fed by the device engine
+        StageChannel, //!< sink fed by another sink (demodulator behind a channelizer)
+        StageAudio    //!< audio output mixing the audio FIFOs
+    };
+
+    DSPProfile(int consumer = DSPProfileStage::ConsumerAPI) : m_consumer(consumer) {}
+
+    int getConsumer() const { return m_consumer; }
+    void clear() { m_stages.clear(); }
+    void addStage(DSPProfileStage& stage, StageType type);
+    const std::vector<DSPProfileStage::Snapshot>& getStages() const { return m_stages; }
+
+    void estimateLatency(float& latencyAvg, float& latencyMax) const; //!< device to audio latency estimates in milliseconds
+    QString toString() const; //!< printable table
+
+private:
+    int m_consumer; //!< DSPProfileStage::Consumer taking the snapshots
+    std::vector<DSPProfileStage::Snapshot> m_stages;
+};
+
+#endif // SDRBASE_DSP_DSPPROFILE_H_
@@ -9,10 +9,18 @@ public:
 	virtual ~FFTEngine();
 
 	virtual void configure(int n, bool inverse) = 0;
+	/**
+	 * Real transform of n (even) samples. Forward: n real samples in realIn() give the
+	 * n/2+1 non negative frequency bins in out(). Inverse: the n/2+1 bins in in() give
+	 * n real samples in realOut(). Transforms are not normalized.
+	 */
+	virtual void configureReal(int n, bool inverse) = 0;
 	virtual void transform() = 0;
 
 	virtual Complex* in() = 0;
 	virtual Complex* out() = 0;
+	virtual Real* realIn() = 0;
+	virtual Real* realOut() = 0;
 
 	static FFTEngine* create();
 };
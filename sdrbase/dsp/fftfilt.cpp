@@ -34,6 +34,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <typeinfo>
+#include <vector>
 
 #include <stdio.h>
 #include <sys/types.h>
@@ -41,6 +42,7 @@
 
 #include <dsp/misc.h>
 #include <dsp/fftfilt.h>
+#include <dsp/fftengine.h>
 
 //------------------------------------------------------------------------------
 // initialize the filter
@@ -400,6 +402,207 @@ int fftfilt::runAsym(const cmplx & in, cmplx **out, bool usb)
     return flen2;
 }
 
+//------------------------------------------------------------------------------
+// real signal fast convolution filter
+// same filters as fftfilt computed with real FFTs
+//------------------------------------------------------------------------------
+
+void rfftfilt::init_filter()
+{
+	flen2 = flen >> 1;
+	fwdFFT = FFTEngine::create();
+	fwdFFT->configureReal(flen, false);
+	invFFT = 0;
+	invRealFFT = 0;
+
+	filter = new cmplx[flen2 + 1];
+	std::fill(filter, filter + flen2 + 1, 0);
+	std::fill(fwdFFT->realIn(), fwdFFT->realIn() + flen, 0); // the second half is the zero padding
+	ovlbuf = 0;
+	output = 0;
+	ovlbufReal = 0;
+	outputReal = 0;
+
+	inptr = 0;
+}
+
+rfftfilt::rfftfilt(float f1, float f2, int len)
+{
+	flen = len;
+	init_filter();
+	create_filter(f1, f2);
+}
+
+rfftfilt::rfftfilt(float f2, int len)
+{
+	flen = len;
+	init_filter();
+	create_dsb_filter(f2);
+}
+
+rfftfilt::~rfftfilt()
+{
+	delete fwdFFT;
+	delete invFFT;
+	delete invRealFFT;
+	delete[] filter;
+	delete[] ovlbuf;
+	delete[] output;
+	delete[] ovlbufReal;
+	delete[] outputReal;
+}
+
+// spectrum of the impulse response normalized for unity gain including the 1/flen
+// scaling of the inverse transforms
+void rfftfilt::set_filter(float *impulse)
+{
+	FFTEngine *fft = FFTEngine::create(); // not fwdFFT that holds the input samples
+	fft->configureReal(flen, false);
+	std::copy(impulse, impulse + flen, fft->realIn());
+	fft->transform();
+	cmplx *spectrum = fft->out();
+
+	float scale = 0, mag;
+	for (int i = 0; i < flen2; i++) {
+		mag = abs(spectrum[i]);
+		if (mag > scale) scale = mag;
+	}
+
+	scale = (scale != 0 ? scale : 1.0f) * flen;
+
+	for (int i = 0; i <= flen2; i++)
+		filter[i] = spectrum[i] / scale;
+
+	delete fft;
+}
+
+void rfftfilt::create_filter(float f1, float f2)
+{
+	std::vector<float> impulse(flen, 0.0f);
+
+	bool b_lowpass, b_highpass;
+	b_lowpass = (f2 != 0);
+	b_highpass = (f1 != 0);
+
+	for (int i = 0; i < flen2; i++) {
+		if (b_lowpass)
+			impulse[i] += fftfilt::fsinc(f2, i, flen2);
+		if (b_highpass)
+			impulse[i] -= fftfilt::fsinc(f1, i, flen2);
+	}
+	if (b_highpass && f2 < f1)
+		impulse[flen2 / 2] += 1;
+
+	for (int i = 0; i < flen2; i++)
+		impulse[i] *= fftfilt::_blackman(i, flen2);
+
+	set_filter(&impulse[0]);
+}
+
+void rfftfilt::create_dsb_filter(float f2)
+{
+	std::vector<float> impulse(flen, 0.0f);
+
+	for (int i = 0; i < flen2; i++)
+		impulse[i] = fftfilt::fsinc(f2, i, flen2) * fftfilt::_blackman(i, flen2);
+
+	set_filter(&impulse[0]);
+}
+
+// Single sideband of a real signal: the kept sideband is rebuilt from the non negative frequencies
+int rfftfilt::runSSB(float in, cmplx **out, bool usb, bool getDC)
+{
+	fwdFFT->realIn()[inptr++] = in;
+	if (inptr < flen2)
+		return 0;
+	inptr = 0;
+
+	if (!invFFT)
+	{
+		invFFT = FFTEngine::create();
+		invFFT->configure(flen, true);
+		ovlbuf = new cmplx[flen2];
+		output = new cmplx[flen2];
+		std::fill(ovlbuf, ovlbuf + flen2, 0);
+	}
+
+	fwdFFT->transform();
+	cmplx *spectrum = fwdFFT->out();
+	cmplx *data = invFFT->in();
+
+	// get or reject DC component. Nyquist bin is not filtered as in fftfilt
+	data[0] = getDC ? spectrum[0]*filter[0] : 0;
+	data[flen2] = spectrum[flen2] / (float) flen;
+
+	if (usb)
+	{
+		for (int i = 1; i < flen2; i++) {
+			data[i] = spectrum[i] * filter[i];
+			data[flen2 + i] = 0;
+		}
+	}
+	else
+	{
+		// negative frequencies are the conjugates of the positive ones
+		for (int i = 1; i < flen2; i++) {
+			data[i] = 0;
+			data[flen2 + i] = std::conj(spectrum[flen2 - i] * filter[flen2 - i]);
+		}
+	}
+
+	invFFT->transform();
+	data = invFFT->out();
+
+	// overlap and add
+	for (int i = 0; i < flen2; i++) {
+		output[i] = ovlbuf[i] + data[i];
+		ovlbuf[i] = data[i+flen2];
+	}
+
+	*out = output;
+	return flen2;
+}
+
+// Double sideband of a real signal is real. You have to double the FFT size used for SSB.
+int rfftfilt::runDSB(float in, float **out, bool getDC)
+{
+	fwdFFT->realIn()[inptr++] = in;
+	if (inptr < flen2)
+		return 0;
+	inptr = 0;
+
+	if (!invRealFFT)
+	{
+		invRealFFT = FFTEngine::create();
+		invRealFFT->configureReal(flen, true);
+		ovlbufReal = new float[flen2];
+		outputReal = new float[flen2];
+		std::fill(ovlbufReal, ovlbufReal + flen2, 0);
+	}
+
+	fwdFFT->transform();
+	cmplx *spectrum = fwdFFT->out();
+	cmplx *data = invRealFFT->in();
+
+	for (int i = 0; i <= flen2; i++)
+		data[i] = spectrum[i] * filter[i];
+
+	// get or reject DC component
+	data[0] = getDC ? data[0] : 0;
+
+	invRealFFT->transform();
+	float *samples = invRealFFT->realOut();
+
+	// overlap and add
+	for (int i = 0; i < flen2; i++) {
+		outputReal[i] = ovlbufReal[i] + samples[i];
+		ovlbufReal[i] = samples[i+flen2];
+	}
+
+	*out = outputReal;
+	return flen2;
+}
+
 /* Sliding FFT from Fldigi */
 
 struct sfft::vrot_bins_pair {
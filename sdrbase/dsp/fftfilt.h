@@ -9,6 +9,8 @@
 #include "gfft.h"
 #include "export.h"
 
+class FFTEngine;
+
 #undef M_PI
 #define M_PI 3.14159265358979323846
 
@@ -49,14 +51,14 @@ protected:
 	int pass;
 	int window;
 
-	inline float fsinc(float fc, int i, int len)
+	static inline float fsinc(float fc, int i, int len)
 	{
 	    int len2 = len/2;
 		return (i == len2) ? 2.0 * fc:
 				sin(2 * M_PI * fc * (i - len2)) / (M_PI * (i - len2));
 	}
 
-	inline float _blackman(int i, int len)
+	static inline float _blackman(int i, int len)
 	{
 		return (0.42 -
 				 0.50 * cos(2.0 * M_PI * i / len) +
@@ -88,6 +90,44 @@ protected:
 
 	void init_filter();
 	void init_dsb_filter();
+
+	friend class rfftfilt;
+};
+
+
+
+/* Fast convolution filter of real signals. Same filters as fftfilt on real transforms of
+ * half the size so that the forward FFT and the spectrum storage are halved. The DSB output
+ * is real and uses a real inverse FFT as well. */
+class SDRBASE_API rfftfilt {
+public:
+	typedef std::complex<float> cmplx;
+
+	rfftfilt(float f1, float f2, int len);
+	rfftfilt(float f2, int len);
+	~rfftfilt();
+
+	void create_filter(float f1, float f2);
+	void create_dsb_filter(float f2);
+
+	int runSSB(float in, cmplx **out, bool usb, bool getDC = true);
+	int runDSB(float in, float **out, bool getDC = true);
+
+protected:
+	int flen;
+	int flen2;
+	FFTEngine *fwdFFT;     //!< real forward FFT of the input
+	FFTEngine *invFFT;     //!< complex inverse FFT for SSB
+	FFTEngine *invRealFFT; //!< real inverse FFT for DSB
+	cmplx *filter;         //!< flen2+1 bins of non negative frequencies
+	cmplx *ovlbuf;
+	cmplx *output;
+	float *ovlbufReal;
+	float *outputReal;
+	int inptr;
+
+	void init_filter();
+	void set_filter(float *impulse);
 };
 
 
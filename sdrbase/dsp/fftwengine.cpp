@@ -1,4 +1,5 @@
-#include <QTime>
+#include <string.h>
+
 #include "dsp/fftwengine.h"
 
 FFTWEngine::FFTWEngine() :
@@ -13,32 +14,47 @@ FFTWEngine::~FFTWEngine()
 }
 
 void FFTWEngine::configure(int n, bool inverse)
+{
+	selectPlan(n, inverse, false);
+}
+
+void FFTWEngine::configureReal(int n, bool inverse)
+{
+	selectPlan(n, inverse, true);
+}
+
+void FFTWEngine::selectPlan(int n, bool inverse, bool real)
 {
 	for(Plans::const_iterator it = m_plans.begin(); it != m_plans.end(); ++it) {
-		if(((*it)->n == n) && ((*it)->inverse == inverse)) {
+		if(((*it)->n == n) && ((*it)->inverse == inverse) && ((*it)->real == real)) {
 			m_currentPlan = *it;
 			return;
 		}
 	}
 
+	// real plans use the first n floats or n/2+1 complex of the arrays
 	m_currentPlan = new Plan;
 	m_currentPlan->n = n;
 	m_currentPlan->inverse = inverse;
+	m_currentPlan->real = real;
 	m_currentPlan->in = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
 	m_currentPlan->out = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
-	QTime t;
-	t.start();
-	m_globalPlanMutex.lock();
-	m_currentPlan->plan = fftwf_plan_dft_1d(n, m_currentPlan->in, m_currentPlan->out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
-	m_globalPlanMutex.unlock();
-	qDebug("FFT: creating FFTW plan (n=%d,%s) took %dms", n, inverse ? "inverse" : "forward", t.elapsed());
+	memset(m_currentPlan->in, 0, sizeof(fftwf_complex) * n);
+	m_currentPlan->plan = FFTWPlanCache::instance()->getPlan(n, inverse, fftwf_alignment_of((float*) m_currentPlan->in), real);
 	m_plans.push_back(m_currentPlan);
 }
 
 void FFTWEngine::transform()
 {
-	if(m_currentPlan != NULL)
-		fftwf_execute(m_currentPlan->plan);
+	if(m_currentPlan == NULL)
+		return;
+
+	if(!m_currentPlan->real)
+		m_currentPlan->plan->execute(m_currentPlan->in, m_currentPlan->out);
+	else if(m_currentPlan->inverse)
+		m_currentPlan->plan->executeC2R(m_currentPlan->in, (float*) m_currentPlan->out);
+	else
+		m_currentPlan->plan->executeR2C((float*) m_currentPlan->in, m_currentPlan->out);
 }
 
 Complex* FFTWEngine::in()
@@ -55,12 +71,23 @@ Complex* FFTWEngine::out()
 	else return NULL;
 }
 
-QMutex FFTWEngine::m_globalPlanMutex;
+Real* FFTWEngine::realIn()
+{
+	if(m_currentPlan != NULL)
+		return reinterpret_cast<Real*>(m_currentPlan->in);
+	else return NULL;
+}
+
+Real* FFTWEngine::realOut()
+{
+	if(m_currentPlan != NULL)
+		return reinterpret_cast<Real*>(m_currentPlan->out);
+	else return NULL;
+}
 
 void FFTWEngine::freeAll()
 {
 	for(Plans::iterator it = m_plans.begin(); it != m_plans.end(); ++it) {
-		fftwf_destroy_plan((*it)->plan);
 		fftwf_free((*it)->in);
 		fftwf_free((*it)->out);
 		delete *it;
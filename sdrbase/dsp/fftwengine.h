@@ -1,10 +1,10 @@
 #ifndef INCLUDE_FFTWENGINE_H
 #define INCLUDE_FFTWENGINE_H
 
-#include <QMutex>
 #include <fftw3.h>
 #include <list>
 #include "dsp/fftengine.h"
+#include "dsp/fftwplancache.h"
 #include "export.h"
 
 class SDRBASE_API FFTWEngine : public FFTEngine {
@@ -13,18 +13,20 @@ public:
 	~FFTWEngine();
 
 	void configure(int n, bool inverse);
+	void configureReal(int n, bool inverse);
 	void transform();
 
 	Complex* in();
 	Complex* out();
+	Real* realIn();
+	Real* realOut();
 
 protected:
-	static QMutex m_globalPlanMutex;
-
 	struct Plan {
 		int n;
 		bool inverse;
-		fftwf_plan plan;
+		bool real;
+		const FFTWPlanCache::Plan* plan; //!< shared plan executed on this engine arrays
 		fftwf_complex* in;
 		fftwf_complex* out;
 	};
@@ -32,6 +34,7 @@ protected:
 	Plans m_plans;
 	Plan* m_currentPlan;
 
+	void selectPlan(int n, bool inverse, bool real);
 	void freeAll();
 };
 
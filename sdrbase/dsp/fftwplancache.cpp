@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QGlobalStatic>
+#include <QStandardPaths>
+#include <QDir>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include "fftwplancache.h"
+
+const double FFTWPlanCache::m_optimizeTimeLimit = 0.5;
+
+Q_GLOBAL_STATIC(FFTWPlanCache, fftwPlanCache)
+FFTWPlanCache *FFTWPlanCache::instance()
+{
+    return fftwPlanCache;
+}
+
+bool FFTWPlanCache::Key::operator<(const Key& other) const
+{
+    if (n != other.n) {
+        return n < other.n;
+    } else if (inverse != other.inverse) {
+        return inverse < other.inverse;
+    } else if (real != other.real) {
+        return real < other.real;
+    } else {
+        return alignment < other.alignment;
+    }
+}
+
+FFTWPlanCache::FFTWPlanCache() :
+    m_running(false),
+    m_wisdomChanged(false)
+{
+    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+
+    if (!dataDir.isEmpty()) {
+        m_wisdomFileName = dataDir + "/fftw-wisdom";
+    }
+
+    loadWisdom();
+}
+
+FFTWPlanCache::~FFTWPlanCache()
+{
+    m_mutex.lock();
+    m_running = false;
+    m_jobs.clear();
+    m_jobCondition.wakeAll();
+    m_mutex.unlock();
+    wait();
+
+    saveWisdom();
+
+    for (Plans::iterator it = m_plans.begin(); it != m_plans.end(); ++it)
+    {
+        Plan *plan = it->second;
+        fftwf_destroy_plan(plan->m_plan.load());
+
+        for (std::vector<fftwf_plan>::iterator rit = plan->m_retired.begin(); rit != plan->m_retired.end(); ++rit) {
+            fftwf_destroy_plan(*rit);
+        }
+
+        delete plan;
+    }
+}
+
+void FFTWPlanCache::loadWisdom()
+{
+    if (m_wisdomFileName.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker plannerLocker(&m_plannerMutex);
+
+    if (fftwf_import_wisdom_from_filename(m_wisdomFileName.toStdString().c_str())) {
+        qDebug("FFTWPlanCache::loadWisdom: loaded %s", qPrintable(m_wisdomFileName));
+    } else {
+        qDebug("FFTWPlanCache::loadWisdom: no wisdom in %s", qPrintable(m_wisdomFileName));
+    }
+}
+
+void FFTWPlanCache::saveWisdom()
+{
+    QMutexLocker plannerLocker(&m_plannerMutex);
+
+    if (m_wisdomFileName.isEmpty() || !m_wisdomChanged) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_wisdomFileName).absolutePath());
+
+    if (fftwf_export_wisdom_to_filename(m_wisdomFileName.toStdString().c_str()))
+    {
+        qDebug("FFTWPlanCache::saveWisdom: saved %s", qPrintable(m_wisdomFileName));
+        m_wisdomChanged = false;
+    }
+    else
+    {
+        qWarning("FFTWPlanCache::saveWisdom: cannot write %s", qPrintable(m_wisdomFileName));
+    }
+}
+
+fftwf_plan FFTWPlanCache::makePlan(const Plan& plan, unsigned int flags, double timeLimit)
+{
+    // planning arrays with the same alignment as the arrays the plan will be executed on
+    // (FFTW_ESTIMATE and FFTW_WISDOM_ONLY do not touch them but other modes overwrite them)
+    std::size_t size = sizeof(fftwf_complex) * plan.m_n + plan.m_alignment;
+    char *inBase = (char *) fftwf_malloc(size);
+    char *outBase = (char *) fftwf_malloc(size);
+    fftwf_complex *in = (fftwf_complex *) (inBase + plan.m_alignment);
+    fftwf_complex *out = (fftwf_complex *) (outBase + plan.m_alignment);
+
+    m_plannerMutex.lock();
+    fftwf_set_timelimit(timeLimit);
+    fftwf_plan p;
+
+    if (!plan.m_real) {
+        p = fftwf_plan_dft_1d(plan.m_n, in, out, plan.m_inverse ? FFTW_BACKWARD : FFTW_FORWARD, flags);
+    } else if (plan.m_inverse) {
+        p = fftwf_plan_dft_c2r_1d(plan.m_n, in, (float *) out, flags);
+    } else {
+        p = fftwf_plan_dft_r2c_1d(plan.m_n, (float *) in, out, flags);
+    }
+
+    fftwf_set_timelimit(FFTW_NO_TIMELIMIT);
+    m_plannerMutex.unlock();
+
+    fftwf_free(inBase);
+    fftwf_free(outBase);
+    return p;
+}
+
+const FFTWPlanCache::Plan *FFTWPlanCache::getPlan(int n, bool inverse, int alignment, bool real)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Key key = {n, inverse, real, alignment};
+    Plans::iterator it = m_plans.find(key);
+
+    if (it != m_plans.end()) {
+        return it->second;
+    }
+
+    QElapsedTimer t;
+    t.start();
+    Plan *plan = new Plan();
+    plan->m_n = n;
+    plan->m_inverse = inverse;
+    plan->m_real = real;
+    plan->m_alignment = alignment;
+    fftwf_plan p = makePlan(*plan, FFTW_PATIENT | FFTW_WISDOM_ONLY, FFTW_NO_TIMELIMIT);
+
+    if (p)
+    {
+        plan->m_plan = p;
+        plan->m_optimized = true;
+    }
+    else
+    {
+        plan->m_plan = makePlan(*plan, FFTW_ESTIMATE, FFTW_NO_TIMELIMIT);
+        plan->m_optimized = false;
+        m_jobs.append(plan);
+
+        if (!m_running)
+        {
+            m_running = true;
+            start(QThread::LowPriority);
+        }
+
+        m_jobCondition.wakeOne();
+    }
+
+    m_plans[key] = plan;
+    qDebug("FFTWPlanCache::getPlan: (n=%d,%s%s,align=%d) %s plan took %lldms",
+        n, real ? "real " : "", inverse ? "inverse" : "forward", alignment, plan->m_optimized ? "wisdom" : "estimate", t.elapsed());
+
+    return plan;
+}
+
+void FFTWPlanCache::run()
+{
+    m_mutex.lock();
+
+    while (m_running)
+    {
+        if (m_jobs.isEmpty())
+        {
+            m_mutex.unlock();
+            saveWisdom(); // queue drained
+            m_mutex.lock();
+
+            if (m_running && m_jobs.isEmpty()) {
+                m_jobCondition.wait(&m_mutex);
+            }
+
+            continue;
+        }
+
+        Plan *plan = m_jobs.takeFirst();
+        m_mutex.unlock();
+
+        QElapsedTimer t;
+        t.start();
+        fftwf_plan p = makePlan(*plan, FFTW_PATIENT, m_optimizeTimeLimit);
+        qDebug("FFTWPlanCache::run: (n=%d,%s%s,align=%d) patient plan took %lldms",
+            plan->m_n, plan->m_real ? "real " : "", plan->m_inverse ? "inverse" : "forward", plan->m_alignment, t.elapsed());
+
+        m_mutex.lock();
+
+        if (p)
+        {
+            plan->m_retired.push_back(plan->m_plan.load());
+            plan->m_plan.store(p, std::memory_order_release);
+            plan->m_optimized = true;
+            m_plannerMutex.lock();
+            m_wisdomChanged = true;
+            m_plannerMutex.unlock();
+        }
+    }
+
+    m_mutex.unlock();
+}
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FFTWPLANCACHE_H_
+#define SDRBASE_DSP_FFTWPLANCACHE_H_
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+#include <QList>
+#include <fftw3.h>
+
+#include "export.h"
+
+/**
+ * Process wide cache of FFTW plans shared by all FFTWEngine instances. Plans are keyed by
+ * size, direction, kind (complex or real) and array alignment and executed on the engines own arrays with the
+ * new-array execute interface.
+ *
+ * A plan request returns at once: with a plan from the wisdom if any or else with an
+ * FFTW_ESTIMATE plan. In the latter case a FFTW_PATIENT plan is computed in the cache
+ * thread and replaces the estimate plan when ready. The accumulated wisdom is saved to
+ * disk so that subsequent runs get the optimized plans immediately.
+ */
+class SDRBASE_API FFTWPlanCache : public QThread
+{
+    Q_OBJECT
+public:
+    class Plan
+    {
+    public:
+        int getSize() const { return m_n; }
+        bool isInverse() const { return m_inverse; }
+        bool isReal() const { return m_real; }
+        bool isOptimized() const { return m_optimized; }
+        void execute(fftwf_complex *in, fftwf_complex *out) const { fftwf_execute_dft(m_plan.load(std::memory_order_acquire), in, out); }
+        void executeR2C(float *in, fftwf_complex *out) const { fftwf_execute_dft_r2c(m_plan.load(std::memory_order_acquire), in, out); }
+        void executeC2R(fftwf_complex *in, float *out) const { fftwf_execute_dft_c2r(m_plan.load(std::memory_order_acquire), in, out); }
+
+    private:
+        friend class FFTWPlanCache;
+        int m_n;
+        bool m_inverse;
+        bool m_real;       //!< real to complex (forward) or complex to real (inverse)
+        int m_alignment;
+        std::atomic<fftwf_plan> m_plan;   //!< best plan available so far
+        std::atomic<bool> m_optimized;
+        std::vector<fftwf_plan> m_retired; //!< superseded plans kept alive as an engine may still be executing them
+    };
+
+    FFTWPlanCache();
+    ~FFTWPlanCache();
+
+    static FFTWPlanCache *instance();
+
+    const Plan *getPlan(int n, bool inverse, int alignment, bool real = false); //!< alignment is fftwf_alignment_of() of the arrays the plan is executed on
+    void setWisdomFileName(const QString& fileName) { m_wisdomFileName = fileName; }
+    const QString& getWisdomFileName() const { return m_wisdomFileName; }
+    void saveWisdom();
+
+private:
+    struct Key
+    {
+        int n;
+        bool inverse;
+        bool real;
+        int alignment;
+        bool operator<(const Key& other) const;
+    };
+
+    typedef std::map<Key, Plan*> Plans;
+
+    QMutex m_mutex;          //!< protects the plans map and the jobs list
+    QMutex m_plannerMutex;   //!< FFTW planner is not thread safe
+    QWaitCondition m_jobCondition;
+    Plans m_plans;
+    QList<Plan*> m_jobs;     //!< plans waiting for optimization
+    bool m_running;
+    bool m_wisdomChanged;
+    QString m_wisdomFileName;
+
+    void run();
+    void loadWisdom();
+    fftwf_plan makePlan(const Plan& plan, unsigned int flags, double timeLimit);
+
+    static const double m_optimizeTimeLimit; //!< seconds. Bounds the wait of a plan request while the planner is busy optimizing.
+};
+
+#endif /* SDRBASE_DSP_FFTWPLANCACHE_H_ */
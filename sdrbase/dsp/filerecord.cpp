@@ -32,9 +32,7 @@ FileRecord::FileRecord() :
     m_fileName("test.sdriq"),
     m_sampleRate(0),
     m_centerFrequency(0),
-	m_recordOn(false),
-    m_recordStart(false),
-    m_byteCount(0)
+	m_recordOn(false)
 {
 	setObjectName("FileSink");
 }
@@ -44,9 +42,7 @@ FileRecord::FileRecord(const QString& filename) :
     m_fileName(filename),
     m_sampleRate(0),
     m_centerFrequency(0),
-    m_recordOn(false),
-    m_recordStart(false),
-    m_byteCount(0)
+    m_recordOn(false)
 {
     setObjectName("FileRecord");
 }
@@ -64,9 +60,12 @@ void FileRecord::setFileName(const QString& filename)
     }
 }
 
-void FileRecord::genUniqueFileName(uint deviceUID)
+void FileRecord::genUniqueFileName(uint deviceUID, int format)
 {
-    setFileName(QString("rec%1_%2.sdriq").arg(deviceUID).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz")));
+    setFileName(QString("rec%1_%2.%3")
+        .arg(deviceUID)
+        .arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"))
+        .arg(format == RecordCompressed ? "sdriqz" : "sdriq"));
 }
 
 void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
@@ -76,17 +75,7 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
     if(!m_recordOn)
         return;
 
-    if (begin < end) // if there is something to put out
-    {
-        if (m_recordStart)
-        {
-            writeHeader();
-            m_recordStart = false;
-        }
-
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
-        m_byteCount += end - begin;
-    }
+    m_writer.write(begin, end);
 }
 
 void FileRecord::start()
@@ -100,24 +89,22 @@ void FileRecord::stop()
 
 void FileRecord::startRecording()
 {
-    if (!m_sampleFile.is_open())
+    if (!m_recordOn)
     {
     	qDebug() << "FileRecord::startRecording";
-        m_sampleFile.open(m_fileName.toStdString().c_str(), std::ios::binary);
-        m_recordOn = true;
-        m_recordStart = true;
-        m_byteCount = 0;
+        m_writer.setStreamParameters(m_sampleRate, m_centerFrequency);
+        m_recordOn = m_writer.startWriting(m_fileName,
+            isCompressed(m_fileName) ? FileRecordWriter::FormatBlocks : FileRecordWriter::FormatRaw);
     }
 }
 
 void FileRecord::stopRecording()
 {
-    if (m_sampleFile.is_open())
+    if (m_recordOn)
     {
     	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
         m_recordOn = false;
-        m_recordStart = false;
+        m_writer.stopWriting();
     }
 }
 
@@ -128,6 +115,7 @@ bool FileRecord::handleMessage(const Message& message)
 		DSPSignalNotification& notif = (DSPSignalNotification&) message;
 		m_sampleRate = notif.getSampleRate();
 		m_centerFrequency = notif.getCenterFrequency();
+        m_writer.setStreamParameters(m_sampleRate, m_centerFrequency);
 		qDebug() << "FileRecord::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_sampleRate
 				<< " m_centerFrequency: " << m_centerFrequency;
 		return true;
@@ -148,17 +136,9 @@ void FileRecord::handleConfigure(const QString& fileName)
 	m_fileName = fileName;
 }
 
-void FileRecord::writeHeader()
+bool FileRecord::isCompressed(const QString& fileName)
 {
-    Header header;
-    header.sampleRate = m_sampleRate;
-    header.centerFrequency = m_centerFrequency;
-    std::time_t ts = time(0);
-    header.startTimeStamp = ts;
-    header.sampleSize = SDR_RX_SAMP_SZ;
-    header.filler = 0;
-
-    writeHeader(m_sampleFile, header);
+    return fileName.endsWith(".sdriqz", Qt::CaseInsensitive);
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
@@ -24,6 +24,7 @@
 #include <fstream>
 
 #include <ctime>
+#include "dsp/filerecordwriter.h"
 #include "export.h"
 
 class Message;
@@ -47,10 +48,18 @@ public:
     FileRecord(const QString& filename);
 	virtual ~FileRecord();
 
-    quint64 getByteCount() const { return m_byteCount; }
+    enum RecordFormat
+    {
+        RecordRaw,        //!< .sdriq raw samples
+        RecordCompressed  //!< .sdriqz compressed indexed blocks
+    };
+
+    quint64 getByteCount() const { return m_writer.getNbSamplesQueued() + m_writer.getNbSamplesDropped(); } //!< samples fed since the recording started (historical name)
+    quint64 getNbBytesWritten() const { return m_writer.getByteCount(); }
+    quint64 getNbSamplesDropped() const { return m_writer.getNbSamplesDropped(); }
 
     void setFileName(const QString& filename);
-    void genUniqueFileName(uint deviceUID);
+    void genUniqueFileName(uint deviceUID, int format = RecordRaw); //!< format is a RecordFormat
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
 	virtual void start();
@@ -60,18 +69,16 @@ public:
     void stopRecording();
     static bool readHeader(std::ifstream& samplefile, Header& header); //!< returns true if CRC checksum is correct else false
     static void writeHeader(std::ofstream& samplefile, Header& header);
+    static bool isCompressed(const QString& fileName); //!< true if the file name selects the compressed block format (.sdriqz)
 
 private:
 	QString m_fileName;
 	quint32 m_sampleRate;
 	quint64 m_centerFrequency;
 	bool m_recordOn;
-    bool m_recordStart;
-    std::ofstream m_sampleFile;
-    quint64 m_byteCount;
+    FileRecordWriter m_writer;
 
 	void handleConfigure(const QString& fileName);
-    void writeHeader();
 };
 
 #endif // INCLUDE_FILERECORD_H
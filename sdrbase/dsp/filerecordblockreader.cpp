@@ -0,0 +1,246 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/filerecord.h"
+#include "filerecordblockreader.h"
+
+FileRecordBlockReader::FileRecordBlockReader() :
+    m_data(0),
+    m_size(0),
+    m_blockSamples(FileRecordCodec::m_blockSamples),
+    m_nbSamples(0),
+    m_position(0),
+    m_currentBlock(-1)
+{
+    memset(&m_blockHeader, 0, sizeof(m_blockHeader));
+}
+
+FileRecordBlockReader::~FileRecordBlockReader()
+{
+}
+
+bool FileRecordBlockReader::open(const quint8 *data, quint64 size)
+{
+    close();
+    m_data = data;
+    m_size = size;
+
+    if (!readIndex())
+    {
+        qWarning("FileRecordBlockReader::open: no valid index: scanning blocks");
+        scanBlocks();
+    }
+
+    if (m_index.size() == 0)
+    {
+        close();
+        return false;
+    }
+
+    qDebug("FileRecordBlockReader::open: %d blocks %llu samples", (int) m_index.size(), m_nbSamples);
+    return seek(0);
+}
+
+void FileRecordBlockReader::close()
+{
+    m_data = 0;
+    m_size = 0;
+    m_index.clear();
+    m_nbSamples = 0;
+    m_position = 0;
+    m_currentBlock = -1;
+}
+
+bool FileRecordBlockReader::readIndex()
+{
+    FileRecordCodec::IndexTrailer trailer;
+
+    if (m_size < sizeof(FileRecord::Header) + sizeof(trailer)) {
+        return false;
+    }
+
+    memcpy(&trailer, m_data + m_size - sizeof(trailer), sizeof(trailer));
+
+    if ((trailer.magic != FileRecordCodec::m_indexMagic)
+     || (trailer.nbBlocks == 0)
+     || (trailer.blockSamples == 0)
+     || (trailer.nbBlocks > m_size / sizeof(quint64))
+     || (trailer.indexOffset > m_size)
+     || (trailer.indexOffset + trailer.nbBlocks * sizeof(quint64) + sizeof(trailer) != m_size)) {
+        return false;
+    }
+
+    m_index.resize(trailer.nbBlocks);
+    memcpy(m_index.data(), m_data + trailer.indexOffset, trailer.nbBlocks * sizeof(quint64));
+
+    if (FileRecordCodec::indexCRC(m_index.data(), trailer) != trailer.crc32)
+    {
+        m_index.clear();
+        return false;
+    }
+
+    for (quint32 i = 0; i < trailer.nbBlocks; i++)
+    {
+        // blocks are stored between the file header and the index
+        if ((m_index[i] < sizeof(FileRecord::Header))
+         || (m_index[i] > trailer.indexOffset)
+         || (trailer.indexOffset - m_index[i] < sizeof(FileRecordCodec::BlockHeader)))
+        {
+            qWarning("FileRecordBlockReader::readIndex: block %u offset %llu out of data", i, m_index[i]);
+            m_index.clear();
+            return false;
+        }
+    }
+
+    m_blockSamples = trailer.blockSamples;
+    m_nbSamples = trailer.nbSamples;
+    return true;
+}
+
+void FileRecordBlockReader::scanBlocks()
+{
+    quint64 offset = sizeof(FileRecord::Header);
+    FileRecordCodec::BlockHeader header;
+    m_index.clear();
+    m_nbSamples = 0;
+
+    while (offset + sizeof(header) <= m_size)
+    {
+        memcpy(&header, m_data + offset, sizeof(header));
+
+        if ((header.magic != FileRecordCodec::m_blockMagic) || (offset + sizeof(header) + header.payloadSize > m_size)) {
+            break; // index or truncated block
+        }
+
+        if (m_index.size() == 0) {
+            m_blockSamples = header.nbSamples;
+        }
+
+        m_index.push_back(offset);
+        m_nbSamples += header.nbSamples;
+        offset += sizeof(header) + header.payloadSize;
+    }
+}
+
+quint64 FileRecordBlockReader::getDataPosition() const
+{
+    if (m_currentBlock < 0) {
+        return sizeof(FileRecord::Header);
+    } else {
+        return m_index[m_currentBlock];
+    }
+}
+
+quint64 FileRecordBlockReader::getTimestampMs() const
+{
+    if ((m_currentBlock < 0) || (m_blockHeader.sampleRate == 0)) {
+        return m_blockHeader.timestampMs;
+    }
+
+    quint64 samplesInBlock = m_position - (quint64) m_currentBlock * m_blockSamples;
+    return m_blockHeader.timestampMs + (samplesInBlock * 1000) / m_blockHeader.sampleRate;
+}
+
+bool FileRecordBlockReader::seek(quint64 sampleIndex)
+{
+    if (!m_data || (sampleIndex > m_nbSamples)) {
+        return false;
+    }
+
+    m_position = sampleIndex;
+    int blockIndex = std::min(sampleIndex / m_blockSamples, (quint64) m_index.size() - 1);
+    return loadBlock(blockIndex);
+}
+
+bool FileRecordBlockReader::loadBlock(int blockIndex)
+{
+    if (blockIndex == m_currentBlock) {
+        return true;
+    }
+
+    if ((blockIndex < 0) || (blockIndex >= (int) m_index.size())) // sample count of the index larger than its blocks
+    {
+        qWarning("FileRecordBlockReader::loadBlock: block %d out of index", blockIndex);
+        m_currentBlock = -1;
+        return false;
+    }
+
+    // the index comes from the file: check the offset before reading the header
+    quint64 offset = m_index[blockIndex];
+
+    if ((offset < sizeof(FileRecord::Header)) || (offset > m_size) || (m_size - offset < sizeof(m_blockHeader)))
+    {
+        qWarning("FileRecordBlockReader::loadBlock: block %d offset %llu out of file", blockIndex, offset);
+        m_currentBlock = -1;
+        return false;
+    }
+
+    memcpy(&m_blockHeader, m_data + offset, sizeof(m_blockHeader));
+
+    if ((m_blockHeader.magic != FileRecordCodec::m_blockMagic)
+     || (m_blockHeader.payloadSize > m_size - offset - sizeof(m_blockHeader))
+     || (m_blockHeader.nbSamples > (quint32) FileRecordCodec::m_blockSamples))
+    {
+        qWarning("FileRecordBlockReader::loadBlock: invalid block %d", blockIndex);
+        m_currentBlock = -1;
+        return false;
+    }
+
+    m_blockBuffer.resize(m_blockHeader.nbSamples);
+
+    if (!FileRecordCodec::decodeBlock(m_blockHeader, m_data + offset + sizeof(m_blockHeader), m_blockBuffer.data()))
+    {
+        qWarning("FileRecordBlockReader::loadBlock: corrupted block %d", blockIndex);
+        m_currentBlock = -1;
+        return false;
+    }
+
+    m_currentBlock = blockIndex;
+    return true;
+}
+
+int FileRecordBlockReader::read(Sample *samples, int nbSamples)
+{
+    int nbRead = 0;
+
+    while ((nbRead < nbSamples) && (m_position < m_nbSamples))
+    {
+        int blockIndex = m_position / m_blockSamples;
+
+        if (!loadBlock(blockIndex)) {
+            break;
+        }
+
+        int blockOffset = m_position - (quint64) blockIndex * m_blockSamples;
+        int count = std::min(nbSamples - nbRead, (int) m_blockBuffer.size() - blockOffset);
+
+        if (count <= 0) {
+            break;
+        }
+
+        std::copy(m_blockBuffer.begin() + blockOffset, m_blockBuffer.begin() + blockOffset + count, samples + nbRead);
+        nbRead += count;
+        m_position += count;
+    }
+
+    return nbRead;
+}
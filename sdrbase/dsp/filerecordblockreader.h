@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDBLOCKREADER_H_
+#define SDRBASE_DSP_FILERECORDBLOCKREADER_H_
+
+#include <vector>
+#include <QtGlobal>
+
+#include "dsp/dsptypes.h"
+#include "dsp/filerecordcodec.h"
+#include "export.h"
+
+/**
+ * Reads samples from a block format recording (see FileRecordCodec) held in memory
+ * (typically a memory mapped file). Seeking to any sample uses the trailing index
+ * and is constant time. A file without index (ex: recording interrupted) is indexed
+ * by walking the block headers when it is opened.
+ */
+class SDRBASE_API FileRecordBlockReader
+{
+public:
+    FileRecordBlockReader();
+    ~FileRecordBlockReader();
+
+    bool open(const quint8 *data, quint64 size); //!< data starts with the FileRecord::Header. Returns false if no valid block is found.
+    void close();
+    bool isOpen() const { return m_data != 0; }
+
+    quint64 getNbSamples() const { return m_nbSamples; }
+    quint64 getPosition() const { return m_position; }   //!< index of the next sample to be read
+    quint64 getDataPosition() const;                     //!< file offset of the block being read
+    bool seek(quint64 sampleIndex);
+    int read(Sample *samples, int nbSamples);            //!< returns the number of samples read. Less than nbSamples at end of file or on a corrupted block.
+
+    quint32 getSampleRate() const { return m_blockHeader.sampleRate; }          //!< sample rate of the current block
+    quint64 getCenterFrequency() const { return m_blockHeader.centerFrequency; } //!< center frequency of the current block
+    quint64 getTimestampMs() const;                                              //!< time of the next sample to be read
+
+private:
+    const quint8 *m_data;
+    quint64 m_size;
+    std::vector<quint64> m_index;   //!< file offset of each block
+    quint32 m_blockSamples;         //!< nominal number of samples per block
+    quint64 m_nbSamples;
+    quint64 m_position;
+    int m_currentBlock;             //!< block decoded in m_blockBuffer or -1
+    FileRecordCodec::BlockHeader m_blockHeader;
+    std::vector<Sample> m_blockBuffer;
+
+    bool readIndex();
+    void scanBlocks();
+    bool loadBlock(int blockIndex);
+};
+
+#endif /* SDRBASE_DSP_FILERECORDBLOCKREADER_H_ */
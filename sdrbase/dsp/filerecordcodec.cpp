@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/crc.hpp>
+#include <boost/cstdint.hpp>
+
+#include "filerecordcodec.h"
+
+const quint32 FileRecordCodec::m_formatMarker;
+const quint32 FileRecordCodec::m_blockMagic;
+const quint32 FileRecordCodec::m_indexMagic;
+const int FileRecordCodec::m_blockSamples;
+const int FileRecordCodec::m_subBlockSamples;
+
+namespace
+{
+
+struct BitWriter
+{
+    std::vector<quint8>& m_out;
+    quint64 m_acc;
+    int m_nbBits;
+
+    BitWriter(std::vector<quint8>& out) : m_out(out), m_acc(0), m_nbBits(0) {}
+
+    void push(quint32 value, int width)
+    {
+        m_acc |= ((quint64) value) << m_nbBits;
+        m_nbBits += width;
+
+        while (m_nbBits >= 8)
+        {
+            m_out.push_back(m_acc & 0xff);
+            m_acc >>= 8;
+            m_nbBits -= 8;
+        }
+    }
+
+    void flush()
+    {
+        if (m_nbBits > 0) {
+            m_out.push_back(m_acc & 0xff);
+        }
+
+        m_acc = 0;
+        m_nbBits = 0;
+    }
+};
+
+struct BitReader
+{
+    const quint8 *m_in;
+    const quint8 *m_end;
+    quint64 m_acc;
+    int m_nbBits;
+
+    BitReader(const quint8 *in, const quint8 *end) : m_in(in), m_end(end), m_acc(0), m_nbBits(0) {}
+
+    bool pull(int width, quint32& value)
+    {
+        while (m_nbBits < width)
+        {
+            if (m_in == m_end) {
+                return false;
+            }
+
+            m_acc |= ((quint64) *m_in++) << m_nbBits;
+            m_nbBits += 8;
+        }
+
+        value = m_acc & ((((quint64) 1) << width) - 1);
+        m_acc >>= width;
+        m_nbBits -= width;
+        return true;
+    }
+
+    void align() // drop the padding bits of the current byte
+    {
+        m_acc = 0;
+        m_nbBits = 0;
+    }
+};
+
+inline quint32 zigzag(qint32 delta) {
+    return (((quint32) delta) << 1) ^ (quint32) (delta >> 31);
+}
+
+inline qint32 unzigzag(quint32 value) {
+    return (qint32) ((value >> 1) ^ (0U - (value & 1)));
+}
+
+inline int bitWidth(quint32 value)
+{
+    int width = 0;
+
+    while (value)
+    {
+        width++;
+        value >>= 1;
+    }
+
+    return width;
+}
+
+const int deltaFlag = 0x80; //!< set in the sub block width byte when values are delta coded
+
+/** Zigzag code the values directly or their deltas whichever is narrower. Returns the width byte. */
+int encodeChannel(const qint32 *values, int nbValues, qint32& previous, quint32 *zigzags)
+{
+    quint32 accDirect = 0, accDelta = 0;
+    qint32 last = previous;
+
+    for (int i = 0; i < nbValues; i++)
+    {
+        accDirect |= zigzag(values[i]);
+        accDelta |= zigzag((qint32) ((quint32) values[i] - (quint32) last));
+        last = values[i];
+    }
+
+    bool delta = accDelta < accDirect; // uncorrelated samples (ex: noise) are narrower without delta coding
+
+    for (int i = 0; i < nbValues; i++)
+    {
+        zigzags[i] = delta ? zigzag((qint32) ((quint32) values[i] - (quint32) previous)) : zigzag(values[i]);
+        previous = values[i];
+    }
+
+    return bitWidth(delta ? accDelta : accDirect) | (delta ? deltaFlag : 0);
+}
+
+inline int widthOf(int widthByte) {
+    return widthByte & ~deltaFlag;
+}
+
+} // namespace
+
+void FileRecordCodec::encodeBlock(
+    const Sample *samples,
+    int nbSamples,
+    quint32 sampleRate,
+    quint64 centerFrequency,
+    quint64 timestampMs,
+    BlockHeader& header,
+    std::vector<quint8>& payload)
+{
+    quint32 trailingBits = 0;
+
+    for (int i = 0; i < nbSamples; i++) {
+        trailingBits |= (quint32) samples[i].m_real | (quint32) samples[i].m_imag;
+    }
+
+    int shift = 0;
+
+    while (trailingBits && ((trailingBits & 1) == 0) && (shift < SDR_RX_SAMP_SZ - 1))
+    {
+        trailingBits >>= 1;
+        shift++;
+    }
+
+    payload.clear();
+    BitWriter bitWriter(payload);
+    qint32 previousI = 0, previousQ = 0;
+    qint32 valuesI[m_subBlockSamples], valuesQ[m_subBlockSamples];
+    quint32 zigzagsI[m_subBlockSamples], zigzagsQ[m_subBlockSamples];
+
+    for (int start = 0; start < nbSamples; start += m_subBlockSamples)
+    {
+        int count = std::min(m_subBlockSamples, nbSamples - start);
+        for (int i = 0; i < count; i++)
+        {
+            valuesI[i] = ((qint32) samples[start + i].m_real) >> shift;
+            valuesQ[i] = ((qint32) samples[start + i].m_imag) >> shift;
+        }
+
+        int widthI = encodeChannel(valuesI, count, previousI, zigzagsI);
+        int widthQ = encodeChannel(valuesQ, count, previousQ, zigzagsQ);
+        payload.push_back(widthI);
+        payload.push_back(widthQ);
+
+        for (int i = 0; i < count; i++) {
+            bitWriter.push(zigzagsI[i], widthOf(widthI));
+        }
+
+        for (int i = 0; i < count; i++) {
+            bitWriter.push(zigzagsQ[i], widthOf(widthQ));
+        }
+
+        bitWriter.flush();
+    }
+
+    header.magic = m_blockMagic;
+    header.nbSamples = nbSamples;
+    header.payloadSize = payload.size();
+    header.sampleRate = sampleRate;
+    header.centerFrequency = centerFrequency;
+    header.timestampMs = timestampMs;
+    header.sampleBits = SDR_RX_SAMP_SZ;
+    header.shift = shift;
+    header.filler = 0;
+    header.crc32 = blockCRC(header, payload.data());
+}
+
+bool FileRecordCodec::decodeBlock(const BlockHeader& header, const quint8 *payload, Sample *samples)
+{
+    if ((header.magic != m_blockMagic) || (header.nbSamples > (quint32) m_blockSamples) || (header.crc32 != blockCRC(header, payload))) {
+        return false;
+    }
+
+    const quint8 *end = payload + header.payloadSize;
+    BitReader bitReader(payload, end);
+    int nbSamples = header.nbSamples;
+    qint32 previousI = 0, previousQ = 0;
+    // shift that restores the recorded values then converts them to this build sample size
+    int leftShift = header.shift + (SDR_RX_SAMP_SZ > header.sampleBits ? SDR_RX_SAMP_SZ - header.sampleBits : 0);
+    int rightShift = header.sampleBits > SDR_RX_SAMP_SZ ? header.sampleBits - SDR_RX_SAMP_SZ : 0;
+
+    for (int start = 0; start < nbSamples; start += m_subBlockSamples)
+    {
+        int count = std::min(m_subBlockSamples, nbSamples - start);
+
+        if (bitReader.m_in + 2 > end) {
+            return false;
+        }
+
+        int widthI = *bitReader.m_in++;
+        int widthQ = *bitReader.m_in++;
+
+        if ((widthOf(widthI) > 32) || (widthOf(widthQ) > 32)) {
+            return false;
+        }
+
+        quint32 value;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (!bitReader.pull(widthOf(widthI), value)) {
+                return false;
+            }
+
+            previousI = widthI & deltaFlag ? (qint32) ((quint32) previousI + (quint32) unzigzag(value)) : unzigzag(value);
+            samples[start + i].m_real = ((qint32) ((quint32) previousI << leftShift)) >> rightShift;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (!bitReader.pull(widthOf(widthQ), value)) {
+                return false;
+            }
+
+            previousQ = widthQ & deltaFlag ? (qint32) ((quint32) previousQ + (quint32) unzigzag(value)) : unzigzag(value);
+            samples[start + i].m_imag = ((qint32) ((quint32) previousQ << leftShift)) >> rightShift;
+        }
+
+        bitReader.align();
+    }
+
+    return true;
+}
+
+quint32 FileRecordCodec::blockCRC(const BlockHeader& header, const quint8 *payload)
+{
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, offsetof(BlockHeader, crc32));
+    crc32.process_bytes(payload, header.payloadSize);
+    return crc32.checksum();
+}
+
+quint32 FileRecordCodec::indexCRC(const quint64 *index, const IndexTrailer& trailer)
+{
+    boost::crc_32_type crc32;
+    crc32.process_bytes(index, trailer.nbBlocks * sizeof(quint64));
+    crc32.process_bytes(&trailer, offsetof(IndexTrailer, crc32));
+    return crc32.checksum();
+}
@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDCODEC_H_
+#define SDRBASE_DSP_FILERECORDCODEC_H_
+
+#include <vector>
+#include <QtGlobal>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Block based lossless I/Q recording format.
+ *
+ * The file starts with the usual FileRecord::Header with the filler field set to m_formatMarker.
+ * It is followed by blocks of m_blockSamples samples (the last one may be shorter) each made of
+ * a BlockHeader and a compressed payload. The file ends with an index of the file offset of each
+ * block followed by an IndexTrailer so that any sample can be reached in constant time.
+ *
+ * Compression: the trailing zero bits common to all samples of a block are removed (ex: 12 bit
+ * ADC samples scaled to 16 bits), then I and Q are delta coded when this is narrower, zigzag mapped and bit packed in
+ * sub blocks of m_subBlockSamples with the minimum width of each sub block.
+ * Each block is self contained so decoding can start at any block.
+ */
+class SDRBASE_API FileRecordCodec
+{
+public:
+#pragma pack(push, 1)
+    struct BlockHeader
+    {
+        quint32 magic;           //!< m_blockMagic
+        quint32 nbSamples;       //!< number of I/Q samples in the block
+        quint32 payloadSize;     //!< compressed payload size in bytes following the header
+        quint32 sampleRate;      //!< sample rate at the start of the block
+        quint64 centerFrequency; //!< center frequency in Hz at the start of the block
+        quint64 timestampMs;     //!< time of the first sample in milliseconds since epoch
+        quint8  sampleBits;      //!< recorded sample size in bits (16 or 24)
+        quint8  shift;           //!< common trailing zero bits removed from all samples
+        quint16 filler;
+        quint32 crc32;           //!< CRC32 of the header before this field and of the payload
+    };
+
+    struct IndexTrailer
+    {
+        quint64 indexOffset;     //!< file offset of the index (nbBlocks quint64 block offsets)
+        quint64 nbSamples;       //!< total number of samples in the file
+        quint32 nbBlocks;
+        quint32 blockSamples;    //!< number of samples of every block except the last one
+        quint32 magic;           //!< m_indexMagic
+        quint32 crc32;           //!< CRC32 of the index and of the trailer before this field
+    };
+#pragma pack(pop)
+
+    static const quint32 m_formatMarker = 0x5a514453; //!< "SDQZ" in FileRecord::Header::filler
+    static const quint32 m_blockMagic = 0x42514453;   //!< "SDQB"
+    static const quint32 m_indexMagic = 0x58514453;   //!< "SDQX"
+    static const int m_blockSamples = 65536;
+    static const int m_subBlockSamples = 64;
+
+    /** Compress nbSamples samples (at most m_blockSamples) to payload and fill in the block header */
+    static void encodeBlock(
+        const Sample *samples,
+        int nbSamples,
+        quint32 sampleRate,
+        quint64 centerFrequency,
+        quint64 timestampMs,
+        BlockHeader& header,
+        std::vector<quint8>& payload);
+
+    /** Decompress a block payload to header.nbSamples samples in this build sample size. Returns false if the CRC or payload is wrong. */
+    static bool decodeBlock(const BlockHeader& header, const quint8 *payload, Sample *samples);
+
+    static quint32 blockCRC(const BlockHeader& header, const quint8 *payload);
+    static quint32 indexCRC(const quint64 *index, const IndexTrailer& trailer);
+};
+
+#endif /* SDRBASE_DSP_FILERECORDCODEC_H_ */
@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QDateTime>
+
+#include "dsp/filerecord.h"
+#include "dsp/filerecordcodec.h"
+#include "filerecordwriter.h"
+
+FileRecordWriter::FileRecordWriter(QObject *parent) :
+    QThread(parent),
+    m_format(FormatRaw),
+    m_running(false),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_startTimeMs(0),
+    m_nbSamplesQueued(0),
+    m_nbSamplesDropped(0),
+    m_byteCount(0),
+    m_headerWritten(false),
+    m_blockFill(0),
+    m_blockSampleRate(0),
+    m_blockCenterFrequency(0),
+    m_elapsedMs(0.0),
+    m_nbSamplesWritten(0)
+{
+}
+
+FileRecordWriter::~FileRecordWriter()
+{
+    stopWriting();
+}
+
+bool FileRecordWriter::startWriting(const QString& fileName, Format format)
+{
+    if (m_running) {
+        return true;
+    }
+
+    m_sampleFile.open(fileName.toStdString().c_str(), std::ios::binary);
+
+    if (!m_sampleFile.is_open())
+    {
+        qCritical("FileRecordWriter::startWriting: cannot open %s", qPrintable(fileName));
+        return false;
+    }
+
+    // hold at least one second of samples so that disk stalls are absorbed
+    m_fifo.setSize(std::max(1U<<20, (unsigned int) m_sampleRate.load()));
+    m_format = format;
+    m_startTimeMs = 0;
+    m_nbSamplesQueued = 0;
+    m_nbSamplesDropped = 0;
+    m_byteCount = 0;
+    m_headerWritten = false;
+    m_blockSamples.resize(format == FormatBlocks ? FileRecordCodec::m_blockSamples : 0);
+    m_blockFill = 0;
+    m_elapsedMs = 0.0;
+    m_nbSamplesWritten = 0;
+    m_index.clear();
+
+    qDebug("FileRecordWriter::startWriting: %s format: %s fifo: %u",
+        qPrintable(fileName), format == FormatBlocks ? "blocks" : "raw", m_fifo.size());
+
+    m_running = true;
+    start();
+
+    return true;
+}
+
+void FileRecordWriter::stopWriting()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    wait();
+    m_sampleFile.close();
+
+    qDebug("FileRecordWriter::stopWriting: %llu samples %llu bytes %llu dropped",
+        m_nbSamplesWritten, m_byteCount.load(), m_nbSamplesDropped.load());
+}
+
+void FileRecordWriter::setStreamParameters(quint32 sampleRate, quint64 centerFrequency)
+{
+    m_sampleRate = sampleRate;
+    m_centerFrequency = centerFrequency;
+}
+
+void FileRecordWriter::write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_running || (begin >= end)) {
+        return;
+    }
+
+    if (m_startTimeMs == 0) {
+        m_startTimeMs = QDateTime::currentMSecsSinceEpoch();
+    }
+
+    unsigned int count = end - begin;
+    unsigned int written = m_fifo.write(begin, end);
+    m_nbSamplesQueued += written;
+
+    if (written < count) {
+        m_nbSamplesDropped += count - written;
+    }
+}
+
+void FileRecordWriter::run()
+{
+    SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+
+    while (true)
+    {
+        bool running = m_running; // read before the FIFO so that the last samples are drained
+        unsigned int fill = m_fifo.fill();
+
+        if (fill == 0)
+        {
+            if (!running) {
+                break;
+            }
+
+            msleep(10);
+            continue;
+        }
+
+        if (!m_headerWritten) {
+            writeHeader();
+        }
+
+        unsigned int count = m_fifo.readBegin(fill, &part1Begin, &part1End, &part2Begin, &part2End);
+
+        if (part1Begin != part1End) {
+            writeSamples(part1Begin, part1End);
+        }
+        if (part2Begin != part2End) {
+            writeSamples(part2Begin, part2End);
+        }
+
+        m_fifo.readCommit(count);
+    }
+
+    if (m_format == FormatBlocks)
+    {
+        if (!m_headerWritten) {
+            writeHeader();
+        }
+        if (m_blockFill > 0) {
+            writeBlock();
+        }
+
+        writeIndex();
+    }
+
+    m_sampleFile.flush();
+}
+
+void FileRecordWriter::writeHeader()
+{
+    FileRecord::Header header;
+    header.sampleRate = m_sampleRate;
+    header.centerFrequency = m_centerFrequency;
+    header.startTimeStamp = (m_startTimeMs == 0 ? QDateTime::currentMSecsSinceEpoch() : m_startTimeMs.load()) / 1000;
+    header.sampleSize = SDR_RX_SAMP_SZ;
+    header.filler = m_format == FormatBlocks ? FileRecordCodec::m_formatMarker : 0;
+    FileRecord::writeHeader(m_sampleFile, header);
+    m_byteCount += sizeof(FileRecord::Header);
+    m_headerWritten = true;
+}
+
+void FileRecordWriter::writeSamples(const SampleVector::iterator& begin, const SampleVector::iterator& end)
+{
+    if (m_format == FormatRaw)
+    {
+        m_sampleFile.write(reinterpret_cast<const char*>(&*begin), (end - begin)*sizeof(Sample));
+        m_byteCount += (end - begin)*sizeof(Sample);
+        m_nbSamplesWritten += end - begin;
+        return;
+    }
+
+    SampleVector::iterator it = begin;
+
+    while (it != end)
+    {
+        if (m_blockFill == 0)
+        {
+            m_blockSampleRate = m_sampleRate;
+            m_blockCenterFrequency = m_centerFrequency;
+        }
+
+        int count = std::min((int) (end - it), FileRecordCodec::m_blockSamples - m_blockFill);
+        std::copy(it, it + count, m_blockSamples.begin() + m_blockFill);
+        m_blockFill += count;
+        it += count;
+
+        if (m_blockFill == FileRecordCodec::m_blockSamples) {
+            writeBlock();
+        }
+    }
+}
+
+void FileRecordWriter::writeBlock()
+{
+    FileRecordCodec::BlockHeader header;
+
+    FileRecordCodec::encodeBlock(
+        m_blockSamples.data(),
+        m_blockFill,
+        m_blockSampleRate,
+        m_blockCenterFrequency,
+        m_startTimeMs + (quint64) m_elapsedMs,
+        header,
+        m_payload);
+
+    m_index.push_back(m_byteCount);
+    m_sampleFile.write((const char *) &header, sizeof(header));
+    m_sampleFile.write((const char *) m_payload.data(), m_payload.size());
+    m_byteCount += sizeof(header) + m_payload.size();
+    m_nbSamplesWritten += m_blockFill;
+
+    if (m_blockSampleRate != 0) {
+        m_elapsedMs += (m_blockFill * 1000.0) / m_blockSampleRate;
+    }
+
+    m_blockFill = 0;
+}
+
+void FileRecordWriter::writeIndex()
+{
+    FileRecordCodec::IndexTrailer trailer;
+    trailer.indexOffset = m_byteCount;
+    trailer.nbSamples = m_nbSamplesWritten;
+    trailer.nbBlocks = m_index.size();
+    trailer.blockSamples = FileRecordCodec::m_blockSamples;
+    trailer.magic = FileRecordCodec::m_indexMagic;
+    trailer.crc32 = FileRecordCodec::indexCRC(m_index.data(), trailer);
+
+    m_sampleFile.write((const char *) m_index.data(), m_index.size() * sizeof(quint64));
+    m_sampleFile.write((const char *) &trailer, sizeof(trailer));
+    m_byteCount += m_index.size() * sizeof(quint64) + sizeof(trailer);
+}
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDWRITER_H_
+#define SDRBASE_DSP_FILERECORDWRITER_H_
+
+#include <atomic>
+#include <vector>
+#include <fstream>
+
+#include <QThread>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "dsp/samplesinkfifo.h"
+#include "export.h"
+
+/**
+ * Writes recorded samples to disk from its own thread. Samples handed over by the DSP
+ * thread are queued in a lock free FIFO and never wait for the disk: if the disk stalls
+ * for longer than the FIFO can absorb the overflowing samples are dropped and counted.
+ * Samples are written either raw after the FileRecord::Header (.sdriq) or compressed in
+ * indexed blocks (.sdriqz, see FileRecordCodec).
+ */
+class SDRBASE_API FileRecordWriter : public QThread
+{
+    Q_OBJECT
+public:
+    enum Format
+    {
+        FormatRaw,
+        FormatBlocks
+    };
+
+    FileRecordWriter(QObject *parent = nullptr);
+    ~FileRecordWriter();
+
+    bool startWriting(const QString& fileName, Format format);
+    void stopWriting(); //!< flushes pending samples, writes the index and closes the file
+    bool isWriting() const { return m_running; }
+
+    void setStreamParameters(quint32 sampleRate, quint64 centerFrequency); //!< may be called from any thread
+    void write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end); //!< from the DSP thread only
+
+    quint64 getNbSamplesQueued() const { return m_nbSamplesQueued; }
+    quint64 getNbSamplesDropped() const { return m_nbSamplesDropped; }
+    quint64 getByteCount() const { return m_byteCount; } //!< bytes written to the file
+
+private:
+    SampleSinkFifo m_fifo;
+    std::ofstream m_sampleFile;
+    Format m_format;
+    std::atomic<bool> m_running;
+    std::atomic<quint32> m_sampleRate;
+    std::atomic<quint64> m_centerFrequency;
+    std::atomic<quint64> m_startTimeMs;      //!< time of the first sample, 0 until samples arrive
+    std::atomic<quint64> m_nbSamplesQueued;
+    std::atomic<quint64> m_nbSamplesDropped;
+    std::atomic<quint64> m_byteCount;
+
+    // writer thread only
+    bool m_headerWritten;
+    SampleVector m_blockSamples;             //!< samples of the block being filled
+    int m_blockFill;
+    quint32 m_blockSampleRate;
+    quint64 m_blockCenterFrequency;
+    double m_elapsedMs;                      //!< time from the start of the record to the start of the block being filled
+    quint64 m_nbSamplesWritten;
+    std::vector<quint64> m_index;
+    std::vector<quint8> m_payload;
+
+    void run();
+    void writeHeader();
+    void writeSamples(const SampleVector::iterator& begin, const SampleVector::iterator& end);
+    void writeBlock();
+    void writeIndex();
+};
+
+#endif /* SDRBASE_DSP_FILERECORDWRITER_H_ */
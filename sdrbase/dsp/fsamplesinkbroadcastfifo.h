@@ -0,0 +1,32 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FSAMPLESINKBROADCASTFIFO_H_
+#define SDRBASE_DSP_FSAMPLESINKBROADCASTFIFO_H_
+
+#include "dsp/samplesinkbroadcastfifo.h"
+#include "export.h"
+
+/**
+ * Float baseband broadcast FIFO feeding the threaded sinks
+ */
+class SDRBASE_API FSampleSinkBroadcastFifo : public SampleSinkBroadcastFifoT<FSample> {
+public:
+    FSampleSinkBroadcastFifo(int size = 1<<18, QObject* parent = 0) : SampleSinkBroadcastFifoT<FSample>(size, parent) {}
+};
+
+#endif // SDRBASE_DSP_FSAMPLESINKBROADCASTFIFO_H_
@@ -0,0 +1,33 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FSAMPLESINKFIFO_H_
+#define SDRBASE_DSP_FSAMPLESINKFIFO_H_
+
+#include "dsp/samplesinkfifo.h"
+
+/**
+ * Float baseband counterpart of SampleSinkFifo used by devices delivering float samples
+ * normalized to +/-1.0 (see BasebandSampleSink::feedF).
+ */
+class SDRBASE_API FSampleSinkFifo : public SampleSinkFifoT<FSample> {
+public:
+	FSampleSinkFifo(QObject* parent = NULL) : SampleSinkFifoT<FSample>(parent) {}
+	FSampleSinkFifo(int size, QObject* parent = NULL) : SampleSinkFifoT<FSample>(size, parent) {}
+};
+
+#endif // SDRBASE_DSP_FSAMPLESINKFIFO_H_
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <algorithm>
+
+#include "goertzelbank.h"
+
+#undef M_PI
+#define M_PI 3.14159265358979323846
+
+GoertzelBank::Feedback GoertzelBank::m_feedback = GoertzelBank::feedbackGeneric;
+HBFilterKernels::ISA GoertzelBank::m_isa = GoertzelBank::initialize();
+
+HBFilterKernels::ISA GoertzelBank::initialize()
+{
+    HBFilterKernels::ISA isa = HBFilterKernels::getDetectedISA();
+    setISA(isa);
+    return isa;
+}
+
+bool GoertzelBank::setISA(HBFilterKernels::ISA isa)
+{
+    if (!HBFilterKernels::isSupported(isa)) {
+        return false;
+    }
+
+    switch (isa)
+    {
+#ifdef HBFILTERKERNELS_X86
+    case HBFilterKernels::ISASSE4_1:
+        m_feedback = feedbackSSE4_1;
+        break;
+    case HBFilterKernels::ISAAVX2:
+        m_feedback = feedbackAVX2;
+        break;
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    case HBFilterKernels::ISANEON:
+        m_feedback = feedbackNEON;
+        break;
+#endif
+    default:
+        m_feedback = feedbackGeneric;
+        break;
+    }
+
+    m_isa = isa;
+    return true;
+}
+
+GoertzelBank::GoertzelBank() :
+    m_nbTones(0),
+    m_nbTonesPadded(0)
+{
+}
+
+GoertzelBank::~GoertzelBank()
+{
+}
+
+void GoertzelBank::resize(int nbTones)
+{
+    m_nbTones = nbTones;
+    m_nbTonesPadded = ((nbTones + m_toneAlignment - 1) / m_toneAlignment) * m_toneAlignment;
+    m_coef.assign(m_nbTonesPadded, 0.0f);
+    m_u0.assign(m_nbTonesPadded, 0.0f);
+    m_u1.assign(m_nbTonesPadded, 0.0f);
+}
+
+void GoertzelBank::setFrequency(int toneIndex, double frequency, double sampleRate)
+{
+    m_coef[toneIndex] = 2.0 * cos((2.0 * M_PI * frequency) / sampleRate);
+}
+
+void GoertzelBank::power(float *power)
+{
+    for (int j = 0; j < m_nbTones; j++) {
+        power[j] = (m_u0[j] * m_u0[j]) + (m_u1[j] * m_u1[j]) - (m_coef[j] * m_u0[j] * m_u1[j]);
+    }
+
+    reset();
+}
+
+void GoertzelBank::reset()
+{
+    std::fill(m_u0.begin(), m_u0.end(), 0.0f);
+    std::fill(m_u1.begin(), m_u1.end(), 0.0f);
+}
+
+void GoertzelBank::feedbackGeneric(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones)
+{
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < nbTones; j++)
+        {
+            float t = u0[j];
+            u0[j] = in[i] + (coef[j] * u0[j]) - u1[j];
+            u1[j] = t;
+        }
+    }
+}
@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_GOERTZELBANK_H_
+#define SDRBASE_DSP_GOERTZELBANK_H_
+
+#include <vector>
+
+#include "dsp/hbfilterkernels.h"
+#include "export.h"
+
+/**
+ * Bank of Goertzel recurrences on a set of tones sharing the same input signal.
+ *
+ * The filter states are kept in a structure of arrays (one array per state variable)
+ * padded to a multiple of 8 tones so that all tones are updated in one SIMD pass per
+ * sample. The feedback kernel is selected at run time according to the instruction
+ * set supported by the CPU (same detection as HBFilterKernels).
+ *
+ * Padding tones have a null coefficient and their power is never reported.
+ */
+class SDRBASE_API GoertzelBank
+{
+public:
+    typedef void (*Feedback)(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones); //!< u0 = in + coef*u0 - u1, u1 = previous u0 for each tone and each input sample
+
+    GoertzelBank();
+    ~GoertzelBank();
+
+    void resize(int nbTones);                                             //!< set number of tones and reset the recurrences
+    void setFrequency(int toneIndex, double frequency, double sampleRate); //!< set coefficient of one tone
+    int getNbTones() const { return m_nbTones; }
+    float getCoefficient(int toneIndex) const { return m_coef[toneIndex]; }
+
+    void feed(float sample) { m_feedback(&sample, 1, m_coef.data(), m_u0.data(), m_u1.data(), m_nbTonesPadded); }
+    void feed(const float *samples, int n) { m_feedback(samples, n, m_coef.data(), m_u0.data(), m_u1.data(), m_nbTonesPadded); }
+    void power(float *power);  //!< power of each tone at the end of the block then reset recurrences for the next block
+    void reset();              //!< reset recurrences
+
+    static HBFilterKernels::ISA getISA() { return m_isa; }
+    static bool setISA(HBFilterKernels::ISA isa); //!< force the instruction set (mainly for benchmarking). Returns false if not supported
+
+    // per instruction set implementations
+    static void feedbackGeneric(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones);
+#ifdef HBFILTERKERNELS_X86
+    static void feedbackSSE4_1(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones);
+    static void feedbackAVX2(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones);
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    static void feedbackNEON(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones);
+#endif
+
+    static const int m_toneAlignment = 8; //!< tones are processed by groups of this size
+
+private:
+    int m_nbTones;
+    int m_nbTonesPadded;
+    std::vector<float> m_coef;
+    std::vector<float> m_u0;
+    std::vector<float> m_u1;
+
+    static HBFilterKernels::ISA m_isa;
+    static Feedback m_feedback;
+
+    static HBFilterKernels::ISA initialize();
+};
+
+#endif /* SDRBASE_DSP_GOERTZELBANK_H_ */
@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// NEON Goertzel bank kernels
+
+#include "goertzelbank.h"
+
+#ifdef HBFILTERKERNELS_NEON
+
+#include <arm_neon.h>
+
+void GoertzelBank::feedbackNEON(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones)
+{
+    for (int j = 0; j < nbTones; j += 4)
+    {
+        float32x4_t c = vld1q_f32(coef + j);
+        float32x4_t s0 = vld1q_f32(u0 + j);
+        float32x4_t s1 = vld1q_f32(u1 + j);
+
+        for (int i = 0; i < n; i++)
+        {
+            float32x4_t t = s0;
+            s0 = vmlaq_f32(vsubq_f32(vdupq_n_f32(in[i]), s1), c, s0);
+            s1 = t;
+        }
+
+        vst1q_f32(u0 + j, s0);
+        vst1q_f32(u1 + j, s1);
+    }
+}
+
+#endif // HBFILTERKERNELS_NEON
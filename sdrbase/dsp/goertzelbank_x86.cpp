@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// SSE4.1 and AVX2 Goertzel bank kernels compiled with per function target attributes
+// (see hbfilterkernels_x86.cpp)
+
+#include "goertzelbank.h"
+
+#ifdef HBFILTERKERNELS_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GOERTZELBANK_TARGET(isa) __attribute__((target(isa)))
+#else
+#define GOERTZELBANK_TARGET(isa)
+#endif
+
+// The states of up to 4 vectors of tones stay in registers for the whole input block.
+// The recurrences of the different vectors are independent so this hides the latency
+// of the sample to sample dependency.
+
+template<int K>
+GOERTZELBANK_TARGET("sse4.1")
+static inline void goertzelBlockSSE4_1(const float *in, int n, const float *coef, float *u0, float *u1)
+{
+    __m128 c[K], s0[K], s1[K];
+
+    for (int k = 0; k < K; k++)
+    {
+        c[k] = _mm_loadu_ps(coef + 4*k);
+        s0[k] = _mm_loadu_ps(u0 + 4*k);
+        s1[k] = _mm_loadu_ps(u1 + 4*k);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        __m128 x = _mm_set1_ps(in[i]);
+
+        for (int k = 0; k < K; k++)
+        {
+            __m128 t = s0[k];
+            s0[k] = _mm_sub_ps(_mm_add_ps(x, _mm_mul_ps(c[k], s0[k])), s1[k]);
+            s1[k] = t;
+        }
+    }
+
+    for (int k = 0; k < K; k++)
+    {
+        _mm_storeu_ps(u0 + 4*k, s0[k]);
+        _mm_storeu_ps(u1 + 4*k, s1[k]);
+    }
+}
+
+GOERTZELBANK_TARGET("sse4.1")
+void GoertzelBank::feedbackSSE4_1(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones)
+{
+    int j = 0;
+
+    for (; j + 16 <= nbTones; j += 16) {
+        goertzelBlockSSE4_1<4>(in, n, coef + j, u0 + j, u1 + j);
+    }
+
+    for (; j < nbTones; j += 8) {
+        goertzelBlockSSE4_1<2>(in, n, coef + j, u0 + j, u1 + j);
+    }
+}
+
+template<int K>
+GOERTZELBANK_TARGET("avx2,fma")
+static inline void goertzelBlockAVX2(const float *in, int n, const float *coef, float *u0, float *u1)
+{
+    __m256 c[K], s0[K], s1[K];
+
+    for (int k = 0; k < K; k++)
+    {
+        c[k] = _mm256_loadu_ps(coef + 8*k);
+        s0[k] = _mm256_loadu_ps(u0 + 8*k);
+        s1[k] = _mm256_loadu_ps(u1 + 8*k);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        __m256 x = _mm256_set1_ps(in[i]);
+
+        for (int k = 0; k < K; k++)
+        {
+            __m256 t = s0[k];
+            s0[k] = _mm256_fmadd_ps(c[k], s0[k], _mm256_sub_ps(x, s1[k]));
+            s1[k] = t;
+        }
+    }
+
+    for (int k = 0; k < K; k++)
+    {
+        _mm256_storeu_ps(u0 + 8*k, s0[k]);
+        _mm256_storeu_ps(u1 + 8*k, s1[k]);
+    }
+}
+
+GOERTZELBANK_TARGET("avx2,fma")
+void GoertzelBank::feedbackAVX2(const float *in, int n, const float *coef, float *u0, float *u1, int nbTones)
+{
+    int j = 0;
+
+    for (; j + 32 <= nbTones; j += 32) {
+        goertzelBlockAVX2<4>(in, n, coef + j, u0 + j, u1 + j);
+    }
+
+    for (; j < nbTones; j += 8) {
+        goertzelBlockAVX2<1>(in, n, coef + j, u0 + j, u1 + j);
+    }
+}
+
+#endif // HBFILTERKERNELS_X86
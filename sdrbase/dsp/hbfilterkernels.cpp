@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "hbfilterkernels.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+HBFilterKernels::SymFIRInt32 HBFilterKernels::m_symFIRInt32 = HBFilterKernels::symFIRInt32Generic;
+HBFilterKernels::SymFIRFloat HBFilterKernels::m_symFIRFloat = HBFilterKernels::symFIRFloatGeneric;
+HBFilterKernels::ISA HBFilterKernels::m_isa = HBFilterKernels::initialize();
+
+HBFilterKernels::ISA HBFilterKernels::initialize()
+{
+    ISA isa = getDetectedISA();
+    setISA(isa);
+    return isa;
+}
+
+HBFilterKernels::ISA HBFilterKernels::getDetectedISA()
+{
+#if defined(HBFILTERKERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return ISAAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return ISASSE4_1;
+    }
+#elif defined(HBFILTERKERNELS_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int nbIds = info[0];
+    __cpuid(info, 1);
+    bool sse41 = (info[2] & (1<<19)) != 0;
+    bool fma = (info[2] & (1<<12)) != 0;
+    bool osxsave = (info[2] & (1<<27)) != 0;
+    bool avx = (info[2] & (1<<28)) != 0;
+    bool avx2 = false;
+
+    if (nbIds >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1<<5)) != 0;
+    }
+
+    if (osxsave && avx && avx2 && fma && ((_xgetbv(0) & 6) == 6)) { // OS saves XMM and YMM state
+        return ISAAVX2;
+    }
+    if (sse41) {
+        return ISASSE4_1;
+    }
+#elif defined(HBFILTERKERNELS_NEON)
+    return ISANEON; // NEON is mandatory on AArch64 and assumed when the compiler targets it on ARMv7
+#endif
+    return ISAGeneric;
+}
+
+bool HBFilterKernels::isSupported(ISA isa)
+{
+    switch (isa)
+    {
+    case ISAGeneric:
+        return true;
+#ifdef HBFILTERKERNELS_X86
+    case ISASSE4_1:
+        return getDetectedISA() >= ISASSE4_1;
+    case ISAAVX2:
+        return getDetectedISA() >= ISAAVX2;
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    case ISANEON:
+        return getDetectedISA() == ISANEON;
+#endif
+    default:
+        return false;
+    }
+}
+
+bool HBFilterKernels::setISA(ISA isa)
+{
+    if (!isSupported(isa)) {
+        return false;
+    }
+
+    switch (isa)
+    {
+#ifdef HBFILTERKERNELS_X86
+    case ISASSE4_1:
+        m_symFIRInt32 = symFIRInt32SSE4_1;
+        m_symFIRFloat = symFIRFloatSSE4_1;
+        break;
+    case ISAAVX2:
+        m_symFIRInt32 = symFIRInt32AVX2;
+        m_symFIRFloat = symFIRFloatAVX2;
+        break;
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    case ISANEON:
+        m_symFIRInt32 = symFIRInt32NEON;
+        m_symFIRFloat = symFIRFloatNEON;
+        break;
+#endif
+    default:
+        m_symFIRInt32 = symFIRInt32Generic;
+        m_symFIRFloat = symFIRFloatGeneric;
+        break;
+    }
+
+    m_isa = isa;
+    return true;
+}
+
+const char *HBFilterKernels::getISAName(ISA isa)
+{
+    switch (isa)
+    {
+    case ISASSE4_1:
+        return "SSE4.1";
+    case ISAAVX2:
+        return "AVX2";
+    case ISANEON:
+        return "NEON";
+    default:
+        return "Generic";
+    }
+}
+
+void HBFilterKernels::symFIRInt32Generic(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc)
+{
+    for (int i = 0; i < nbCoeffs; i++) {
+        acc += (tip[-i] + tail[i]) * coeffs[i];
+    }
+}
+
+void HBFilterKernels::symFIRFloatGeneric(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc)
+{
+    for (int i = 0; i < nbCoeffs; i++) {
+        acc += (tip[-i] + tail[i]) * coeffs[i];
+    }
+}
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_HBFILTERKERNELS_H_
+#define SDRBASE_DSP_HBFILTERKERNELS_H_
+
+#include <stdint.h>
+#include "export.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define HBFILTERKERNELS_X86
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define HBFILTERKERNELS_NEON
+#endif
+
+/**
+ * Symmetric half-band FIR inner products selected at run time according to the
+ * instruction set supported by the CPU. This lets a single binary built for a
+ * generic target still use SSE4.1, AVX2 or NEON in the decimators.
+ *
+ * Each kernel computes acc += sum((tip[-i] + tail[i]) * coeffs[i]) for i in [0, nbCoeffs)
+ * that is the folded half-band products on one of the even/odd double buffers.
+ */
+class SDRBASE_API HBFilterKernels
+{
+public:
+    enum ISA
+    {
+        ISAGeneric,
+        ISASSE4_1,
+        ISAAVX2,
+        ISANEON,
+        ISAEnd
+    };
+
+    typedef void (*SymFIRInt32)(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc);
+    typedef void (*SymFIRFloat)(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc);
+
+    static ISA getDetectedISA();           //!< best instruction set supported by the running CPU
+    static bool isSupported(ISA isa);      //!< true if kernels for this instruction set are built and the CPU supports it
+    static bool setISA(ISA isa);           //!< force the instruction set (mainly for benchmarking). Returns false if not supported
+    static ISA getISA() { return m_isa; }  //!< instruction set currently in use
+    static const char *getISAName(ISA isa);
+
+    static SymFIRInt32 symFIRInt32() { return m_symFIRInt32; }
+    static SymFIRFloat symFIRFloat() { return m_symFIRFloat; }
+
+    // per instruction set implementations
+    static void symFIRInt32Generic(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc);
+    static void symFIRFloatGeneric(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc);
+#ifdef HBFILTERKERNELS_X86
+    static void symFIRInt32SSE4_1(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc);
+    static void symFIRFloatSSE4_1(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc);
+    static void symFIRInt32AVX2(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc);
+    static void symFIRFloatAVX2(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc);
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    static void symFIRInt32NEON(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc);
+    static void symFIRFloatNEON(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc);
+#endif
+
+private:
+    static ISA m_isa;
+    static SymFIRInt32 m_symFIRInt32;
+    static SymFIRFloat m_symFIRFloat;
+
+    static ISA initialize();
+};
+
+/**
+ * Folded half-band products dispatcher used by the even/odd filters. The generic
+ * template covers wide storage (e.g. 64 bit for 24 bit samples) and only the 32 bit
+ * storage with 32 bit accumulator goes through the run time selected kernel.
+ */
+template<typename StorageType, typename AccuType>
+struct HBFilterSymFIR
+{
+    static void work(const StorageType *tip, const StorageType *tail, const int32_t *coeffs, int nbCoeffs, AccuType& acc)
+    {
+        for (int i = 0; i < nbCoeffs; i++) {
+            acc += (tip[-i] + tail[i]) * coeffs[i];
+        }
+    }
+};
+
+template<>
+struct HBFilterSymFIR<int32_t, int32_t>
+{
+    static void work(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc)
+    {
+        HBFilterKernels::symFIRInt32()(tip, tail, coeffs, nbCoeffs, acc);
+    }
+};
+
+#endif /* SDRBASE_DSP_HBFILTERKERNELS_H_ */
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// NEON half-band kernels
+
+#include "hbfilterkernels.h"
+
+#ifdef HBFILTERKERNELS_NEON
+
+#include <arm_neon.h>
+
+static inline int32x4_t hbfilterReverseS32(int32x4_t v)
+{
+    int32x4_t r = vrev64q_s32(v);
+    return vcombine_s32(vget_high_s32(r), vget_low_s32(r));
+}
+
+static inline float32x4_t hbfilterReverseF32(float32x4_t v)
+{
+    float32x4_t r = vrev64q_f32(v);
+    return vcombine_f32(vget_high_f32(r), vget_low_f32(r));
+}
+
+void HBFilterKernels::symFIRInt32NEON(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc)
+{
+    int32x4_t sum = vdupq_n_s32(0);
+    int i = 0;
+
+    for (; i + 4 <= nbCoeffs; i += 4)
+    {
+        int32x4_t sa = hbfilterReverseS32(vld1q_s32(tip - i - 3));
+        int32x4_t sb = vld1q_s32(tail + i);
+        sum = vmlaq_s32(sum, vaddq_s32(sa, sb), vld1q_s32(coeffs + i));
+    }
+
+#ifdef __aarch64__
+    int32_t s = vaddvq_s32(sum);
+#else
+    int32x2_t s2 = vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+    int32_t s = vget_lane_s32(vpadd_s32(s2, s2), 0);
+#endif
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+void HBFilterKernels::symFIRFloatNEON(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    int i = 0;
+
+    for (; i + 4 <= nbCoeffs; i += 4)
+    {
+        float32x4_t sa = hbfilterReverseF32(vld1q_f32(tip - i - 3));
+        float32x4_t sb = vld1q_f32(tail + i);
+        sum = vmlaq_f32(sum, vaddq_f32(sa, sb), vld1q_f32(coeffs + i));
+    }
+
+#ifdef __aarch64__
+    float s = vaddvq_f32(sum);
+#else
+    float32x2_t s2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    float s = vget_lane_f32(vpadd_f32(s2, s2), 0);
+#endif
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+#endif // HBFILTERKERNELS_NEON
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// SSE4.1 and AVX2 half-band kernels. These are compiled with per function target
+// attributes (or unconditionally with MSVC) so that the rest of the library can be
+// built for a baseline target and the kernels selected at run time.
+
+#include "hbfilterkernels.h"
+
+#ifdef HBFILTERKERNELS_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define HBFILTERKERNELS_TARGET(isa) __attribute__((target(isa)))
+#else
+#define HBFILTERKERNELS_TARGET(isa)
+#endif
+
+HBFILTERKERNELS_TARGET("sse4.1")
+void HBFilterKernels::symFIRInt32SSE4_1(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc)
+{
+    __m128i sum = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= nbCoeffs; i += 4)
+    {
+        __m128i sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tip - i - 3)), _MM_SHUFFLE(0,1,2,3));
+        __m128i sb = _mm_loadu_si128((const __m128i*) (tail + i));
+        __m128i h = _mm_loadu_si128((const __m128i*) (coeffs + i));
+        sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_add_epi32(sa, sb), h));
+    }
+
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1,0,3,2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2,3,0,1)));
+    int32_t s = _mm_cvtsi128_si32(sum);
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+HBFILTERKERNELS_TARGET("sse4.1")
+void HBFilterKernels::symFIRFloatSSE4_1(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc)
+{
+    __m128 sum = _mm_setzero_ps();
+    int i = 0;
+
+    for (; i + 4 <= nbCoeffs; i += 4)
+    {
+        __m128 sa = _mm_loadu_ps(tip - i - 3);
+        sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+        __m128 sb = _mm_loadu_ps(tail + i);
+        __m128 h = _mm_loadu_ps(coeffs + i);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_add_ps(sa, sb), h));
+    }
+
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1,1,1,1)));
+    float s = _mm_cvtss_f32(sum);
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+HBFILTERKERNELS_TARGET("avx2")
+void HBFilterKernels::symFIRInt32AVX2(const int32_t *tip, const int32_t *tail, const int32_t *coeffs, int nbCoeffs, int32_t& acc)
+{
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256i sum8 = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= nbCoeffs; i += 8)
+    {
+        __m256i sa = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) (tip - i - 7)), reverse);
+        __m256i sb = _mm256_loadu_si256((const __m256i*) (tail + i));
+        __m256i h = _mm256_loadu_si256((const __m256i*) (coeffs + i));
+        sum8 = _mm256_add_epi32(sum8, _mm256_mullo_epi32(_mm256_add_epi32(sa, sb), h));
+    }
+
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(sum8), _mm256_extracti128_si256(sum8, 1));
+
+    if (i + 4 <= nbCoeffs) // hbOrder/4 is a multiple of 4 so at most one 4 wide remainder
+    {
+        __m128i sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tip - i - 3)), _MM_SHUFFLE(0,1,2,3));
+        __m128i sb = _mm_loadu_si128((const __m128i*) (tail + i));
+        __m128i h = _mm_loadu_si128((const __m128i*) (coeffs + i));
+        sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_add_epi32(sa, sb), h));
+        i += 4;
+    }
+
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1,0,3,2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2,3,0,1)));
+    int32_t s = _mm_cvtsi128_si32(sum);
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+HBFILTERKERNELS_TARGET("avx2,fma")
+void HBFilterKernels::symFIRFloatAVX2(const float *tip, const float *tail, const float *coeffs, int nbCoeffs, float& acc)
+{
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256 sum8 = _mm256_setzero_ps();
+    int i = 0;
+
+    for (; i + 8 <= nbCoeffs; i += 8)
+    {
+        __m256 sa = _mm256_permutevar8x32_ps(_mm256_loadu_ps(tip - i - 7), reverse);
+        __m256 sb = _mm256_loadu_ps(tail + i);
+        __m256 h = _mm256_loadu_ps(coeffs + i);
+        sum8 = _mm256_fmadd_ps(_mm256_add_ps(sa, sb), h, sum8);
+    }
+
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum8), _mm256_extractf128_ps(sum8, 1));
+
+    if (i + 4 <= nbCoeffs)
+    {
+        __m128 sa = _mm_loadu_ps(tip - i - 3);
+        sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+        __m128 sb = _mm_loadu_ps(tail + i);
+        __m128 h = _mm_loadu_ps(coeffs + i);
+        sum = _mm_fmadd_ps(_mm_add_ps(sa, sb), h, sum);
+        i += 4;
+    }
+
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1,1,1,1)));
+    float s = _mm_cvtss_f32(sum);
+
+    for (; i < nbCoeffs; i++) {
+        s += (tip[-i] + tail[i]) * coeffs[i];
+    }
+
+    acc += s;
+}
+
+#endif // HBFILTERKERNELS_X86
@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
+#include "dsp/hbfilterkernels.h"
 
 template<typename EOStorageType, typename AccuType, uint32_t HBFilterOrder>
 class IntHalfbandFilterEO {
@@ -844,23 +845,10 @@ protected:
 
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
+        EOStorageType (*buf)[HBFIRFilterTraits<HBFilterOrder>::hbOrder] = (m_ptr % 2) == 0 ? m_even : m_odd;
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            if ((m_ptr % 2) == 0)
-            {
-                iAcc += (m_even[0][a] + m_even[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += (m_even[1][a] + m_even[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-            else
-            {
-                iAcc += (m_odd[0][a] + m_odd[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += (m_odd[1][a] + m_odd[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
-        }
+        HBFilterSymFIR<EOStorageType, AccuType>::work(&buf[0][a], &buf[0][b], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc);
+        HBFilterSymFIR<EOStorageType, AccuType>::work(&buf[1][a], &buf[1][b], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, qAcc);
 
         if ((m_ptr % 2) == 0)
         {
@@ -884,23 +872,10 @@ protected:
 
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
+        EOStorageType (*buf)[HBFIRFilterTraits<HBFilterOrder>::hbOrder] = (m_ptr % 2) == 0 ? m_even : m_odd;
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            if ((m_ptr % 2) == 0)
-            {
-                iAcc += (m_even[0][a] + m_even[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += (m_even[1][a] + m_even[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-            else
-            {
-                iAcc += (m_odd[0][a] + m_odd[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += (m_odd[1][a] + m_odd[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
-        }
+        HBFilterSymFIR<EOStorageType, AccuType>::work(&buf[0][a], &buf[0][b], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc);
+        HBFilterSymFIR<EOStorageType, AccuType>::work(&buf[1][a], &buf[1][b], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, qAcc);
 
         if ((m_ptr % 2) == 0)
         {
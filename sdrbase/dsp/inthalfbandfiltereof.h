@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
+#include "dsp/hbfilterkernels.h"
 #include "export.h"
 
 template<uint32_t HBFilterOrder>
@@ -61,6 +62,77 @@ public:
         }
     }
 
+    bool workDecimateCenter(FSample* sample)
+    {
+        return workDecimateCenter(&sample->m_real, &sample->m_imag);
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    bool workDecimateLowerHalf(FSample* sample)
+    {
+        switch(m_state)
+        {
+            case 0:
+                storeSample(-sample->imag(), sample->real());
+                advancePointer();
+                m_state = 1;
+                return false;
+
+            case 1:
+                storeSample(-sample->real(), -sample->imag());
+                doFIR(&sample->m_real, &sample->m_imag);
+                advancePointer();
+                m_state = 2;
+                return true;
+
+            case 2:
+                storeSample(sample->imag(), -sample->real());
+                advancePointer();
+                m_state = 3;
+                return false;
+
+            default:
+                storeSample(sample->real(), sample->imag());
+                doFIR(&sample->m_real, &sample->m_imag);
+                advancePointer();
+                m_state = 0;
+                return true;
+        }
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    bool workDecimateUpperHalf(FSample* sample)
+    {
+        switch(m_state)
+        {
+            case 0:
+                storeSample(sample->imag(), -sample->real());
+                advancePointer();
+                m_state = 1;
+                return false;
+
+            case 1:
+                storeSample(-sample->real(), -sample->imag());
+                doFIR(&sample->m_real, &sample->m_imag);
+                advancePointer();
+                m_state = 2;
+                return true;
+
+            case 2:
+                storeSample(-sample->imag(), sample->real());
+                advancePointer();
+                m_state = 3;
+                return false;
+
+            default:
+                storeSample(sample->real(), sample->imag());
+                doFIR(&sample->m_real, &sample->m_imag);
+                advancePointer();
+                m_state = 0;
+                return true;
+        }
+    }
+
     void myDecimate(float x1, float y1, float *x2, float *y2)
     {
         storeSample(x1, y1);
@@ -143,6 +215,7 @@ protected:
     float m_even[2][HBFIRFilterTraits<HBFilterOrder>::hbOrder];    // double buffer technique
     float m_odd[2][HBFIRFilterTraits<HBFilterOrder>::hbOrder];     // double buffer technique
     float m_samples[HBFIRFilterTraits<HBFilterOrder>::hbOrder][2]; // double buffer technique
+    float m_coeffs[HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4]; //!< single precision copy of the coefficients for the SIMD kernels
 
     int m_ptr;
     int m_size;
@@ -176,35 +249,14 @@ protected:
         float iAcc = 0;
         float qAcc = 0;
 
-//#if defined(USE_SSE4_1) && !defined(NO_DSP_SIMD)
-//        IntHalfbandFilterEO1Intrisics<HBFilterOrder>::work(
-//                m_ptr,
-//                m_even,
-//                m_odd,
-//                iAcc,
-//                qAcc
-//        );
-//#else
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
+        float (*buf)[HBFIRFilterTraits<HBFilterOrder>::hbOrder] = (m_ptr % 2) == 0 ? m_even : m_odd;
+        HBFilterKernels::SymFIRFloat symFIR = HBFilterKernels::symFIRFloat();
+
+        symFIR(&buf[0][a], &buf[0][b], m_coeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, iAcc);
+        symFIR(&buf[1][a], &buf[1][b], m_coeffs, HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4, qAcc);
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            if ((m_ptr % 2) == 0)
-            {
-                iAcc += (m_even[0][a] + m_even[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-                qAcc += (m_even[1][a] + m_even[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-            }
-            else
-            {
-                iAcc += (m_odd[0][a] + m_odd[0][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-                qAcc += (m_odd[1][a] + m_odd[1][b]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
-            }
-
-            a -= 1;
-            b += 1;
-        }
-//#endif
         if ((m_ptr % 2) == 0)
         {
             iAcc += m_odd[0][m_ptr/2 + m_size/2] * 0.5f;
@@ -257,6 +309,10 @@ IntHalfbandFilterEOF<HBFilterOrder>::IntHalfbandFilterEOF()
         m_samples[i][1] = 0.0f;
     }
 
+    for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++) {
+        m_coeffs[i] = HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+    }
+
     m_ptr = 0;
     m_state = 0;
 }
@@ -1,17 +1,85 @@
+#include <cmath>
+
 #include "dsp/kissengine.h"
 
+KissEngine::KissEngine() :
+	m_real(false),
+	m_inverse(false),
+	m_n(0)
+{
+}
+
 void KissEngine::configure(int n, bool inverse)
 {
 	m_fft.configure(n, inverse);
+	m_real = false;
+	m_inverse = inverse;
+	m_n = n;
 	if(n > m_in.size())
 		m_in.resize(n);
 	if(n > m_out.size())
 		m_out.resize(n);
 }
 
+void KissEngine::configureReal(int n, bool inverse)
+{
+	int half = n / 2;
+	m_fft.configure(half, inverse);
+	m_real = true;
+	m_inverse = inverse;
+	m_n = n;
+	if(half + 1 > m_in.size())
+		m_in.resize(half + 1);
+	if(half + 1 > m_out.size())
+		m_out.resize(half + 1);
+	m_packed.resize(half);
+	m_work.resize(half);
+	m_twiddles.resize(half + 1);
+
+	for(int k = 0; k <= half; k++) {
+		double phase = -2.0 * M_PI * k / n;
+		m_twiddles[k] = Complex(cos(phase), sin(phase));
+	}
+}
+
 void KissEngine::transform()
 {
-	m_fft.transform(&m_in[0], &m_out[0]);
+	if(!m_real)
+		m_fft.transform(&m_in[0], &m_out[0]);
+	else if(m_inverse)
+		transformRealInverse();
+	else
+		transformRealForward();
+}
+
+void KissEngine::transformRealForward()
+{
+	// Z = FFT(x[2k] + i.x[2k+1]) then X[k] = Xeven[k] + W^k.Xodd[k]
+	// with Xeven[k] = (Z[k] + Z*[n/2-k]) / 2 and Xodd[k] = (Z[k] - Z*[n/2-k]) / 2i
+	int half = m_n / 2;
+	m_fft.transform(&m_packed[0], &m_work[0]);
+
+	for(int k = 0; k <= half; k++) {
+		Complex z = m_work[k == half ? 0 : k];
+		Complex zc = std::conj(m_work[k == 0 ? 0 : half - k]);
+		Complex even = (z + zc) * 0.5f;
+		Complex odd = (z - zc) * Complex(0.0f, -0.5f);
+		m_out[k] = even + m_twiddles[k] * odd;
+	}
+}
+
+void KissEngine::transformRealInverse()
+{
+	// Z[k] = (X[k] + X*[n/2-k]) + i.W^-k.(X[k] - X*[n/2-k]) then x[2k] + i.x[2k+1] = IFFT(Z)
+	int half = m_n / 2;
+
+	for(int k = 0; k < half; k++) {
+		Complex x = m_in[k];
+		Complex xc = std::conj(m_in[half - k]);
+		m_work[k] = (x + xc) + Complex(0.0f, 1.0f) * std::conj(m_twiddles[k]) * (x - xc);
+	}
+
+	m_fft.transform(&m_work[0], &m_packed[0]);
 }
 
 Complex* KissEngine::in()
@@ -23,3 +91,13 @@ Complex* KissEngine::out()
 {
 	return &m_out[0];
 }
+
+Real* KissEngine::realIn()
+{
+	return reinterpret_cast<Real*>(&m_packed[0]);
+}
+
+Real* KissEngine::realOut()
+{
+	return reinterpret_cast<Real*>(&m_packed[0]);
+}
@@ -7,11 +7,16 @@
 
 class SDRBASE_API KissEngine : public FFTEngine {
 public:
+	KissEngine();
+
 	void configure(int n, bool inverse);
+	void configureReal(int n, bool inverse);
 	void transform();
 
 	Complex* in();
 	Complex* out();
+	Real* realIn();
+	Real* realOut();
 
 protected:
 	typedef kissfft<Real, Complex> KissFFT;
@@ -19,6 +24,17 @@ protected:
 
 	std::vector<Complex> m_in;
 	std::vector<Complex> m_out;
+
+	// real transforms of size n run a complex transform of size n/2 on the samples packed in pairs
+	bool m_real;
+	bool m_inverse;
+	int m_n;
+	std::vector<Complex> m_packed;   //!< even and odd real samples as real and imaginary parts
+	std::vector<Complex> m_work;     //!< transform of the packed samples
+	std::vector<Complex> m_twiddles; //!< exp(-2*pi*i*k/n) for k in [0, n/2]
+
+	void transformRealForward();
+	void transformRealInverse();
 };
 
 #endif // INCLUDE_KISSENGINE_H
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "dsp/dspcommands.h"
+#include "dsp/samplesinkfifo.h"
+#include "polyphasechannelizer.h"
+
+PolyphaseChannelizer::PolyphaseChannelizer(unsigned int nbSubbands) :
+    m_filterBank(nbSubbands),
+    m_inputSampleRate(0)
+{
+    setObjectName("PolyphaseChannelizer");
+    m_subbandBuffers.resize(m_filterBank.getNbSubbands());
+}
+
+PolyphaseChannelizer::~PolyphaseChannelizer()
+{
+}
+
+void PolyphaseChannelizer::start()
+{
+    qDebug("PolyphaseChannelizer::start: %u sub-bands input rate: %d", getNbSubbands(), m_inputSampleRate);
+}
+
+void PolyphaseChannelizer::stop()
+{
+}
+
+void PolyphaseChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_subscribers.size() == 0) {
+        return;
+    }
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        if (!m_filterBank.work(Complex(it->m_real, it->m_imag))) {
+            continue;
+        }
+
+        const Complex *out = m_filterBank.out();
+
+        for (std::vector<int>::const_iterator k = m_activeSubbands.begin(); k != m_activeSubbands.end(); ++k)
+        {
+            Real re = std::max(-SDR_RX_SCALEF, std::min(SDR_RX_SCALEF - 1.0f, out[*k].real()));
+            Real im = std::max(-SDR_RX_SCALEF, std::min(SDR_RX_SCALEF - 1.0f, out[*k].imag()));
+            m_subbandBuffers[*k].push_back(Sample((FixReal) lrintf(re), (FixReal) lrintf(im)));
+        }
+    }
+
+    for (std::vector<Subscriber>::iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        const SampleVector& buffer = m_subbandBuffers[it->m_subband];
+        it->m_fifo->write(buffer.begin(), buffer.end());
+    }
+
+    for (std::vector<int>::const_iterator k = m_activeSubbands.begin(); k != m_activeSubbands.end(); ++k) {
+        m_subbandBuffers[*k].clear();
+    }
+}
+
+bool PolyphaseChannelizer::handleMessage(const Message& cmd)
+{
+    if (DSPSignalNotification::match(cmd))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+        m_inputSampleRate = notif.getSampleRate();
+        qDebug() << "PolyphaseChannelizer::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_inputSampleRate;
+        return true;
+    }
+    else if (BasebandSampleSink::MsgThreadedSink::match(cmd))
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+int PolyphaseChannelizer::getSubbandIndex(int sampleRate, qint64 centerFrequency, int bandwidth) const
+{
+    if ((sampleRate <= 0) || (bandwidth <= 0)) {
+        return -1;
+    }
+
+    int nbSubbands = getNbSubbands();
+    double spacing = sampleRate / (double) nbSubbands;
+    int k = (int) std::lround(centerFrequency / spacing);
+
+    // sub-bands cover [-nbSubbands/2, nbSubbands/2) like in getSubbandFrequency
+    if ((k >= nbSubbands/2) || (k < -nbSubbands/2)) {
+        return -1;
+    }
+
+    if (std::fabs(centerFrequency - k*spacing) + bandwidth/2.0 > PolyphaseFilterBank::m_passband * spacing) {
+        return -1;
+    }
+
+    return k < 0 ? k + nbSubbands : k;
+}
+
+qint64 PolyphaseChannelizer::getSubbandFrequency(int sampleRate, int subband) const
+{
+    int nbSubbands = getNbSubbands();
+    int k = subband < nbSubbands/2 ? subband : subband - nbSubbands;
+    return (k * (qint64) sampleRate) / nbSubbands;
+}
+
+void PolyphaseChannelizer::attach(int subband, SampleSinkFifo *fifo)
+{
+    if ((subband < 0) || (subband >= (int) getNbSubbands())) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_subscribers.size() == 0) {
+        m_filterBank.reset();
+    }
+
+    m_subscribers.push_back(Subscriber(subband, fifo));
+    updateActiveSubbands();
+    qDebug("PolyphaseChannelizer::attach: sub-band %d: %lu subscribers", subband, m_subscribers.size());
+}
+
+void PolyphaseChannelizer::detach(SampleSinkFifo *fifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<Subscriber>::iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        if (it->m_fifo == fifo)
+        {
+            m_subscribers.erase(it);
+            break;
+        }
+    }
+
+    updateActiveSubbands();
+}
+
+unsigned int PolyphaseChannelizer::getNbAttached()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_subscribers.size();
+}
+
+void PolyphaseChannelizer::updateActiveSubbands()
+{
+    m_activeSubbands.clear();
+
+    for (std::vector<Subscriber>::const_iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        if (std::find(m_activeSubbands.begin(), m_activeSubbands.end(), it->m_subband) == m_activeSubbands.end()) {
+            m_activeSubbands.push_back(it->m_subband);
+        }
+    }
+}
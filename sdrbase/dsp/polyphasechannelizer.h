@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_POLYPHASECHANNELIZER_H_
+#define SDRBASE_DSP_POLYPHASECHANNELIZER_H_
+
+#include <vector>
+#include <QMutex>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/polyphasefilterbank.h"
+#include "export.h"
+
+class SampleSinkFifo;
+
+/**
+ * Splits the device baseband in uniform sub-bands once for all the channels of a device.
+ * It is fed by the device engine like any threaded sink. Narrowband channels attach a FIFO
+ * to the sub-band that contains them and only have to fine tune and resample at the sub-band
+ * rate (see DownChannelizer::setPolyphaseChannelizer). When no channel is attached the
+ * filter bank does not run.
+ */
+class SDRBASE_API PolyphaseChannelizer : public BasebandSampleSink {
+    Q_OBJECT
+public:
+    PolyphaseChannelizer(unsigned int nbSubbands = 32);
+    virtual ~PolyphaseChannelizer();
+
+    virtual void start();
+    virtual void stop();
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual bool handleMessage(const Message& cmd);
+
+    unsigned int getNbSubbands() const { return m_filterBank.getNbSubbands(); }
+    int getSubbandIndex(int sampleRate, qint64 centerFrequency, int bandwidth) const; //!< sub-band containing the channel or -1 if it does not fit in any
+    qint64 getSubbandFrequency(int sampleRate, int subband) const; //!< sub-band center frequency relative to the baseband center
+    int getSubbandSampleRate(int sampleRate) const { return (2 * sampleRate) / (int) getNbSubbands(); }
+
+    void attach(int subband, SampleSinkFifo *fifo); //!< sub-band samples are written to the FIFO from the channelizer thread
+    void detach(SampleSinkFifo *fifo);
+    unsigned int getNbAttached();
+
+private:
+    struct Subscriber
+    {
+        int m_subband;
+        SampleSinkFifo *m_fifo;
+
+        Subscriber(int subband, SampleSinkFifo *fifo) :
+            m_subband(subband),
+            m_fifo(fifo)
+        {}
+    };
+
+    PolyphaseFilterBank m_filterBank;
+    std::vector<Subscriber> m_subscribers;
+    std::vector<int> m_activeSubbands;          //!< distinct sub-bands with at least one subscriber
+    std::vector<SampleVector> m_subbandBuffers; //!< sub-band samples of the current block indexed by sub-band
+    int m_inputSampleRate;
+    QMutex m_mutex;
+
+    void updateActiveSubbands();
+};
+
+#endif // SDRBASE_DSP_POLYPHASECHANNELIZER_H_
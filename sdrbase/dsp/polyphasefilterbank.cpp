@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include "dsp/fftengine.h"
+#include "polyphasefilterbank.h"
+
+const float PolyphaseFilterBank::m_passband = 0.75f;
+const float PolyphaseFilterBank::m_stopband = 1.25f;
+
+PolyphaseFilterBank::PolyphaseFilterBank(unsigned int nbSubbands, unsigned int tapsPerPhase) :
+    m_nbSubbands(nbSubbands < 4 ? 4 : nbSubbands & ~1U),
+    m_decimation(m_nbSubbands / 2),
+    m_length(m_nbSubbands * tapsPerPhase),
+    m_historyIndex(0),
+    m_phase(0),
+    m_oddOutput(false)
+{
+    // Prototype lowpass cut at the middle of the transition band i.e. at the sub-band spacing fs/M
+    const double beta = 8.0; // Kaiser window beta for about 80 dB stopband attenuation
+    const double fc = (m_passband + m_stopband) / (2.0 * m_nbSubbands);
+    const double center = (m_length - 1) / 2.0;
+    const double i0Beta = besselI0(beta);
+    std::vector<double> h(m_length);
+    double sum = 0.0;
+
+    for (unsigned int i = 0; i < m_length; i++)
+    {
+        double t = i - center;
+        double sinc = t == 0.0 ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        double r = t / center;
+        double w = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - r*r))) / i0Beta;
+        h[i] = sinc * w;
+        sum += h[i];
+    }
+
+    m_prototype.resize(m_length);
+
+    for (unsigned int i = 0; i < m_length; i++) {
+        m_prototype[i] = h[m_length - 1 - i] / sum; // unity gain at DC
+    }
+
+    m_history.resize(2 * m_length);
+    m_fft = FFTEngine::create();
+    m_fft->configure(m_nbSubbands, true);
+    m_out = m_fft->out();
+    reset();
+}
+
+PolyphaseFilterBank::~PolyphaseFilterBank()
+{
+    delete m_fft;
+}
+
+void PolyphaseFilterBank::reset()
+{
+    std::fill(m_history.begin(), m_history.end(), Complex{0.0f, 0.0f});
+    std::fill(m_out, m_out + m_nbSubbands, Complex{0.0f, 0.0f});
+    m_historyIndex = 0;
+    m_phase = 0;
+    m_oddOutput = false;
+}
+
+/**
+ * Sub-band k sample n is y_k[n] = sum_l h[l] x[nD-l] exp(-j2pi k (nD-l)/M) with D = M/2.
+ * Splitting l = p + qM gives y_k[n] = (-1)^(kn) sum_p exp(j2pi kp/M) u[p]
+ * with u[p] = sum_q h[p+qM] x[nD-p-qM] that is the polyphase components of the filter
+ * followed by an inverse FFT and a sign flip of odd sub-bands on odd outputs.
+ */
+void PolyphaseFilterBank::analyze()
+{
+    const Complex *x = &m_history[m_historyIndex]; // last m_length samples, oldest first
+    const float *g = m_prototype.data();
+    Complex *in = m_fft->in();
+    unsigned int M = m_nbSubbands;
+
+    for (unsigned int r = 0; r < M; r++)
+    {
+        float accR = 0.0f;
+        float accI = 0.0f;
+
+        for (unsigned int j = r; j < m_length; j += M)
+        {
+            accR += g[j] * x[j].real();
+            accI += g[j] * x[j].imag();
+        }
+
+        in[M - 1 - r] = Complex{accR, accI}; // x[j] is x[nD - (m_length-1-j)] so r maps to phase M-1-r
+    }
+
+    m_fft->transform();
+    m_out = m_fft->out();
+
+    if (m_oddOutput)
+    {
+        for (unsigned int k = 1; k < M; k += 2) {
+            m_out[k] = -m_out[k];
+        }
+    }
+
+    m_oddOutput = !m_oddOutput;
+}
+
+double PolyphaseFilterBank::besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    double halfX = x / 2.0;
+
+    for (int k = 1; k < 50; k++)
+    {
+        term *= halfX / k;
+        double term2 = term * term;
+        sum += term2;
+
+        if (term2 < sum * 1e-12) {
+            break;
+        }
+    }
+
+    return sum;
+}
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_POLYPHASEFILTERBANK_H_
+#define SDRBASE_DSP_POLYPHASEFILTERBANK_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class FFTEngine;
+
+/**
+ * Uniform analysis filter bank splitting a complex baseband of rate fs into M sub-bands
+ * spaced by fs/M. It is oversampled by 2: each sub-band is output at 2fs/M so that the
+ * output rate is obtained by decimating by M/2 and a new set of M sub-band samples is
+ * produced every M/2 input samples with one M points FFT.
+ *
+ * The prototype lowpass passes +/- 0.75 fs/M and stops from 1.25 fs/M (Kaiser window, about 80 dB)
+ * thus the aliases land outside the +/- 0.75 fs/M passband of each sub-band. A channel fits
+ * a sub-band if it is completely within this passband.
+ *
+ * Sub-band k is centered on k fs/M for k < M/2 and on (k - M) fs/M for k >= M/2.
+ * The phase of the sub-band samples is referenced to the input time so that each sub-band
+ * is a continuous down converted and decimated copy of the input.
+ */
+class SDRBASE_API PolyphaseFilterBank
+{
+public:
+    PolyphaseFilterBank(unsigned int nbSubbands, unsigned int tapsPerPhase = 12);
+    ~PolyphaseFilterBank();
+
+    unsigned int getNbSubbands() const { return m_nbSubbands; }
+    unsigned int getDecimation() const { return m_decimation; }
+
+    /** Push one input sample. Returns true when a new set of sub-band samples is available in out() */
+    bool work(const Complex& s)
+    {
+        m_history[m_historyIndex] = s;
+        m_history[m_historyIndex + m_length] = s;
+        m_historyIndex = (m_historyIndex + 1) % m_length;
+
+        if (++m_phase < m_decimation) {
+            return false;
+        }
+
+        m_phase = 0;
+        analyze();
+        return true;
+    }
+
+    const Complex *out() const { return m_out; } //!< last set of M sub-band samples indexed by sub-band
+    void reset();
+
+    static const float m_passband;  //!< sub-band passband half width relative to the sub-band spacing
+    static const float m_stopband;  //!< sub-band stopband start relative to the sub-band spacing
+
+private:
+    unsigned int m_nbSubbands;      //!< M
+    unsigned int m_decimation;      //!< M/2
+    unsigned int m_length;          //!< prototype filter length M * taps per phase
+    std::vector<float> m_prototype; //!< prototype filter reversed so that it lines up with the history oldest sample first
+    std::vector<Complex> m_history; //!< last input samples stored twice so that the filter span is contiguous
+    unsigned int m_historyIndex;    //!< next write index in the first half of the history
+    unsigned int m_phase;           //!< input samples since last output
+    bool m_oddOutput;               //!< output index parity
+    FFTEngine *m_fft;
+    Complex *m_out;
+
+    void analyze();
+    static double besselI0(double x);
+};
+
+#endif // SDRBASE_DSP_POLYPHASEFILTERBANK_H_
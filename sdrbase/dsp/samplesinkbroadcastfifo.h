@@ -0,0 +1,275 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLESINKBROADCASTFIFO_H_
+#define SDRBASE_DSP_SAMPLESINKBROADCASTFIFO_H_
+
+#include <vector>
+#include <algorithm>
+
+#include <QObject>
+#include <QAtomicInteger>
+#include <QTime>
+#include <QDebug>
+
+#include "dsp/dsptypes.h"
+#include "dsp/samplesinkfifo.h"
+#include "export.h"
+
+#define SAMPLESINKBROADCASTFIFO_CACHELINE_SIZE 64
+
+/**
+ * Sample FIFO with one writer and several readers each with its own read cursor.
+ * Samples are written once and each reader goes through them at its own pace. Space is
+ * reclaimed by the writer only when the slowest reader has gone past it so the slowest
+ * reader sets the overflow condition for all readers.
+ *
+ * Readers are added and removed in the writer thread. A reader must not be reading
+ * anymore when it is removed.
+ * T is the sample type: Sample for the fixed point baseband or FSample for the float baseband.
+ */
+template<typename T>
+class SampleSinkBroadcastFifoT : public SampleSinkFifoSignals {
+public:
+    typedef std::vector<T> Vector;
+
+    class Reader {
+    public:
+        Reader(quint32 head) : m_head(head) {}
+    private:
+        QAtomicInteger<quint32> m_head; //!< read index in [0, 2*size[ only updated by this reader
+        char m_padding[SAMPLESINKBROADCASTFIFO_CACHELINE_SIZE - sizeof(QAtomicInteger<quint32>)];
+        friend class SampleSinkBroadcastFifoT<T>;
+    };
+
+    SampleSinkBroadcastFifoT(int size = 1<<18, QObject* parent = 0) :
+        SampleSinkFifoSignals(parent),
+        m_suppressed(-1),
+        m_size(0),
+        m_tail(0)
+    {
+        setSize(size);
+    }
+
+    ~SampleSinkBroadcastFifoT()
+    {
+        for (typename std::vector<Reader*>::iterator it = m_readers.begin(); it != m_readers.end(); ++it) {
+            delete *it;
+        }
+    }
+
+    bool setSize(int size)
+    {
+        m_data.resize(size);
+        m_size = m_data.size();
+        m_tail.storeRelease(0);
+
+        for (typename std::vector<Reader*>::iterator it = m_readers.begin(); it != m_readers.end(); ++it) {
+            (*it)->m_head.storeRelease(0);
+        }
+
+        if (m_size != (uint) size) {
+            qCritical("SampleSinkBroadcastFifo: out of memory");
+        }
+
+        return m_size == (uint) size;
+    }
+
+    uint size() const { return m_size; }
+
+    Reader *addReader() //!< create a new reader starting at the current write position
+    {
+        Reader *reader = new Reader(m_tail.loadAcquire());
+        m_readers.push_back(reader);
+        qDebug("SampleSinkBroadcastFifo::addReader: %lu readers", m_readers.size());
+        return reader;
+    }
+
+    void removeReader(Reader *reader) //!< remove and delete reader
+    {
+        typename std::vector<Reader*>::iterator it = std::find(m_readers.begin(), m_readers.end(), reader);
+
+        if (it != m_readers.end())
+        {
+            m_readers.erase(it);
+            delete reader;
+        }
+
+        qDebug("SampleSinkBroadcastFifo::removeReader: %lu readers", m_readers.size());
+    }
+
+    unsigned int getNbReaders() const { return m_readers.size(); }
+
+    uint write(typename Vector::const_iterator begin, typename Vector::const_iterator end)
+    {
+        uint count = end - begin;
+        uint tail = m_tail.loadAcquire();
+
+        if (m_readers.size() == 0) { // nobody to read the samples
+            return 0;
+        }
+
+        uint total = std::min(count, room());
+
+        if (total < count)
+        {
+            if (m_suppressed < 0)
+            {
+                m_suppressed = 0;
+                m_msgRateTimer.start();
+                qCritical("SampleSinkBroadcastFifo: overflow - dropping %u samples", count - total);
+            }
+            else
+            {
+                if (m_msgRateTimer.elapsed() > 2500)
+                {
+                    qCritical("SampleSinkBroadcastFifo: %u messages dropped", m_suppressed);
+                    qCritical("SampleSinkBroadcastFifo: overflow - dropping %u samples", count - total);
+                    m_suppressed = -1;
+                }
+                else
+                {
+                    m_suppressed++;
+                }
+            }
+        }
+
+        uint remaining = total;
+        uint writePos = position(tail);
+
+        while (remaining > 0)
+        {
+            uint len = std::min(remaining, m_size - writePos);
+            std::copy(begin, begin + len, m_data.begin() + writePos);
+            writePos = (writePos + len) % m_size;
+            begin += len;
+            remaining -= len;
+        }
+
+        m_tail.storeRelease(advance(tail, total)); // publish the samples to all readers
+
+        if (total > 0) {
+            emit dataReady();
+        }
+
+        return total;
+    }
+
+    uint room() const //!< samples that can be written before the slowest reader overflows
+    {
+        uint tail = m_tail.loadAcquire();
+        uint maxFill = 0;
+
+        for (typename std::vector<Reader*>::const_iterator it = m_readers.begin(); it != m_readers.end(); ++it) {
+            maxFill = std::max(maxFill, distance((*it)->m_head.loadAcquire(), tail));
+        }
+
+        return m_size - maxFill;
+    }
+
+    uint waitRoom(uint count, unsigned long timeoutMs) { return m_roomWaiter.wait(*this, count, timeoutMs); } //!< writer: wait for the slowest reader to make room for count samples. Returns the room
+    void interruptWaitRoom() { m_roomWaiter.interrupt(); } //!< make a writer blocked in waitRoom return e.g. to stop it
+
+    bool isEmpty() const { return room() == m_size; } //!< all readers have gone through all the samples written
+
+    uint fill(const Reader *reader) const { return distance(reader->m_head.loadAcquire(), m_tail.loadAcquire()); }
+
+    uint readBegin(Reader *reader, uint count,
+        typename Vector::iterator* part1Begin, typename Vector::iterator* part1End,
+        typename Vector::iterator* part2Begin, typename Vector::iterator* part2End)
+    {
+        uint head = reader->m_head.loadAcquire();
+        uint readPos = position(head);
+        uint total = std::min(count, distance(head, m_tail.loadAcquire()));
+        uint remaining = total;
+
+        if (total < count) {
+            qCritical("SampleSinkBroadcastFifo: underflow - missing %u samples", count - total);
+        }
+
+        if (remaining > 0)
+        {
+            uint len = std::min(remaining, m_size - readPos);
+            *part1Begin = m_data.begin() + readPos;
+            *part1End = m_data.begin() + readPos + len;
+            readPos = (readPos + len) % m_size;
+            remaining -= len;
+        }
+        else
+        {
+            *part1Begin = m_data.end();
+            *part1End = m_data.end();
+        }
+
+        if (remaining > 0)
+        {
+            uint len = std::min(remaining, m_size - readPos);
+            *part2Begin = m_data.begin() + readPos;
+            *part2End = m_data.begin() + readPos + len;
+        }
+        else
+        {
+            *part2Begin = m_data.end();
+            *part2End = m_data.end();
+        }
+
+        return total;
+    }
+
+    uint readCommit(Reader *reader, uint count)
+    {
+        uint head = reader->m_head.loadAcquire();
+        uint fill = distance(head, m_tail.loadAcquire());
+
+        if (count > fill)
+        {
+            qCritical("SampleSinkBroadcastFifo: cannot commit more than available samples");
+            count = fill;
+        }
+
+        reader->m_head.storeRelease(advance(head, count)); // hand back the space to the writer
+        m_roomWaiter.wake();
+
+        return count;
+    }
+
+private:
+    QTime m_msgRateTimer;
+    int m_suppressed;
+    Vector m_data;
+    uint m_size;
+    std::vector<Reader*> m_readers;
+    SampleFifoRoomWaiter m_roomWaiter;
+
+    char m_tailPadding[SAMPLESINKBROADCASTFIFO_CACHELINE_SIZE];
+    QAtomicInteger<quint32> m_tail; //!< write index in [0, 2*m_size[ only updated by the writer
+    char m_endPadding[SAMPLESINKBROADCASTFIFO_CACHELINE_SIZE - sizeof(QAtomicInteger<quint32>)];
+
+    inline uint distance(uint head, uint tail) const { return tail >= head ? tail - head : tail + 2*m_size - head; }
+    inline uint advance(uint index, uint count) const { index += count; return index >= 2*m_size ? index - 2*m_size : index; }
+    inline uint position(uint index) const { return index >= m_size ? index - m_size : index; }
+};
+
+/**
+ * Fixed point baseband broadcast FIFO feeding the threaded sinks
+ */
+class SDRBASE_API SampleSinkBroadcastFifo : public SampleSinkBroadcastFifoT<Sample> {
+public:
+    SampleSinkBroadcastFifo(int size = 1<<18, QObject* parent = 0) : SampleSinkBroadcastFifoT<Sample>(size, parent) {}
+};
+
+#endif // SDRBASE_DSP_SAMPLESINKBROADCASTFIFO_H_
@@ -19,50 +19,343 @@
 #ifndef INCLUDE_SAMPLEFIFO_H
 #define INCLUDE_SAMPLEFIFO_H
 
+#include <vector>
+#include <algorithm>
+
 #include <QObject>
+#include <QAtomicInteger>
 #include <QMutex>
+#include <QWaitCondition>
 #include <QTime>
+#include <QElapsedTimer>
 #include "dsp/dsptypes.h"
 #include "export.h"
 
-class SDRBASE_API SampleSinkFifo : public QObject {
+#define SAMPLESINKFIFO_CACHELINE_SIZE 64
+
+/**
+ * Signal of the sample FIFOs. Class templates cannot declare signals so the FIFO templates
+ * derive from this.
+ */
+class SDRBASE_API SampleSinkFifoSignals : public QObject {
 	Q_OBJECT
 
+public:
+	SampleSinkFifoSignals(QObject* parent = NULL) : QObject(parent) {}
+
+signals:
+	void dataReady();
+};
+
+/**
+ * Lets the writer of a lock free sample FIFO sleep until a reader makes room instead of polling.
+ * Readers call wake() after they have advanced their read index. They only take the mutex when
+ * the writer is actually waiting so the read path stays lock free the rest of the time.
+ */
+class SampleFifoRoomWaiter {
+public:
+	SampleFifoRoomWaiter() : m_waiting(0), m_interrupted(false) {}
+
+	/** Writer: wait until fifo.room() is at least count, timeoutMs elapses or interrupt() is called.
+	 * Returns fifo.room() which may still be lower than count */
+	template<typename Fifo>
+	uint wait(Fifo& fifo, uint count, unsigned long timeoutMs)
+	{
+		uint room = fifo.room();
+
+		if (room >= count) {
+			return room;
+		}
+
+		QElapsedTimer timer;
+		timer.start();
+		QMutexLocker mutexLocker(&m_mutex);
+		m_waiting.fetchAndStoreOrdered(1); // ordered with the read index update of wake()
+		room = fifo.room();
+
+		while ((room < count) && !m_interrupted)
+		{
+			qint64 remainingMs = (qint64) timeoutMs - timer.elapsed();
+
+			if (remainingMs <= 0) {
+				break;
+			}
+
+			m_waiter.wait(&m_mutex, remainingMs);
+			room = fifo.room();
+		}
+
+		m_interrupted = false;
+		m_waiting.storeRelease(0);
+		return room;
+	}
+
+	void wake() //!< reader: call after the read index has been advanced
+	{
+		if (m_waiting.fetchAndAddOrdered(0) != 0)
+		{
+			QMutexLocker mutexLocker(&m_mutex);
+			m_waiter.wakeAll();
+		}
+	}
+
+	void interrupt() //!< make the writer return from wait() now or from its next wait()
+	{
+		QMutexLocker mutexLocker(&m_mutex);
+		m_interrupted = true;
+		m_waiter.wakeAll();
+	}
+
 private:
 	QMutex m_mutex;
+	QWaitCondition m_waiter;
+	QAtomicInteger<quint32> m_waiting; //!< the writer is in wait()
+	bool m_interrupted;                //!< protected by m_mutex
+};
+
+/**
+ * Single producer single consumer lock free sample FIFO. There must be only one thread
+ * writing (write) and only one thread reading (read, readBegin, readCommit) at a time.
+ * Head and tail indexes run over twice the FIFO size so that a full FIFO can be told apart
+ * from an empty one. They are kept on separate cache lines so that the writer and the
+ * reader do not invalidate each other's cache line on every update.
+ * T is the sample type: Sample for the fixed point baseband or FSample for the float baseband.
+ */
+template<typename T>
+class SampleSinkFifoT : public SampleSinkFifoSignals {
+public:
+	typedef std::vector<T> Vector;
+
+	SampleSinkFifoT(QObject* parent = NULL) :
+		SampleSinkFifoSignals(parent),
+		m_suppressed(-1),
+		m_size(0),
+		m_head(0),
+		m_tail(0)
+	{}
+
+	SampleSinkFifoT(int size, QObject* parent = NULL) :
+		SampleSinkFifoSignals(parent),
+		m_suppressed(-1),
+		m_size(0),
+		m_head(0),
+		m_tail(0)
+	{
+		create(size);
+	}
+
+	~SampleSinkFifoT()
+	{
+		m_size = 0;
+	}
+
+	bool setSize(int size)
+	{
+		create(size);
+		return m_data.size() == (uint) size;
+	}
+
+	inline uint size() const { return m_size; }
+	inline uint fill() { return distance(m_head.loadAcquire(), m_tail.loadAcquire()); }
+	inline uint room() { return m_size - fill(); }
+
+	uint waitRoom(uint count, unsigned long timeoutMs) { return m_roomWaiter.wait(*this, count, timeoutMs); } //!< writer: wait for the reader to make room for count samples. Returns the room
+	void interruptWaitRoom() { m_roomWaiter.interrupt(); } //!< make a writer blocked in waitRoom return e.g. to stop it
+
+	uint write(const quint8* data, uint count) //!< count is in bytes
+	{
+		return writeSamples((const T*) data, count / sizeof(T));
+	}
+
+	uint write(typename Vector::const_iterator begin, typename Vector::const_iterator end)
+	{
+		if (begin == end) {
+			return 0;
+		}
+
+		return writeSamples(&(*begin), end - begin);
+	}
+
+	uint read(typename Vector::iterator begin, typename Vector::iterator end)
+	{
+		uint count = end - begin;
+		uint head = m_head.loadAcquire();
+		uint readPos = position(head);
+		uint total = std::min(count, distance(head, m_tail.loadAcquire()));
+		uint remaining = total;
+
+		if (total < count) {
+			qCritical("SampleSinkFifo: underflow - missing %u samples", count - total);
+		}
+
+		while (remaining > 0)
+		{
+			uint len = std::min(remaining, m_size - readPos);
+			std::copy(m_data.begin() + readPos, m_data.begin() + readPos + len, begin);
+			readPos += len;
+			readPos %= m_size;
+			begin += len;
+			remaining -= len;
+		}
+
+		m_head.storeRelease(advance(head, total)); // hand back the space to the writer
+		m_roomWaiter.wake();
+
+		return total;
+	}
+
+	uint readBegin(uint count,
+		typename Vector::iterator* part1Begin, typename Vector::iterator* part1End,
+		typename Vector::iterator* part2Begin, typename Vector::iterator* part2End)
+	{
+		uint head = m_head.loadAcquire();
+		uint readPos = position(head);
+		uint total = std::min(count, distance(head, m_tail.loadAcquire()));
+		uint remaining = total;
+
+		if (total < count) {
+			qCritical("SampleSinkFifo: underflow - missing %u samples", count - total);
+		}
+
+		if (remaining > 0)
+		{
+			uint len = std::min(remaining, m_size - readPos);
+			*part1Begin = m_data.begin() + readPos;
+			*part1End = m_data.begin() + readPos + len;
+			readPos += len;
+			readPos %= m_size;
+			remaining -= len;
+		}
+		else
+		{
+			*part1Begin = m_data.end();
+			*part1End = m_data.end();
+		}
+
+		if (remaining > 0)
+		{
+			uint len = std::min(remaining, m_size - readPos);
+			*part2Begin = m_data.begin() + readPos;
+			*part2End = m_data.begin() + readPos + len;
+		}
+		else
+		{
+			*part2Begin = m_data.end();
+			*part2End = m_data.end();
+		}
+
+		return total;
+	}
+
+	uint readCommit(uint count)
+	{
+		uint head = m_head.loadAcquire();
+		uint fill = distance(head, m_tail.loadAcquire());
+
+		if (count > fill)
+		{
+			qCritical("SampleSinkFifo: cannot commit more than available samples");
+			count = fill;
+		}
+
+		m_head.storeRelease(advance(head, count));
+		m_roomWaiter.wake();
+
+		return count;
+	}
+
+private:
 	QTime m_msgRateTimer;
 	int m_suppressed;
 
-	SampleVector m_data;
+	Vector m_data;
 
 	uint m_size;
-	uint m_fill;
-	uint m_head;
-	uint m_tail;
+	SampleFifoRoomWaiter m_roomWaiter;
 
-	void create(uint s);
+	char m_headPadding[SAMPLESINKFIFO_CACHELINE_SIZE];
+	QAtomicInteger<quint32> m_head; //!< read index in [0, 2*m_size[ only updated by the reader
+	char m_tailPadding[SAMPLESINKFIFO_CACHELINE_SIZE - sizeof(QAtomicInteger<quint32>)];
+	QAtomicInteger<quint32> m_tail; //!< write index in [0, 2*m_size[ only updated by the writer
+	char m_endPadding[SAMPLESINKFIFO_CACHELINE_SIZE - sizeof(QAtomicInteger<quint32>)];
 
-public:
-	SampleSinkFifo(QObject* parent = NULL);
-	SampleSinkFifo(int size, QObject* parent = NULL);
-	~SampleSinkFifo();
+	inline uint distance(uint head, uint tail) const { return tail >= head ? tail - head : tail + 2*m_size - head; }
+	inline uint advance(uint index, uint count) const { index += count; return index >= 2*m_size ? index - 2*m_size : index; }
+	inline uint position(uint index) const { return index >= m_size ? index - m_size : index; }
 
-	bool setSize(int size);
-	inline uint size() const { return m_size; }
-	inline uint fill() { QMutexLocker mutexLocker(&m_mutex); uint fill = m_fill; return fill; }
+	void create(uint s)
+	{
+		m_size = 0;
+		m_head.storeRelease(0);
+		m_tail.storeRelease(0);
 
-	uint write(const quint8* data, uint count);
-	uint write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+		m_data.resize(s);
+		m_size = m_data.size();
 
-	uint read(SampleVector::iterator begin, SampleVector::iterator end);
+		if (m_size != s) {
+			qCritical("SampleSinkFifo: out of memory");
+		}
+	}
 
-	uint readBegin(uint count,
-		SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
-		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
-	uint readCommit(uint count);
+	uint writeSamples(const T* begin, uint count)
+	{
+		uint tail = m_tail.loadAcquire();
+		uint fill = distance(m_head.loadAcquire(), tail);
+		uint writePos = position(tail);
+		uint total = std::min(count, m_size - fill);
 
-signals:
-	void dataReady();
+		if (total < count)
+		{
+			if (m_suppressed < 0)
+			{
+				m_suppressed = 0;
+				m_msgRateTimer.start();
+				qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
+			}
+			else
+			{
+				if (m_msgRateTimer.elapsed() > 2500)
+				{
+					qCritical("SampleSinkFifo: %u messages dropped", m_suppressed);
+					qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
+					m_suppressed = -1;
+				}
+				else
+				{
+					m_suppressed++;
+				}
+			}
+		}
+
+		uint remaining = total;
+
+		while (remaining > 0)
+		{
+			uint len = std::min(remaining, m_size - writePos);
+			std::copy(begin, begin + len, m_data.begin() + writePos);
+			writePos += len;
+			writePos %= m_size;
+			begin += len;
+			remaining -= len;
+		}
+
+		m_tail.storeRelease(advance(tail, total)); // publish the samples to the reader
+
+		if (fill + total > 0) {
+			emit dataReady();
+		}
+
+		return total;
+	}
+};
+
+/**
+ * Fixed point baseband sample FIFO
+ */
+class SDRBASE_API SampleSinkFifo : public SampleSinkFifoT<Sample> {
+public:
+	SampleSinkFifo(QObject* parent = NULL) : SampleSinkFifoT<Sample>(parent) {}
+	SampleSinkFifo(int size, QObject* parent = NULL) : SampleSinkFifoT<Sample>(size, parent) {}
 };
 
 #endif // INCLUDE_SAMPLEFIFO_H
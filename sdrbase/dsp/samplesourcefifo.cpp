@@ -92,3 +92,11 @@ void SampleSourceFifo::bumpIndex(SampleVector::iterator& writeAt)
 
     writeAt = m_data.begin() + m_iw;
 }
+
+void SampleSourceFifo::bumpIndex(SampleVector::iterator& writeAt, unsigned int nbSamples)
+{
+    assert(nbSamples <= m_size - m_iw);
+    std::copy(m_data.begin() + m_iw, m_data.begin() + m_iw + nbSamples, m_data.begin() + m_iw + m_size);
+    m_iw = (m_iw + nbSamples) % m_size;
+    writeAt = m_data.begin() + m_iw;
+}
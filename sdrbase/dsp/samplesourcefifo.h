@@ -41,6 +41,8 @@ public:
     void getReadIterator(SampleVector::iterator& readUntil); //!< get iterator past the last sample of a read advance operation (i.e. current read iterator)
     void getWriteIterator(SampleVector::iterator& writeAt);  //!< get iterator to current item for update - write phase 1
     void bumpIndex(SampleVector::iterator& writeAt);         //!< copy current item to second buffer and bump write index - write phase 2
+    unsigned int getWriteChunkSize() const { return m_size - m_iw; } //!< number of samples that can be written contiguously from the write iterator
+    void bumpIndex(SampleVector::iterator& writeAt, unsigned int nbSamples); //!< block version of bumpIndex. nbSamples must not exceed getWriteChunkSize()
 
     void write(const Sample& sample);                        //!< write directly - phase 1 + phase 2
 
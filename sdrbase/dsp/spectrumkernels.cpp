@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+#include "spectrumkernels.h"
+
+const float SpectrumKernels::m_log2C0 =  1.44188141f;
+const float SpectrumKernels::m_log2C1 = -0.708882209f;
+const float SpectrumKernels::m_log2C2 =  0.415303812f;
+const float SpectrumKernels::m_log2C3 = -0.19359419f;
+const float SpectrumKernels::m_log2C4 =  0.0453035931f;
+
+SpectrumKernels::MagSq SpectrumKernels::m_magSq = SpectrumKernels::magSqGeneric;
+SpectrumKernels::PowerToDB SpectrumKernels::m_powerToDB = SpectrumKernels::powerToDBGeneric;
+SpectrumKernels::Scale SpectrumKernels::m_scale = SpectrumKernels::scaleGeneric;
+SpectrumKernels::Accumulate SpectrumKernels::m_accumulate = SpectrumKernels::accumulateGeneric;
+SpectrumKernels::Maximum SpectrumKernels::m_maximum = SpectrumKernels::maximumGeneric;
+SpectrumKernels::MovingSum SpectrumKernels::m_movingSum = SpectrumKernels::movingSumGeneric;
+HBFilterKernels::ISA SpectrumKernels::m_isa = SpectrumKernels::initialize();
+
+HBFilterKernels::ISA SpectrumKernels::initialize()
+{
+    HBFilterKernels::ISA isa = HBFilterKernels::getDetectedISA();
+    setISA(isa);
+    return isa;
+}
+
+bool SpectrumKernels::setISA(HBFilterKernels::ISA isa)
+{
+    if (!HBFilterKernels::isSupported(isa)) {
+        return false;
+    }
+
+    switch (isa)
+    {
+#ifdef HBFILTERKERNELS_X86
+    case HBFilterKernels::ISASSE4_1:
+        m_magSq = magSqSSE4_1;
+        m_powerToDB = powerToDBSSE4_1;
+        m_scale = scaleSSE4_1;
+        m_accumulate = accumulateSSE4_1;
+        m_maximum = maximumSSE4_1;
+        m_movingSum = movingSumSSE4_1;
+        break;
+    case HBFilterKernels::ISAAVX2:
+        m_magSq = magSqAVX2;
+        m_powerToDB = powerToDBAVX2;
+        m_scale = scaleAVX2;
+        m_accumulate = accumulateAVX2;
+        m_maximum = maximumAVX2;
+        m_movingSum = movingSumAVX2;
+        break;
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    case HBFilterKernels::ISANEON:
+        m_magSq = magSqNEON;
+        m_powerToDB = powerToDBNEON;
+        m_scale = scaleNEON;
+        m_accumulate = accumulateNEON;
+        m_maximum = maximumNEON;
+        m_movingSum = movingSumNEON;
+        break;
+#endif
+    default:
+        m_magSq = magSqGeneric;
+        m_powerToDB = powerToDBGeneric;
+        m_scale = scaleGeneric;
+        m_accumulate = accumulateGeneric;
+        m_maximum = maximumGeneric;
+        m_movingSum = movingSumGeneric;
+        break;
+    }
+
+    m_isa = isa;
+    return true;
+}
+
+float SpectrumKernels::log2Approx(float x)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    float e = (float) ((int32_t) (bits >> 23) - 127);
+    bits = (bits & 0x007fffff) | 0x3f800000; // mantissa in [1,2[
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+    float t = m - 1.0f;
+    return e + t * (m_log2C0 + t * (m_log2C1 + t * (m_log2C2 + t * (m_log2C3 + t * m_log2C4))));
+}
+
+void SpectrumKernels::magSqGeneric(const float *iq, float *out, int n)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = iq[2*i] * iq[2*i] + iq[2*i+1] * iq[2*i+1];
+    }
+}
+
+void SpectrumKernels::powerToDBGeneric(const float *in, float *out, int n, float mult, float ofs)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = mult * log2Approx(in[i]) + ofs;
+    }
+}
+
+void SpectrumKernels::scaleGeneric(const float *in, float *out, int n, float k)
+{
+    scale<float>(in, out, n, k);
+}
+
+void SpectrumKernels::accumulateGeneric(float *acc, const float *in, int n)
+{
+    accumulate<float>(acc, in, n);
+}
+
+void SpectrumKernels::maximumGeneric(float *acc, const float *in, int n)
+{
+    maximum<float>(acc, in, n);
+}
+
+void SpectrumKernels::movingSumGeneric(float *sum, float *hist, const float *in, float *out, int n, float k)
+{
+    movingSum<float>(sum, hist, in, out, n, k);
+}
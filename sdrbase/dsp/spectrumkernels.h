@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMKERNELS_H_
+#define SDRBASE_DSP_SPECTRUMKERNELS_H_
+
+#include <algorithm>
+
+#include "dsp/hbfilterkernels.h"
+#include "export.h"
+
+/**
+ * Power spectrum kernels on arrays of FFT bins selected at run time according to the
+ * instruction set supported by the CPU (same detection as HBFilterKernels).
+ *
+ * The dB conversion uses a polynomial approximation of log2 on the mantissa
+ * (max error 5e-5 dB) so that it vectorizes. A zero power gives the floor of the
+ * float exponent range (about -382 dB before offset) instead of -infinity.
+ *
+ * Array reductions on other types than float fall back to plain loops.
+ */
+class SDRBASE_API SpectrumKernels
+{
+public:
+    typedef void (*MagSq)(const float *iq, float *out, int n);                                  //!< out[i] = I[i]^2 + Q[i]^2 with iq interleaved
+    typedef void (*PowerToDB)(const float *in, float *out, int n, float mult, float ofs);        //!< out[i] = mult * log2(in[i]) + ofs
+    typedef void (*Scale)(const float *in, float *out, int n, float k);                          //!< out[i] = k * in[i]
+    typedef void (*Accumulate)(float *acc, const float *in, int n);                              //!< acc[i] += in[i]
+    typedef void (*Maximum)(float *acc, const float *in, int n);                                 //!< acc[i] = max(acc[i], in[i])
+    typedef void (*MovingSum)(float *sum, float *hist, const float *in, float *out, int n, float k); //!< sum[i] += in[i] - hist[i], hist[i] = in[i], out[i] = k * sum[i]
+
+    static HBFilterKernels::ISA getISA() { return m_isa; }
+    static bool setISA(HBFilterKernels::ISA isa); //!< force the instruction set (mainly for benchmarking). Returns false if not supported
+
+    static void magSq(const float *iq, float *out, int n) { m_magSq(iq, out, n); }
+    static void powerToDB(const float *in, float *out, int n, float mult, float ofs) { m_powerToDB(in, out, n, mult, ofs); }
+    static void scale(const float *in, float *out, int n, float k) { m_scale(in, out, n, k); }
+    static void accumulate(float *acc, const float *in, int n) { m_accumulate(acc, in, n); }
+    static void maximum(float *acc, const float *in, int n) { m_maximum(acc, in, n); }
+    static void movingSum(float *sum, float *hist, const float *in, float *out, int n, float k) { m_movingSum(sum, hist, in, out, n, k); }
+
+    template<typename T> static void scale(const T *in, T *out, int n, T k)
+    {
+        for (int i = 0; i < n; i++) {
+            out[i] = k * in[i];
+        }
+    }
+
+    template<typename T> static void accumulate(T *acc, const T *in, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            acc[i] += in[i];
+        }
+    }
+
+    template<typename T> static void maximum(T *acc, const T *in, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            acc[i] = std::max(acc[i], in[i]);
+        }
+    }
+
+    template<typename T> static void movingSum(T *sum, T *hist, const T *in, T *out, int n, T k)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            sum[i] += in[i] - hist[i];
+            hist[i] = in[i];
+            out[i] = k * sum[i];
+        }
+    }
+
+    // per instruction set implementations
+    static void magSqGeneric(const float *iq, float *out, int n);
+    static void powerToDBGeneric(const float *in, float *out, int n, float mult, float ofs);
+    static void scaleGeneric(const float *in, float *out, int n, float k);
+    static void accumulateGeneric(float *acc, const float *in, int n);
+    static void maximumGeneric(float *acc, const float *in, int n);
+    static void movingSumGeneric(float *sum, float *hist, const float *in, float *out, int n, float k);
+#ifdef HBFILTERKERNELS_X86
+    static void magSqSSE4_1(const float *iq, float *out, int n);
+    static void powerToDBSSE4_1(const float *in, float *out, int n, float mult, float ofs);
+    static void scaleSSE4_1(const float *in, float *out, int n, float k);
+    static void accumulateSSE4_1(float *acc, const float *in, int n);
+    static void maximumSSE4_1(float *acc, const float *in, int n);
+    static void movingSumSSE4_1(float *sum, float *hist, const float *in, float *out, int n, float k);
+    static void magSqAVX2(const float *iq, float *out, int n);
+    static void powerToDBAVX2(const float *in, float *out, int n, float mult, float ofs);
+    static void scaleAVX2(const float *in, float *out, int n, float k);
+    static void accumulateAVX2(float *acc, const float *in, int n);
+    static void maximumAVX2(float *acc, const float *in, int n);
+    static void movingSumAVX2(float *sum, float *hist, const float *in, float *out, int n, float k);
+#endif
+#ifdef HBFILTERKERNELS_NEON
+    static void magSqNEON(const float *iq, float *out, int n);
+    static void powerToDBNEON(const float *in, float *out, int n, float mult, float ofs);
+    static void scaleNEON(const float *in, float *out, int n, float k);
+    static void accumulateNEON(float *acc, const float *in, int n);
+    static void maximumNEON(float *acc, const float *in, int n);
+    static void movingSumNEON(float *sum, float *hist, const float *in, float *out, int n, float k);
+#endif
+
+    static float log2Approx(float x); //!< scalar version of the polynomial approximation used by powerToDB
+
+    // log2(1+t) ~ t*(c0 + t*(c1 + t*(c2 + t*(c3 + t*c4)))) for t in [0,1[
+    static const float m_log2C0;
+    static const float m_log2C1;
+    static const float m_log2C2;
+    static const float m_log2C3;
+    static const float m_log2C4;
+
+private:
+    static HBFilterKernels::ISA m_isa;
+    static MagSq m_magSq;
+    static PowerToDB m_powerToDB;
+    static Scale m_scale;
+    static Accumulate m_accumulate;
+    static Maximum m_maximum;
+    static MovingSum m_movingSum;
+
+    static HBFilterKernels::ISA initialize();
+};
+
+#endif /* SDRBASE_DSP_SPECTRUMKERNELS_H_ */
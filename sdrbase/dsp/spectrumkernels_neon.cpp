@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// NEON power spectrum kernels
+
+#include "spectrumkernels.h"
+
+#ifdef HBFILTERKERNELS_NEON
+
+#include <arm_neon.h>
+
+static inline float32x4_t spectrumLog2NEON(float32x4_t x)
+{
+    uint32x4_t bits = vreinterpretq_u32_f32(x);
+    float32x4_t e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000)));
+    float32x4_t t = vsubq_f32(m, vdupq_n_f32(1.0f));
+    float32x4_t p = vdupq_n_f32(SpectrumKernels::m_log2C4);
+    p = vmlaq_f32(vdupq_n_f32(SpectrumKernels::m_log2C3), p, t);
+    p = vmlaq_f32(vdupq_n_f32(SpectrumKernels::m_log2C2), p, t);
+    p = vmlaq_f32(vdupq_n_f32(SpectrumKernels::m_log2C1), p, t);
+    p = vmlaq_f32(vdupq_n_f32(SpectrumKernels::m_log2C0), p, t);
+    return vmlaq_f32(e, p, t);
+}
+
+void SpectrumKernels::magSqNEON(const float *iq, float *out, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4x2_t c = vld2q_f32(iq + 2*i); // deinterleave I and Q
+        vst1q_f32(out + i, vmlaq_f32(vmulq_f32(c.val[0], c.val[0]), c.val[1], c.val[1]));
+    }
+
+    magSqGeneric(iq + 2*i, out + i, n - i);
+}
+
+void SpectrumKernels::powerToDBNEON(const float *in, float *out, int n, float mult, float ofs)
+{
+    float32x4_t vmult = vdupq_n_f32(mult);
+    float32x4_t vofs = vdupq_n_f32(ofs);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(out + i, vmlaq_f32(vofs, vmult, spectrumLog2NEON(vld1q_f32(in + i))));
+    }
+
+    powerToDBGeneric(in + i, out + i, n - i, mult, ofs);
+}
+
+void SpectrumKernels::scaleNEON(const float *in, float *out, int n, float k)
+{
+    float32x4_t vk = vdupq_n_f32(k);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(out + i, vmulq_f32(vk, vld1q_f32(in + i)));
+    }
+
+    scaleGeneric(in + i, out + i, n - i, k);
+}
+
+void SpectrumKernels::accumulateNEON(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(acc + i, vaddq_f32(vld1q_f32(acc + i), vld1q_f32(in + i)));
+    }
+
+    accumulateGeneric(acc + i, in + i, n - i);
+}
+
+void SpectrumKernels::maximumNEON(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(acc + i, vmaxq_f32(vld1q_f32(acc + i), vld1q_f32(in + i)));
+    }
+
+    maximumGeneric(acc + i, in + i, n - i);
+}
+
+void SpectrumKernels::movingSumNEON(float *sum, float *hist, const float *in, float *out, int n, float k)
+{
+    float32x4_t vk = vdupq_n_f32(k);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t v = vld1q_f32(in + i);
+        float32x4_t s = vaddq_f32(vld1q_f32(sum + i), vsubq_f32(v, vld1q_f32(hist + i)));
+        vst1q_f32(sum + i, s);
+        vst1q_f32(hist + i, v);
+        vst1q_f32(out + i, vmulq_f32(vk, s));
+    }
+
+    movingSumGeneric(sum + i, hist + i, in + i, out + i, n - i, k);
+}
+
+#endif // HBFILTERKERNELS_NEON
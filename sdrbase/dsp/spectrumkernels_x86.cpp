@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// SSE4.1 and AVX2 power spectrum kernels compiled with per function target attributes
+// (see hbfilterkernels_x86.cpp)
+
+#include "spectrumkernels.h"
+
+#ifdef HBFILTERKERNELS_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SPECTRUMKERNELS_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SPECTRUMKERNELS_TARGET(isa)
+#endif
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+static inline __m128 spectrumLog2SSE4_1(__m128 x)
+{
+    __m128i bits = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+    __m128 t = _mm_sub_ps(m, _mm_set1_ps(1.0f));
+    __m128 p = _mm_set1_ps(SpectrumKernels::m_log2C4);
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(SpectrumKernels::m_log2C3));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(SpectrumKernels::m_log2C2));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(SpectrumKernels::m_log2C1));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(SpectrumKernels::m_log2C0));
+    return _mm_add_ps(e, _mm_mul_ps(p, t));
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::magSqSSE4_1(const float *iq, float *out, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(iq + 2*i);
+        __m128 b = _mm_loadu_ps(iq + 2*i + 4);
+        _mm_storeu_ps(out + i, _mm_hadd_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)));
+    }
+
+    magSqGeneric(iq + 2*i, out + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::powerToDBSSE4_1(const float *in, float *out, int n, float mult, float ofs)
+{
+    __m128 vmult = _mm_set1_ps(mult);
+    __m128 vofs = _mm_set1_ps(ofs);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(vmult, spectrumLog2SSE4_1(_mm_loadu_ps(in + i))), vofs));
+    }
+
+    powerToDBGeneric(in + i, out + i, n - i, mult, ofs);
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::scaleSSE4_1(const float *in, float *out, int n, float k)
+{
+    __m128 vk = _mm_set1_ps(k);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(vk, _mm_loadu_ps(in + i)));
+    }
+
+    scaleGeneric(in + i, out + i, n - i, k);
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::accumulateSSE4_1(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_loadu_ps(in + i)));
+    }
+
+    accumulateGeneric(acc + i, in + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::maximumSSE4_1(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(acc + i, _mm_max_ps(_mm_loadu_ps(acc + i), _mm_loadu_ps(in + i)));
+    }
+
+    maximumGeneric(acc + i, in + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("sse4.1")
+void SpectrumKernels::movingSumSSE4_1(float *sum, float *hist, const float *in, float *out, int n, float k)
+{
+    __m128 vk = _mm_set1_ps(k);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 v = _mm_loadu_ps(in + i);
+        __m128 s = _mm_add_ps(_mm_loadu_ps(sum + i), _mm_sub_ps(v, _mm_loadu_ps(hist + i)));
+        _mm_storeu_ps(sum + i, s);
+        _mm_storeu_ps(hist + i, v);
+        _mm_storeu_ps(out + i, _mm_mul_ps(vk, s));
+    }
+
+    movingSumGeneric(sum + i, hist + i, in + i, out + i, n - i, k);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+static inline __m256 spectrumLog2AVX2(__m256 x)
+{
+    __m256i bits = _mm256_castps_si256(x);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000)));
+    __m256 t = _mm256_sub_ps(m, _mm256_set1_ps(1.0f));
+    __m256 p = _mm256_set1_ps(SpectrumKernels::m_log2C4);
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(SpectrumKernels::m_log2C3));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(SpectrumKernels::m_log2C2));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(SpectrumKernels::m_log2C1));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(SpectrumKernels::m_log2C0));
+    return _mm256_fmadd_ps(p, t, e);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::magSqAVX2(const float *iq, float *out, int n)
+{
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 a = _mm256_loadu_ps(iq + 2*i);
+        __m256 b = _mm256_loadu_ps(iq + 2*i + 8);
+        // horizontal add works within 128 bit lanes: restore the bins order after it
+        __m256 h = _mm256_hadd_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b));
+        h = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(h), _MM_SHUFFLE(3,1,2,0)));
+        _mm256_storeu_ps(out + i, h);
+    }
+
+    magSqGeneric(iq + 2*i, out + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::powerToDBAVX2(const float *in, float *out, int n, float mult, float ofs)
+{
+    __m256 vmult = _mm256_set1_ps(mult);
+    __m256 vofs = _mm256_set1_ps(ofs);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(vmult, spectrumLog2AVX2(_mm256_loadu_ps(in + i)), vofs));
+    }
+
+    powerToDBGeneric(in + i, out + i, n - i, mult, ofs);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::scaleAVX2(const float *in, float *out, int n, float k)
+{
+    __m256 vk = _mm256_set1_ps(k);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(vk, _mm256_loadu_ps(in + i)));
+    }
+
+    scaleGeneric(in + i, out + i, n - i, k);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::accumulateAVX2(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i), _mm256_loadu_ps(in + i)));
+    }
+
+    accumulateGeneric(acc + i, in + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::maximumAVX2(float *acc, const float *in, int n)
+{
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(acc + i, _mm256_max_ps(_mm256_loadu_ps(acc + i), _mm256_loadu_ps(in + i)));
+    }
+
+    maximumGeneric(acc + i, in + i, n - i);
+}
+
+SPECTRUMKERNELS_TARGET("avx2,fma")
+void SpectrumKernels::movingSumAVX2(float *sum, float *hist, const float *in, float *out, int n, float k)
+{
+    __m256 vk = _mm256_set1_ps(k);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(in + i);
+        __m256 s = _mm256_add_ps(_mm256_loadu_ps(sum + i), _mm256_sub_ps(v, _mm256_loadu_ps(hist + i)));
+        _mm256_storeu_ps(sum + i, s);
+        _mm256_storeu_ps(hist + i, v);
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(vk, s));
+    }
+
+    movingSumGeneric(sum + i, hist + i, in + i, out + i, n - i, k);
+}
+
+#endif // HBFILTERKERNELS_X86
@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include <QMutexLocker>
+#include <QtEndian>
+
+#include "dsp/spectrumvis.h"
+#include "dsp/dspcommands.h"
+#include "spectrumstreamer.h"
+
+const int SpectrumStreamer::m_headerSize;
+const float SpectrumStreamer::m_dbMin = -160.0f;
+const float SpectrumStreamer::m_dbStep = 0.625f;
+
+SpectrumStreamer::SpectrumStreamer(Real scalef) :
+    m_scalef(scalef),
+    m_mutex(QMutex::NonRecursive),
+    m_nbSubscribers(0),
+    m_nbIQSubscribers(0),
+    m_closing(false),
+    m_iqRing(4096),
+    m_iqRingIndex(0),
+    m_sequence(0),
+    m_centerFrequency(0),
+    m_sampleRate(0)
+{
+    setObjectName("SpectrumStreamer");
+    m_spectrumVis = new SpectrumVis(scalef, this);
+}
+
+SpectrumStreamer::~SpectrumStreamer()
+{
+    m_mutex.lock();
+    m_closing = true;
+    m_frameAvailable.wakeAll();
+
+    while (m_nbSubscribers.loadAcquire() > 0) {
+        m_subscribersChanged.wait(&m_mutex);
+    }
+
+    m_mutex.unlock();
+    delete m_spectrumVis;
+}
+
+void SpectrumStreamer::start()
+{
+    m_spectrumVis->start();
+}
+
+void SpectrumStreamer::stop()
+{
+    m_spectrumVis->stop();
+}
+
+void SpectrumStreamer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    if (m_nbSubscribers.loadAcquire() == 0) { // nobody is listening
+        return;
+    }
+
+    if (m_nbIQSubscribers.loadAcquire() > 0)
+    {
+        unsigned int nbSamples = end - begin;
+        unsigned int ringSize = m_iqRing.size();
+        SampleVector::const_iterator it = nbSamples > ringSize ? end - ringSize : begin;
+
+        for (; it != end; ++it)
+        {
+            m_iqRing[m_iqRingIndex] = *it;
+            m_iqRingIndex = m_iqRingIndex + 1 == ringSize ? 0 : m_iqRingIndex + 1;
+        }
+    }
+
+    m_spectrumVis->feed(begin, end, positiveOnly);
+}
+
+bool SpectrumStreamer::handleMessage(const Message& cmd)
+{
+    if (DSPSignalNotification::match(cmd))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+        QMutexLocker mutexLocker(&m_mutex);
+        m_centerFrequency = notif.getCenterFrequency();
+        m_sampleRate = notif.getSampleRate();
+        return true;
+    }
+    else
+    {
+        return m_spectrumVis->handleMessage(cmd);
+    }
+}
+
+void SpectrumStreamer::newSpectrum(const std::vector<Real>& spectrum, int fftSize)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_power.assign(spectrum.begin(), spectrum.begin() + fftSize);
+
+    if (m_nbIQSubscribers.loadAcquire() > 0)
+    {
+        unsigned int ringSize = m_iqRing.size();
+        unsigned int nbSamples = std::min((unsigned int) fftSize, ringSize);
+        unsigned int index = (m_iqRingIndex + ringSize - nbSamples) % ringSize;
+        m_iq.resize(nbSamples);
+
+        for (unsigned int i = 0; i < nbSamples; i++)
+        {
+            m_iq[i] = m_iqRing[index];
+            index = index + 1 == ringSize ? 0 : index + 1;
+        }
+    }
+    else
+    {
+        m_iq.clear();
+    }
+
+    m_sequence++;
+    m_powerFrames.clear();
+    m_iqFrames.clear();
+    m_frameAvailable.wakeAll();
+}
+
+bool SpectrumStreamer::subscribe(bool iq)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_closing) {
+        return false;
+    }
+
+    m_nbSubscribers.ref();
+
+    if (iq) {
+        m_nbIQSubscribers.ref();
+    }
+
+    return true;
+}
+
+void SpectrumStreamer::unsubscribe(bool iq)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_nbSubscribers.deref();
+
+    if (iq) {
+        m_nbIQSubscribers.deref();
+    }
+
+    m_subscribersChanged.wakeAll();
+}
+
+bool SpectrumStreamer::waitForFrame(quint32 sequence, unsigned long timeoutMs)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_closing && (m_sequence == sequence)) {
+        m_frameAvailable.wait(&m_mutex, timeoutMs);
+    }
+
+    return !m_closing && (m_sequence != sequence);
+}
+
+bool SpectrumStreamer::isClosing()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_closing;
+}
+
+quint32 SpectrumStreamer::getFrames(unsigned int binDecimation, unsigned int iqDecimation, QByteArray& powerFrame, QByteArray& iqFrame)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QMap<unsigned int, QByteArray>::const_iterator it = m_powerFrames.find(binDecimation);
+
+    if (it == m_powerFrames.end()) {
+        it = m_powerFrames.insert(binDecimation, encodePower(binDecimation));
+    }
+
+    powerFrame = *it;
+
+    if ((iqDecimation == 0) || m_iq.empty())
+    {
+        iqFrame.clear();
+    }
+    else
+    {
+        it = m_iqFrames.find(iqDecimation);
+
+        if (it == m_iqFrames.end()) {
+            it = m_iqFrames.insert(iqDecimation, encodeIQ(iqDecimation));
+        }
+
+        iqFrame = *it;
+    }
+
+    return m_sequence;
+}
+
+QByteArray SpectrumStreamer::getHeartbeatFrame()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QByteArray frame(m_headerSize, 0);
+    writeHeader(frame.data(), FrameHeartbeat, m_headerSize, m_sampleRate, 0, 0.0f, 0.0f);
+    return frame;
+}
+
+QByteArray SpectrumStreamer::encodePower(unsigned int binDecimation)
+{
+    unsigned int nbBins = m_power.size();
+    unsigned int decimation = binDecimation < 1 ? 1 : binDecimation > nbBins ? nbBins : binDecimation;
+    unsigned int nbItems = nbBins == 0 ? 0 : (nbBins + decimation - 1) / decimation;
+    QByteArray frame(m_headerSize + nbItems, 0);
+    writeHeader(frame.data(), FramePower, frame.size(), m_sampleRate, nbItems, m_dbMin, m_dbStep);
+    uchar *levels = (uchar *) frame.data() + m_headerSize;
+
+    for (unsigned int i = 0; i < nbItems; i++)
+    {
+        // keep the peak of the merged bins so that narrow signals stay visible
+        unsigned int groupEnd = std::min((i + 1) * decimation, nbBins);
+        Real db = *std::max_element(m_power.begin() + i * decimation, m_power.begin() + groupEnd);
+        Real level = (db - m_dbMin) / m_dbStep + 0.5f;
+        levels[i] = level < 0.0f ? 0 : level > 255.0f ? 255 : (uchar) level;
+    }
+
+    return frame;
+}
+
+QByteArray SpectrumStreamer::encodeIQ(unsigned int decimation)
+{
+    unsigned int nbItems = m_iq.size() / decimation;
+    QByteArray frame(m_headerSize + 4*nbItems, 0);
+    writeHeader(frame.data(), FrameIQ, frame.size(), m_sampleRate / decimation, nbItems, 0.0f, 0.0f);
+    uchar *iq = (uchar *) frame.data() + m_headerSize;
+    float scale = 32767.0f / (m_scalef * decimation);
+
+    for (unsigned int i = 0; i < nbItems; i++)
+    {
+        // boxcar average over the decimation factor
+        float re = 0.0f, im = 0.0f;
+
+        for (unsigned int j = i * decimation; j < (i + 1) * decimation; j++)
+        {
+            re += m_iq[j].real();
+            im += m_iq[j].imag();
+        }
+
+        re = std::max(-32767.0f, std::min(32767.0f, re * scale));
+        im = std::max(-32767.0f, std::min(32767.0f, im * scale));
+        qToLittleEndian<qint16>((qint16) re, iq + 4*i);
+        qToLittleEndian<qint16>((qint16) im, iq + 4*i + 2);
+    }
+
+    return frame;
+}
+
+void SpectrumStreamer::writeHeader(char *header, FrameType frameType, int frameSize, int sampleRate, int nbItems, float level0, float levelStep)
+{
+    uchar *p = (uchar *) header;
+    quint32 level0Bits, levelStepBits;
+    memcpy(&level0Bits, &level0, 4);
+    memcpy(&levelStepBits, &levelStep, 4);
+
+    memcpy(p, "SDRS", 4);
+    qToLittleEndian<quint32>(frameSize, p + 4);
+    qToLittleEndian<quint16>(frameType, p + 8);
+    qToLittleEndian<quint16>(m_headerSize, p + 10);
+    qToLittleEndian<quint32>(m_sequence, p + 12);
+    qToLittleEndian<qint64>(m_centerFrequency, p + 16);
+    qToLittleEndian<qint32>(sampleRate, p + 24);
+    qToLittleEndian<quint32>(nbItems, p + 28);
+    qToLittleEndian<quint32>(level0Bits, p + 32);
+    qToLittleEndian<quint32>(levelStepBits, p + 36);
+}
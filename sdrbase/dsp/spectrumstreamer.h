@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMSTREAMER_H_
+#define SDRBASE_DSP_SPECTRUMSTREAMER_H_
+
+#include <vector>
+
+#include <QByteArray>
+#include <QMap>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInt>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/glspectruminterface.h"
+#include "export.h"
+
+class SpectrumVis;
+
+/**
+ * Spectrum of a device set for remote clients. It is installed as the spectrum sink of the device
+ * engine and runs its own SpectrumVis only while there are subscribers. The latest power frame
+ * is kept with a snapshot of the I/Q samples it was computed from. Subscribers wait for new frames
+ * in their own threads and get them in binary form. A frame is encoded at most once per
+ * decimation factor whatever the number of subscribers.
+ *
+ * Frame layout (little endian):
+ *   0  char[4] "SDRS"
+ *   4  uint32  frame size in bytes including header
+ *   8  uint16  frame type (FrameType)
+ *  10  uint16  header size in bytes
+ *  12  uint32  sequence number
+ *  16  int64   center frequency (Hz)
+ *  24  int32   sample rate (S/s) after I/Q decimation
+ *  28  uint32  number of items (power bins or I/Q samples)
+ *  32  float   power of level 0 (dB) or 0 for I/Q
+ *  36  float   power step per level (dB) or 0 for I/Q
+ *  40  payload power: one uint8 level per bin from lowest to highest frequency
+ *              I/Q: int16 I and int16 Q per sample relative to full scale
+ */
+class SDRBASE_API SpectrumStreamer : public BasebandSampleSink, public GLSpectrumInterface
+{
+public:
+    enum FrameType
+    {
+        FramePower,
+        FrameIQ,
+        FrameHeartbeat
+    };
+
+    SpectrumStreamer(Real scalef);
+    virtual ~SpectrumStreamer(); //!< waits for the subscribers to leave
+
+    virtual void start();
+    virtual void stop();
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual bool handleMessage(const Message& cmd);
+    virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize);
+
+    SpectrumVis *getSpectrumVis() { return m_spectrumVis; }
+
+    bool subscribe(bool iq); //!< returns false if the streamer is being destroyed
+    void unsubscribe(bool iq);
+    bool waitForFrame(quint32 sequence, unsigned long timeoutMs); //!< wait for a frame newer than sequence. False on timeout or when closing
+    bool isClosing();
+    quint32 getFrames(unsigned int binDecimation, unsigned int iqDecimation, QByteArray& powerFrame, QByteArray& iqFrame); //!< latest frames (no I/Q if decimation is 0). Returns their sequence number
+    QByteArray getHeartbeatFrame();
+
+    static const int m_headerSize = 40;
+    static const float m_dbMin;  //!< power of level 0
+    static const float m_dbStep; //!< power step per level
+
+private:
+    SpectrumVis *m_spectrumVis;
+    Real m_scalef;
+    QMutex m_mutex;
+    QWaitCondition m_frameAvailable;
+    QWaitCondition m_subscribersChanged;
+    QAtomicInt m_nbSubscribers;
+    QAtomicInt m_nbIQSubscribers;
+    bool m_closing;
+
+    std::vector<Sample> m_iqRing;  //!< last samples fed (written in the DSP thread only)
+    unsigned int m_iqRingIndex;
+    std::vector<Real> m_power;     //!< latest power frame in dB
+    std::vector<Sample> m_iq;      //!< I/Q snapshot of the latest frame
+    quint32 m_sequence;
+    qint64 m_centerFrequency;
+    int m_sampleRate;
+    QMap<unsigned int, QByteArray> m_powerFrames; //!< encoded latest power frame by bin decimation
+    QMap<unsigned int, QByteArray> m_iqFrames;    //!< encoded latest I/Q frame by decimation
+
+    QByteArray encodePower(unsigned int binDecimation);
+    QByteArray encodeIQ(unsigned int decimation);
+    void writeHeader(char *header, FrameType frameType, int frameSize, int sampleRate, int nbItems, float level0, float levelStep);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMSTREAMER_H_
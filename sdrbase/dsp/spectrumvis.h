@@ -5,16 +5,16 @@
 #include <QMutex>
 #include "dsp/fftengine.h"
 #include "dsp/fftwindow.h"
+#include "dsp/glspectruminterface.h"
 #include "export.h"
 #include "util/message.h"
 #include "util/movingaverage2d.h"
 #include "util/fixedaverage2d.h"
 #include "util/max2d.h"
 
-class GLSpectrum;
 class MessageQueue;
 
-class SDRGUI_API SpectrumVis : public BasebandSampleSink {
+class SDRBASE_API SpectrumVis : public BasebandSampleSink {
 
 public:
     enum AvgMode
@@ -62,7 +62,7 @@ public:
 		bool m_linear;
 	};
 
-	SpectrumVis(Real scalef, GLSpectrum* glSpectrum = 0);
+	SpectrumVis(Real scalef, GLSpectrumInterface* glSpectrum = 0);
 	virtual ~SpectrumVis();
 
 	void configure(MessageQueue* msgQueue,
@@ -85,6 +85,7 @@ private:
 
 	std::vector<Complex> m_fftBuffer;
 	std::vector<Real> m_powerSpectrum;
+	std::vector<Real> m_powerBuffer; //!< power of FFT bins in display order before averaging and scaling
 
 	std::size_t m_fftSize;
 	std::size_t m_overlapPercent;
@@ -94,10 +95,10 @@ private:
 	bool m_needMoreSamples;
 
 	Real m_scalef;
-	GLSpectrum* m_glSpectrum;
-	MovingAverage2D<double> m_movingAverage;
-	FixedAverage2D<double> m_fixedAverage;
-	Max2D<double> m_max;
+	GLSpectrumInterface* m_glSpectrum;
+	MovingAverage2D<Real> m_movingAverage;
+	FixedAverage2D<Real> m_fixedAverage;
+	Max2D<Real> m_max;
 	unsigned int m_averageNb;
 	AvgMode m_avgMode;
 	bool m_linear;
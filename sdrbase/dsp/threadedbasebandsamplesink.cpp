@@ -5,35 +5,82 @@
 #include "dsp/dspcommands.h"
 #include "util/message.h"
 
-ThreadedBasebandSampleSinkFifo::ThreadedBasebandSampleSinkFifo(BasebandSampleSink *sampleSink, std::size_t size) :
-	m_sampleSink(sampleSink)
+ThreadedBasebandSampleSinkFifo::ThreadedBasebandSampleSinkFifo(BasebandSampleSink *sampleSink) :
+	m_sampleSink(sampleSink),
+	m_broadcastFifo(0),
+	m_reader(0),
+	m_broadcastFifoF(0),
+	m_readerF(0)
 {
-	connect(&m_sampleFifo, SIGNAL(dataReady()), this, SLOT(handleFifoData()));
-	m_sampleFifo.setSize(size);
 }
 
 ThreadedBasebandSampleSinkFifo::~ThreadedBasebandSampleSinkFifo()
 {
-	m_sampleFifo.readCommit(m_sampleFifo.fill());
+	setBroadcastFifo(0);
+	setBroadcastFifoF(0);
 }
 
-void ThreadedBasebandSampleSinkFifo::writeToFifo(SampleVector::const_iterator& begin, SampleVector::const_iterator& end)
+void ThreadedBasebandSampleSinkFifo::setBroadcastFifo(SampleSinkBroadcastFifo *broadcastFifo)
 {
-	m_sampleFifo.write(begin, end);
+	if (m_broadcastFifo == broadcastFifo) {
+		return;
+	}
+
+	if (m_broadcastFifo)
+	{
+		disconnect(m_broadcastFifo, SIGNAL(dataReady()), this, SLOT(handleFifoData()));
+		m_broadcastFifo->removeReader(m_reader);
+		m_reader = 0;
+	}
+
+	if (broadcastFifo)
+	{
+		m_reader = broadcastFifo->addReader();
+		connect(broadcastFifo, SIGNAL(dataReady()), this, SLOT(handleFifoData()));
+	}
+
+	m_broadcastFifo = broadcastFifo;
+}
+
+void ThreadedBasebandSampleSinkFifo::setBroadcastFifoF(FSampleSinkBroadcastFifo *broadcastFifo)
+{
+	if (m_broadcastFifoF == broadcastFifo) {
+		return;
+	}
+
+	if (m_broadcastFifoF)
+	{
+		disconnect(m_broadcastFifoF, SIGNAL(dataReady()), this, SLOT(handleFifoDataF()));
+		m_broadcastFifoF->removeReader(m_readerF);
+		m_readerF = 0;
+	}
+
+	if (broadcastFifo)
+	{
+		m_readerF = broadcastFifo->addReader();
+		connect(broadcastFifo, SIGNAL(dataReady()), this, SLOT(handleFifoDataF()));
+	}
+
+	m_broadcastFifoF = broadcastFifo;
 }
 
 void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it to the new threadable sink class
 {
 	bool positiveOnly = false;
 
-	while ((m_sampleFifo.fill() > 0) && (m_sampleSink->getInputMessageQueue()->size() == 0))
+	if (!m_reader) { // detached while the signal was queued
+		return;
+	}
+
+	while ((m_broadcastFifo->fill(m_reader) > 0) && (m_sampleSink->getInputMessageQueue()->size() == 0))
 	{
 		SampleVector::iterator part1begin;
 		SampleVector::iterator part1end;
 		SampleVector::iterator part2begin;
 		SampleVector::iterator part2end;
 
-		std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+		std::size_t count = m_broadcastFifo->readBegin(m_reader, m_broadcastFifo->fill(m_reader), &part1begin, &part1end, &part2begin, &part2end);
+		qint64 start = DSPProfileStage::now();
 
 		// first part of FIFO data
 
@@ -45,7 +92,7 @@ void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it t
 				m_sampleSink->feed(part1begin, part1end, positiveOnly);
 			}
 
-			m_sampleFifo.readCommit(part1end - part1begin);
+			m_broadcastFifo->readCommit(m_reader, part1end - part1begin);
 		}
 
 		// second part of FIFO data (used when block wraps around)
@@ -58,7 +105,57 @@ void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it t
 				m_sampleSink->feed(part2begin, part2end, positiveOnly);
 			}
 
-			m_sampleFifo.readCommit(part2end - part2begin);
+			m_broadcastFifo->readCommit(m_reader, part2end - part2begin);
+		}
+
+		if (m_sampleSink != NULL)
+		{
+			m_sampleSink->getProfileStage().record(DSPProfileStage::now() - start, count);
+			m_sampleSink->getProfileStage().recordFill(count);
+		}
+	}
+}
+
+void ThreadedBasebandSampleSinkFifo::handleFifoDataF()
+{
+	bool positiveOnly = false;
+
+	if (!m_readerF) { // detached while the signal was queued
+		return;
+	}
+
+	while ((m_broadcastFifoF->fill(m_readerF) > 0) && (m_sampleSink->getInputMessageQueue()->size() == 0))
+	{
+		FSampleVector::iterator part1begin;
+		FSampleVector::iterator part1end;
+		FSampleVector::iterator part2begin;
+		FSampleVector::iterator part2end;
+
+		std::size_t count = m_broadcastFifoF->readBegin(m_readerF, m_broadcastFifoF->fill(m_readerF), &part1begin, &part1end, &part2begin, &part2end);
+		qint64 start = DSPProfileStage::now();
+
+		if (count > 0)
+		{
+			if(m_sampleSink != NULL) {
+				m_sampleSink->feedF(part1begin, part1end, positiveOnly);
+			}
+
+			m_broadcastFifoF->readCommit(m_readerF, part1end - part1begin);
+		}
+
+		if(part2begin != part2end)
+		{
+			if(m_sampleSink != NULL) {
+				m_sampleSink->feedF(part2begin, part2end, positiveOnly);
+			}
+
+			m_broadcastFifoF->readCommit(m_readerF, part2end - part2begin);
+		}
+
+		if (m_sampleSink != NULL)
+		{
+			m_sampleSink->getProfileStage().record(DSPProfileStage::now() - start, count);
+			m_sampleSink->getProfileStage().recordFill(count);
 		}
 	}
 }
@@ -111,12 +208,14 @@ void ThreadedBasebandSampleSink::stop()
 	m_thread->wait();
 }
 
-void ThreadedBasebandSampleSink::feed(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly)
+void ThreadedBasebandSampleSink::setBroadcastFifo(SampleSinkBroadcastFifo *broadcastFifo)
 {
-    (void) positiveOnly;
-	//m_sampleSink->feed(begin, end, positiveOnly);
-	//m_sampleFifo.write(begin, end);
-	m_threadedBasebandSampleSinkFifo->writeToFifo(begin, end);
+	m_threadedBasebandSampleSinkFifo->setBroadcastFifo(broadcastFifo);
+}
+
+void ThreadedBasebandSampleSink::setBroadcastFifoF(FSampleSinkBroadcastFifo *broadcastFifo)
+{
+	m_threadedBasebandSampleSinkFifo->setBroadcastFifoF(broadcastFifo);
 }
 
 bool ThreadedBasebandSampleSink::handleSinkMessage(const Message& cmd)
@@ -128,3 +227,8 @@ QString ThreadedBasebandSampleSink::getSampleSinkObjectName() const
 {
 	return m_basebandSampleSink->objectName();
 }
+
+void ThreadedBasebandSampleSink::getProfileStages(DSPProfile& profile)
+{
+	m_basebandSampleSink->getProfileStages(profile, DSPProfile::StageSink);
+}
@@ -22,7 +22,8 @@
 #include <dsp/basebandsamplesink.h>
 #include <QMutex>
 
-#include "samplesinkfifo.h"
+#include "samplesinkbroadcastfifo.h"
+#include "fsamplesinkbroadcastfifo.h"
 #include "util/messagequeue.h"
 #include "export.h"
 
@@ -37,15 +38,20 @@ class SDRBASE_API ThreadedBasebandSampleSinkFifo : public QObject {
 	Q_OBJECT
 
 public:
-	ThreadedBasebandSampleSinkFifo(BasebandSampleSink* sampleSink, std::size_t size = 1<<18);
+	ThreadedBasebandSampleSinkFifo(BasebandSampleSink* sampleSink);
 	~ThreadedBasebandSampleSinkFifo();
-	void writeToFifo(SampleVector::const_iterator& begin, SampleVector::const_iterator& end);
+	void setBroadcastFifo(SampleSinkBroadcastFifo *broadcastFifo); //!< attach to the FIFO shared by all threaded sinks (0 to detach)
+	void setBroadcastFifoF(FSampleSinkBroadcastFifo *broadcastFifo); //!< same for the float baseband FIFO
 
 	BasebandSampleSink* m_sampleSink;
-	SampleSinkFifo m_sampleFifo;
+	SampleSinkBroadcastFifo *m_broadcastFifo;
+	SampleSinkBroadcastFifo::Reader *m_reader; //!< this sink read cursor in the broadcast FIFO
+	FSampleSinkBroadcastFifo *m_broadcastFifoF;
+	FSampleSinkBroadcastFifo::Reader *m_readerF; //!< this sink read cursor in the float broadcast FIFO
 
 public slots:
 	void handleFifoData();
+	void handleFifoDataF();
 };
 
 /**
@@ -64,9 +70,11 @@ public:
 	void stop();  //!< this thread exit() and wait()
 
 	bool handleSinkMessage(const Message& cmd); //!< Send message to sink synchronously
-	void feed(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly); //!< Feed sink with samples
+	void setBroadcastFifo(SampleSinkBroadcastFifo *broadcastFifo); //!< Sink is fed from this FIFO. Call in the writer thread with this thread stopped
+	void setBroadcastFifoF(FSampleSinkBroadcastFifo *broadcastFifo); //!< Sink is fed float baseband from this FIFO. Same conditions
 
 	QString getSampleSinkObjectName() const;
+	void getProfileStages(DSPProfile& profile); //!< Append the snapshots of the sink stages. Call in the engine thread
     const QThread *getThread() const { return m_thread; }
 
 protected:
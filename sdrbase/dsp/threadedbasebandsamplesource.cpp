@@ -64,6 +64,11 @@ void ThreadedBasebandSampleSource::pull(Sample& sample)
 	m_basebandSampleSource->pull(sample);
 }
 
+void ThreadedBasebandSampleSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+	m_basebandSampleSource->pull(begin, nbSamples);
+}
+
 void ThreadedBasebandSampleSource::feed(SampleSourceFifo* sampleFifo,
 	int nbSamples)
 {
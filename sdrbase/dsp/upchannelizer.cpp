@@ -32,7 +32,9 @@ UpChannelizer::UpChannelizer(BasebandSampleSource* sampleSource) :
     m_requestedInputSampleRate(0),
     m_requestedCenterFrequency(0),
     m_currentInputSampleRate(0),
-    m_currentCenterFrequency(0)
+    m_currentCenterFrequency(0),
+    m_sourceIndex(0),
+    m_sourceCount(0)
 {
     QString name = "UpChannelizer(" + m_sampleSource->objectName() + ")";
     setObjectName(name);
@@ -63,44 +65,75 @@ void UpChannelizer::pull(Sample& sample)
     else
     {
         m_mutex.lock();
+        pullStages(sample, 1);
+        m_mutex.unlock();
+    }
+}
+
+void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
+{
+    if(m_sampleSource == 0) {
+        m_sampleBuffer.clear();
+        return;
+    }
+
+    if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
+    {
+        m_sampleSource->pull(begin, nbSamples);
+    }
+    else
+    {
+        m_mutex.lock();
+
+        for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+            pullStages(*begin, nbSamples - i);
+        }
 
-        FilterStages::iterator stage = m_filterStages.begin();
-        std::vector<Sample>::iterator stageSample = m_stageSamples.begin();
+        m_mutex.unlock();
+    }
+}
+
+/**
+ * Run the interpolation chain for one output sample. Input samples are pulled from the modulator
+ * by blocks sized for the number of output samples still to be produced (nbRemaining) so that
+ * the modulator is called once per block rather than once per sample. Must be called with m_mutex locked.
+ */
+void UpChannelizer::pullStages(Sample& sample, unsigned int nbRemaining)
+{
+    FilterStages::iterator stage = m_filterStages.begin();
+    std::vector<Sample>::iterator stageSample = m_stageSamples.begin();
 
-        for (; stage != m_filterStages.end(); ++stage, ++stageSample)
+    for (; stage != m_filterStages.end(); ++stage, ++stageSample)
+    {
+        if(stage == m_filterStages.end() - 1)
         {
-            if(stage == m_filterStages.end() - 1)
+            if ((*stage)->work(&m_sampleIn, &(*stageSample))) // get new input sample
             {
-                if ((*stage)->work(&m_sampleIn, &(*stageSample)))
+                if (m_sourceIndex == m_sourceCount)
                 {
-                    m_sampleSource->pull(m_sampleIn); // get new input sample
+                    m_sourceCount = (nbRemaining >> m_filterStages.size()) + 1;
+
+                    if (m_sourceCount > m_sourceBuffer.size()) {
+                        m_sourceBuffer.resize(m_sourceCount);
+                    }
+
+                    m_sampleSource->pull(m_sourceBuffer.begin(), m_sourceCount);
+                    m_sourceIndex = 0;
                 }
+
+                m_sampleIn = m_sourceBuffer[m_sourceIndex++];
             }
-            else
+        }
+        else
+        {
+            if (!(*stage)->work(&(*(stageSample+1)), &(*stageSample)))
             {
-                if (!(*stage)->work(&(*(stageSample+1)), &(*stageSample)))
-                {
-                    break;
-                }
+                break;
             }
         }
-
-        sample = *m_stageSamples.begin();
-
-//		for (; stage != m_filterStages.end(); ++stage)
-//		{
-//			// let's make it work for one stage only (96 kS/s < SR < 192 kS/s)
-//			if(stage == m_filterStages.end() - 1)
-//			{
-//				if ((*stage)->work(&m_sampleIn, &sample))
-//				{
-//					m_sampleSource->pull(m_sampleIn); // get new input sample
-//				}
-//			}
-//		}
-
-        m_mutex.unlock();
     }
+
+    sample = *m_stageSamples.begin();
 }
 
 void UpChannelizer::start()
@@ -186,6 +219,8 @@ void UpChannelizer::applyConfiguration()
     m_mutex.lock();
 
     freeFilterChain();
+    m_sourceIndex = 0;
+    m_sourceCount = 0;
 
     m_currentCenterFrequency = createFilterChain(
         m_outputSampleRate / -2, m_outputSampleRate / 2,
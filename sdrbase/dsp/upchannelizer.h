@@ -72,6 +72,7 @@ public:
     virtual void start();
     virtual void stop();
     virtual void pull(Sample& sample);
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples);
     virtual void pullAudio(int nbSamples) { if (m_sampleSource) m_sampleSource->pullAudio(nbSamples); }
 
     virtual bool handleMessage(const Message& cmd);
@@ -112,8 +113,12 @@ protected:
     int m_currentCenterFrequency;
     SampleVector m_sampleBuffer;
     Sample m_sampleIn;
+    SampleVector m_sourceBuffer;          //!< Block of samples pulled from the modulator
+    unsigned int m_sourceIndex;           //!< Next sample to be read in m_sourceBuffer
+    unsigned int m_sourceCount;           //!< Number of valid samples in m_sourceBuffer
     QMutex m_mutex;
 
+    void pullStages(Sample& sample, unsigned int nbRemaining);
     void applyConfiguration();
     bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
     Real createFilterChain(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd);
@@ -18,6 +18,7 @@
 
 #include <QCommandLineOption>
 #include <QRegExpValidator>
+#include <QFileInfo>
 #include <QDebug>
 
 #include "mainparser.h"
@@ -30,10 +31,26 @@ MainParser::MainParser() :
     m_serverPortOption(QStringList() << "p" << "api-port",
         "Web API server port.",
         "port",
-        "8091")
+        "8091"),
+    m_profileOption(QStringList() << "profile",
+        "Log the DSP profile of the receive device sets every given number of seconds (0: disabled).",
+        "seconds",
+        "0"),
+    m_offlineOption(QStringList() << "offline",
+        "Server only. Play the I/Q recording through a file source device set as fast as the channels can process it, write the audio outputs in WAV files and exit at the end of the recording.",
+        "file"),
+    m_presetOption(QStringList() << "preset",
+        "Server only with --offline. Preset loaded in the device set before playing the recording given as group/description.",
+        "preset"),
+    m_wavDirectoryOption(QStringList() << "wav-dir",
+        "Server only with --offline. Directory where the audio WAV files are written.",
+        "directory",
+        ".")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
+    m_profilePeriod = 0;
+    m_wavDirectory = ".";
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -41,6 +58,10 @@ MainParser::MainParser() :
 
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
+    m_parser.addOption(m_profileOption);
+    m_parser.addOption(m_offlineOption);
+    m_parser.addOption(m_presetOption);
+    m_parser.addOption(m_wavDirectoryOption);
 }
 
 MainParser::~MainParser()
@@ -80,4 +101,35 @@ void MainParser::parse(const QCoreApplication& app)
     } else {
         qWarning() << "MainParser::parse: server port invalid. Defaulting to " << m_serverPort;
     }
+
+    // DSP profile period
+
+    QString profilePeriodStr = m_parser.value(m_profileOption);
+    int profilePeriod = profilePeriodStr.toInt(&ok);
+
+    if (ok && (profilePeriod >= 0)) {
+        m_profilePeriod = profilePeriod;
+    } else {
+        qWarning() << "MainParser::parse: profile period invalid. Defaulting to " << m_profilePeriod;
+    }
+
+    // offline processing
+
+    m_offlineFileName = m_parser.value(m_offlineOption);
+
+    if (!m_offlineFileName.isEmpty() && !QFileInfo(m_offlineFileName).isFile())
+    {
+        qWarning() << "MainParser::parse: offline recording " << m_offlineFileName << " not found. Offline mode disabled";
+        m_offlineFileName.clear();
+    }
+
+    m_presetName = m_parser.value(m_presetOption);
+
+    QString wavDirectory = m_parser.value(m_wavDirectoryOption);
+
+    if (QFileInfo(wavDirectory).isDir()) {
+        m_wavDirectory = wavDirectory;
+    } else {
+        qWarning() << "MainParser::parse: WAV directory invalid. Defaulting to " << m_wavDirectory;
+    }
 }
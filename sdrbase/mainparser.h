@@ -34,14 +34,26 @@ public:
 
     const QString& getServerAddress() const { return m_serverAddress; }
     uint16_t getServerPort() const { return m_serverPort; }
+    int getProfilePeriod() const { return m_profilePeriod; }
+    const QString& getOfflineFileName() const { return m_offlineFileName; }
+    const QString& getPresetName() const { return m_presetName; }
+    const QString& getWavDirectory() const { return m_wavDirectory; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
+    int      m_profilePeriod; //!< seconds between DSP profile dumps in the log. 0 to disable
+    QString  m_offlineFileName; //!< recording processed offline. Empty for normal operation
+    QString  m_presetName;      //!< group/description of the preset loaded for offline processing
+    QString  m_wavDirectory;    //!< where offline processing writes the audio outputs
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
+    QCommandLineOption m_profileOption;
+    QCommandLineOption m_offlineOption;
+    QCommandLineOption m_presetOption;
+    QCommandLineOption m_wavDirectoryOption;
 };
 
 
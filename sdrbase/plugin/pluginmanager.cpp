@@ -87,8 +87,17 @@ void PluginManager::loadPluginsFinal()
         it->pluginInterface->initPlugin(&m_pluginAPI);
     }
 
-    DeviceEnumerator::instance()->enumerateRxDevices(this);
-    DeviceEnumerator::instance()->enumerateTxDevices(this);
+    // start with the devices found last time if any and refresh them in the background
+    if (DeviceEnumerator::instance()->loadCache(this))
+    {
+        DeviceEnumerator::instance()->rescan(this);
+    }
+    else
+    {
+        DeviceEnumerator::instance()->enumerateRxDevices(this);
+        DeviceEnumerator::instance()->enumerateTxDevices(this);
+        DeviceEnumerator::instance()->saveCache();
+    }
 }
 
 void PluginManager::registerRxChannel(const QString& channelIdURI, const QString& channelId, PluginInterface* plugin)
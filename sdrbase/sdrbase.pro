@@ -64,6 +64,8 @@ SOURCES += audio/audiodevicemanager.cpp\
         audio/audiooutput.cpp\
         audio/audioinput.cpp\
         audio/audionetsink.cpp\
+        audio/audionetsinkthread.cpp\
+        audio/audiooutputfile.cpp\
         audio/audioresampler.cpp\
         channel/channelsinkapi.cpp\
         channel/channelsourceapi.cpp\
@@ -82,10 +84,12 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/cwkeyer.cpp\
         dsp/cwkeyersettings.cpp\
         dsp/decimatorsfi.cpp\
+        dsp/devicesamplepipeline.cpp\
         dsp/dspcommands.cpp\
         dsp/dspengine.cpp\
         dsp/dspdevicesourceengine.cpp\
         dsp/dspdevicesinkengine.cpp\
+        dsp/dspprofile.cpp\
         dsp/fftengine.cpp\
         dsp/kissengine.cpp\
         dsp/fftcorr.cpp\
@@ -94,19 +98,34 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/filterrc.cpp\
         dsp/filtermbe.cpp\
         dsp/filerecord.cpp\
+        dsp/filerecordblockreader.cpp\
+        dsp/filerecordcodec.cpp\
+        dsp/filerecordwriter.cpp\
         dsp/freqlockcomplex.cpp\
         dsp/interpolator.cpp\
         dsp/hbfiltertraits.cpp\
+        dsp/goertzelbank.cpp\
+        dsp/goertzelbank_x86.cpp\
+        dsp/goertzelbank_neon.cpp\
+        dsp/hbfilterkernels.cpp\
+        dsp/hbfilterkernels_x86.cpp\
+        dsp/hbfilterkernels_neon.cpp\
         dsp/lowpass.cpp\
         dsp/nco.cpp\
         dsp/ncof.cpp\
         dsp/phaselock.cpp\
         dsp/phaselockcomplex.cpp\
+        dsp/polyphasechannelizer.cpp\
+        dsp/polyphasefilterbank.cpp\
         dsp/projector.cpp\
         dsp/recursivefilters.cpp\
-        dsp/samplesinkfifo.cpp\
         dsp/samplesourcefifo.cpp\
         dsp/samplesinkfifodoublebuffered.cpp\
+        dsp/spectrumkernels.cpp\
+        dsp/spectrumkernels_x86.cpp\
+        dsp/spectrumkernels_neon.cpp\
+        dsp/spectrumstreamer.cpp\
+        dsp/spectrumvis.cpp\
         dsp/basebandsamplesink.cpp\
         dsp/basebandsamplesource.cpp\
         dsp/nullsink.cpp\
@@ -134,6 +153,7 @@ SOURCES += audio/audiodevicemanager.cpp\
         plugin/pluginmanager.cpp\
         webapi/webapiadapterinterface.cpp\
         webapi/webapirequestmapper.cpp\
+        webapi/webapirouter.cpp\
         webapi/webapiserver.cpp\
         mainparser.cpp
 
@@ -146,6 +166,8 @@ HEADERS  += audio/audiodevicemanager.h\
         audio/audiooutput.h\
         audio/audioinput.h\
         audio/audionetsink.h\
+        audio/audionetsinkthread.h\
+        audio/audiooutputfile.h\
         audio/audioresampler.h\        
         channel/channelsinkapi.h\
         channel/channelsourceapi.h\
@@ -166,10 +188,12 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/complex.h\
         dsp/decimators.h\
         dsp/interpolators.h\
+        dsp/devicesamplepipeline.h\
         dsp/dspcommands.h\
         dsp/dspengine.h\
         dsp/dspdevicesourceengine.h\
         dsp/dspdevicesinkengine.h\
+        dsp/dspprofile.h\
         dsp/dsptypes.h\
         dsp/fftcorr.h\
         dsp/fftengine.h\
@@ -179,9 +203,14 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/filterrc.h\
         dsp/filtermbe.h\
         dsp/filerecord.h\
+        dsp/filerecordblockreader.h\
+        dsp/filerecordcodec.h\
+        dsp/filerecordwriter.h\
         dsp/freqlockcomplex.h\
         dsp/gfft.h\
         dsp/hbfiltertraits.h\
+        dsp/goertzelbank.h\
+        dsp/hbfilterkernels.h\
         dsp/iirfilter.h\
         dsp/interpolator.h\
         dsp/inthalfbandfilter.h\
@@ -200,11 +229,20 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/phasediscri.h\
         dsp/phaselock.h\
         dsp/phaselockcomplex.h\
+        dsp/polyphasechannelizer.h\
+        dsp/polyphasefilterbank.h\
         dsp/projector.h\
         dsp/recursivefilters.h\
         dsp/samplesinkfifo.h\
+        dsp/samplesinkbroadcastfifo.h\
+        dsp/fsamplesinkfifo.h\
+        dsp/fsamplesinkbroadcastfifo.h\
         dsp/samplesourcefifo.h\
         dsp/samplesinkfifodoublebuffered.h\
+        dsp/spectrumkernels.h\
+        dsp/spectrumstreamer.h\
+        dsp/spectrumvis.h\
+        dsp/glspectruminterface.h\
         dsp/samplesinkfifodecimator.h\
         dsp/basebandsamplesink.h\
         dsp/basebandsamplesource.h\
@@ -224,6 +262,7 @@ HEADERS  += audio/audiodevicemanager.h\
         util/CRC64.h\
         util/db.h\
         util/message.h\
+        util/messagedispatcher.h\
         util/messagequeue.h\
         util/prettyprint.h\
         util/rtpsink.h\
@@ -232,8 +271,10 @@ HEADERS  += audio/audiodevicemanager.h\
         util/simpleserializer.h\
         util/uid.h\
         util/timeutil.h\
+        util/tokenbucket.h\
         webapi/webapiadapterinterface.h\
         webapi/webapirequestmapper.h\
+        webapi/webapirouter.h\
         webapi/webapiserver.h\
         mainparser.h
 
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 
+#include "dsp/spectrumkernels.h"
+
 template<typename T>
 class FixedAverage2D
 {
@@ -73,6 +75,28 @@ public:
         }
     }
 
+    /** Array version of storeAndGetAvg for length consecutive values starting at index. avg may be v. */
+    bool storeAndGetAvg(T *avg, const T *v, unsigned int index, unsigned int length)
+    {
+        if (m_size <= 1)
+        {
+            std::copy(v, v+length, avg);
+            return true;
+        }
+
+        SpectrumKernels::accumulate(m_sum+index, v, length);
+
+        if (m_maxIndex == m_size - 1)
+        {
+            SpectrumKernels::scale(m_sum+index, avg, length, (T) (1.0 / m_size));
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool storeAndGetSum(T& sum, T v, unsigned int index)
     {
         if (m_size <= 1)
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 
+#include "dsp/spectrumkernels.h"
+
 template<typename T>
 class Max2D
 {
@@ -78,6 +80,34 @@ public:
         }
     }
 
+    /** Array version of storeAndGetMax for length consecutive values starting at index. max may be v. */
+    bool storeAndGetMax(T *max, const T *v, unsigned int index, unsigned int length)
+    {
+        if (m_size <= 1)
+        {
+            std::copy(v, v+length, max);
+            return true;
+        }
+
+        if (m_maxIndex == 0)
+        {
+            std::copy(v, v+length, m_max+index);
+            return false;
+        }
+
+        SpectrumKernels::maximum(m_max+index, v, length);
+
+        if (m_maxIndex == m_size - 1)
+        {
+            std::copy(m_max+index, m_max+index+length, max);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool nextMax()
     {
         if (m_size <= 1) {
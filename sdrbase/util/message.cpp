@@ -16,15 +16,98 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <new>
 #include <QWaitCondition>
 #include <QMutex>
+#include <QAtomicInteger>
+#include <QtGlobal>
 #include "util/message.h"
 #include "util/messagequeue.h"
 
+namespace {
+
+/** Parent of each registered type id. Written once before the id is published. */
+int typeParents[Message::m_maxTypeIds];
+QBasicAtomicInteger<int> nbTypeIds; // zero initialized before any dynamic initialization
+
+/**
+ * Lock free pool of fixed size blocks. Free blocks are linked by index in a stack whose head
+ * carries a modification count in its upper 32 bits against the ABA problem. Blocks that were
+ * never used are taken from the end of the storage so that the pool costs nothing until used.
+ * Storage is static so it is never freed and a block address tells which pool it belongs to.
+ * It has no constructor so that it is usable during static initialization of other units.
+ */
+template<unsigned int BlockSize, unsigned int NbBlocks>
+class MessagePool
+{
+public:
+	void *allocate()
+	{
+		quint64 head = m_head.loadAcquire();
+
+		for (;;)
+		{
+			quint32 index = (quint32) head;
+
+			if (index == 0) // empty free list (indexes are stored plus one)
+			{
+				quint32 fresh = m_nbUsed.fetchAndAddRelaxed(1);
+
+				if (fresh < NbBlocks) {
+					return m_blocks[fresh];
+				}
+
+				m_nbUsed.fetchAndAddRelaxed(-1);
+				return 0;
+			}
+
+			quint64 newHead = ((head >> 32) + 1) << 32 | m_next[index - 1].loadAcquire();
+
+			if (m_head.testAndSetOrdered(head, newHead, head)) {
+				return m_blocks[index - 1];
+			}
+		}
+	}
+
+	bool owns(void *block) const
+	{
+		return ((char *) block >= m_blocks[0]) && ((char *) block < m_blocks[0] + NbBlocks*BlockSize);
+	}
+
+	void release(void *block)
+	{
+		quint32 index = ((char *) block - m_blocks[0]) / BlockSize;
+		quint64 head = m_head.loadAcquire();
+
+		for (;;)
+		{
+			m_next[index].storeRelease((quint32) head);
+			quint64 newHead = ((head >> 32) + 1) << 32 | (index + 1);
+
+			if (m_head.testAndSetOrdered(head, newHead, head)) {
+				return;
+			}
+		}
+	}
+
+private:
+	alignas(16) char m_blocks[NbBlocks][BlockSize];
+	QBasicAtomicInteger<quint32> m_next[NbBlocks]; //!< next free block index plus one
+	QBasicAtomicInteger<quint64> m_head;           //!< modification count << 32 | first free block index plus one
+	QBasicAtomicInteger<quint32> m_nbUsed;         //!< blocks taken from storage so far
+};
+
+MessagePool<64, 1024> pool64;
+MessagePool<128, 1024> pool128;
+MessagePool<256, 512> pool256;
+
+} // namespace
+
 const char* Message::m_identifier = 0;
 
 Message::Message() :
-	m_destination(0)
+	m_destination(0),
+	m_queueNext(0)
 {
 }
 
@@ -46,3 +129,81 @@ bool Message::match(const Message* message)
 {
 	return message->matchIdentifier(m_identifier);
 }
+
+int Message::getTypeId() const
+{
+	return getClassTypeId();
+}
+
+int Message::getClassTypeId()
+{
+	static const int typeId = registerTypeId(-1);
+	return typeId;
+}
+
+int Message::registerTypeId(int parentTypeId)
+{
+	int typeId = nbTypeIds.fetchAndAddOrdered(1);
+
+	if (typeId >= m_maxTypeIds)
+	{
+		qWarning("Message::registerTypeId: more than %d message types. Falling back to identifier matching", m_maxTypeIds);
+		return -1;
+	}
+
+	typeParents[typeId] = parentTypeId;
+	return typeId;
+}
+
+bool Message::isTypeOf(int typeId, int classTypeId)
+{
+	while (typeId >= 0)
+	{
+		if (typeId == classTypeId) {
+			return true;
+		}
+
+		typeId = typeParents[typeId];
+	}
+
+	return false;
+}
+
+int Message::getParentTypeId(int typeId)
+{
+	return ((typeId < 0) || (typeId >= getNbTypeIds())) ? -1 : typeParents[typeId];
+}
+
+int Message::getNbTypeIds()
+{
+	int nb = nbTypeIds.loadAcquire();
+	return nb > m_maxTypeIds ? m_maxTypeIds : nb;
+}
+
+void* Message::operator new(size_t size)
+{
+	void *block = 0;
+
+	if (size <= 64) {
+		block = pool64.allocate();
+	} else if (size <= 128) {
+		block = pool128.allocate();
+	} else if (size <= 256) {
+		block = pool256.allocate();
+	}
+
+	return block ? block : ::operator new(size);
+}
+
+void Message::operator delete(void *block)
+{
+	if (pool64.owns(block)) {
+		pool64.release(block);
+	} else if (pool128.owns(block)) {
+		pool128.release(block);
+	} else if (pool256.owns(block)) {
+		pool256.release(block);
+	} else {
+		::operator delete(block);
+	}
+}
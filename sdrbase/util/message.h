@@ -20,8 +20,18 @@
 #define INCLUDE_MESSAGE_H
 
 #include <stdlib.h>
+#include <QAtomicPointer>
 #include "export.h"
 
+/**
+ * Each message class gets an integer type identifier at first use. Type identifiers are
+ * small consecutive integers so that they can index handler tables (see MessageDispatcher).
+ * The parent type of each type is recorded so that match() does one virtual call and
+ * walks an array instead of comparing identifiers up the inheritance chain.
+ *
+ * Messages are allocated from a pool of fixed size blocks when they are small enough and
+ * can be passed between threads through MessageQueue without taking a lock on the producer side.
+ */
 class SDRBASE_API Message {
 public:
 	Message();
@@ -31,13 +41,31 @@ public:
 	virtual bool matchIdentifier(const char* identifier) const;
 	static bool match(const Message* message);
 
+	virtual int getTypeId() const;
+	static int getClassTypeId();
+	static bool isTypeOf(int typeId, int classTypeId); //!< true if typeId is classTypeId or derives from it
+	static int getParentTypeId(int typeId);            //!< -1 for the root Message type or unknown types
+	static int getNbTypeIds();
+
 	void* getDestination() const { return m_destination; }
 	void setDestination(void *destination) { m_destination = destination; }
 
+	static void* operator new(size_t size);   //!< pooled allocation
+	static void operator delete(void *block);
+
+	static const int m_maxTypeIds = 8192;
+
 protected:
 	// addressing
 	static const char* m_identifier;
 	void* m_destination;
+
+	static int registerTypeId(int parentTypeId); //!< returns -1 if the registry is full
+
+private:
+	QAtomicPointer<Message> m_queueNext; //!< intrusive link used by MessageQueue
+
+	friend class MessageQueue;
 };
 
 #define MESSAGE_CLASS_DECLARATION \
@@ -45,6 +73,8 @@ protected:
 		const char* getIdentifier() const; \
 		bool matchIdentifier(const char* identifier) const; \
 		static bool match(const Message& message); \
+		int getTypeId() const; \
+		static int getClassTypeId(); \
 	protected: \
 		static const char* m_identifier; \
 	private:
@@ -55,6 +85,15 @@ protected:
 	bool Name::matchIdentifier(const char* identifier) const {\
 		return (m_identifier == identifier) ? true : BaseClass::matchIdentifier(identifier); \
 	} \
-	bool Name::match(const Message& message) { return message.matchIdentifier(m_identifier); }
+	int Name::getTypeId() const { return getClassTypeId(); } \
+	int Name::getClassTypeId() { \
+		static const int typeId = Message::registerTypeId(BaseClass::getClassTypeId()); \
+		return typeId; \
+	} \
+	bool Name::match(const Message& message) { \
+		int typeId = message.getTypeId(); \
+		int classTypeId = getClassTypeId(); \
+		return ((typeId < 0) || (classTypeId < 0)) ? message.matchIdentifier(m_identifier) : Message::isTypeOf(typeId, classTypeId); \
+	}
 
 #endif // INCLUDE_MESSAGE_H
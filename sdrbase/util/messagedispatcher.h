@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_MESSAGEDISPATCHER_H_
+#define SDRBASE_UTIL_MESSAGEDISPATCHER_H_
+
+#include <vector>
+
+#include "util/message.h"
+
+/**
+ * Jump table from message type ids to handler methods of a class T. It replaces a chain of
+ * Msg::match() tests by an array lookup. A handler registered for a message class also
+ * handles the classes derived from it unless they have their own handler.
+ *
+ * Typical use in a message handling class:
+ *
+ *   m_dispatcher.add<MsgConfigureSomething>(&Something::handleConfigure);
+ *   ...
+ *   bool Something::handleMessage(const Message& cmd) { return m_dispatcher.dispatch(this, cmd); }
+ */
+template<class T>
+class MessageDispatcher
+{
+public:
+    typedef bool (T::*Handler)(const Message& message);
+
+    template<class M>
+    void add(Handler handler)
+    {
+        int typeId = M::getClassTypeId();
+
+        if (typeId < 0) { // registry full: cannot index
+            m_fallbackHandlers.push_back(FallbackHandler(&M::match, handler));
+            return;
+        }
+
+        if ((int) m_handlers.size() <= typeId) {
+            m_handlers.resize(typeId + 1, (Handler) 0);
+        }
+
+        m_handlers[typeId] = handler;
+    }
+
+    /** Call the handler of the message type or of its closest parent. Returns false if there is none */
+    bool dispatch(T *object, const Message& message) const
+    {
+        for (int typeId = message.getTypeId(); typeId >= 0; typeId = Message::getParentTypeId(typeId))
+        {
+            if ((typeId < (int) m_handlers.size()) && m_handlers[typeId]) {
+                return (object->*m_handlers[typeId])(message);
+            }
+        }
+
+        for (typename std::vector<FallbackHandler>::const_iterator it = m_fallbackHandlers.begin(); it != m_fallbackHandlers.end(); ++it)
+        {
+            if (it->m_match(message)) {
+                return (object->*(it->m_handler))(message);
+            }
+        }
+
+        return false;
+    }
+
+private:
+    struct FallbackHandler
+    {
+        bool (*m_match)(const Message& message);
+        Handler m_handler;
+
+        FallbackHandler(bool (*match)(const Message& message), Handler handler) :
+            m_match(match),
+            m_handler(handler)
+        {}
+    };
+
+    std::vector<Handler> m_handlers; //!< indexed by message type id
+    std::vector<FallbackHandler> m_fallbackHandlers;
+};
+
+#endif // SDRBASE_UTIL_MESSAGEDISPATCHER_H_
@@ -23,8 +23,9 @@
 
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
-	m_lock(QMutex::Recursive),
-	m_queue()
+	m_head(&m_stub),
+	m_tail(&m_stub),
+	m_size(0)
 {
 }
 
@@ -39,13 +40,19 @@ MessageQueue::~MessageQueue()
 	}
 }
 
+void MessageQueue::link(Message *message)
+{
+	message->m_queueNext.storeRelease(0);
+	Message *previous = m_head.fetchAndStoreOrdered(message);
+	previous->m_queueNext.storeRelease(message);
+}
+
 void MessageQueue::push(Message* message, bool emitSignal)
 {
 	if (message)
 	{
-		m_lock.lock();
-		m_queue.append(message);
-		m_lock.unlock();
+		link(message);
+		m_size.fetchAndAddRelease(1);
 	}
 
 	if (emitSignal)
@@ -56,27 +63,51 @@ void MessageQueue::push(Message* message, bool emitSignal)
 
 Message* MessageQueue::pop()
 {
-	QMutexLocker locker(&m_lock);
+	QMutexLocker locker(&m_popLock);
+
+	Message *tail = m_tail;
+	Message *next = tail->m_queueNext.loadAcquire();
 
-	if (m_queue.isEmpty())
+	if (tail == &m_stub)
 	{
-		return 0;
+		if (next == 0) {
+			return 0;
+		}
+
+		m_tail = next;
+		tail = next;
+		next = next->m_queueNext.loadAcquire();
 	}
-	else
+
+	if (next == 0)
 	{
-		return m_queue.takeFirst();
+		if (tail != m_head.loadAcquire()) {
+			return 0; // a producer has exchanged the head but not linked it yet
+		}
+
+		link(&m_stub); // tail is the last message: put the stub behind it so that it can be taken out
+		next = tail->m_queueNext.loadAcquire();
+
+		if (next == 0) {
+			return 0;
+		}
 	}
+
+	m_tail = next;
+	m_size.fetchAndAddRelease(-1);
+	return tail;
 }
 
 int MessageQueue::size()
 {
-	QMutexLocker locker(&m_lock);
-
-	return m_queue.size();
+	return m_size.loadAcquire();
 }
 
 void MessageQueue::clear()
 {
-	QMutexLocker locker(&m_lock);
-	m_queue.clear();
+	Message* message;
+
+	while ((message = pop()) != 0) {
+		delete message;
+	}
 }
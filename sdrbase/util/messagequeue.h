@@ -20,12 +20,20 @@
 #define INCLUDE_MESSAGEQUEUE_H
 
 #include <QObject>
-#include <QQueue>
 #include <QMutex>
+#include <QAtomicPointer>
+#include <QAtomicInteger>
+#include "util/message.h"
 #include "export.h"
 
-class Message;
-
+/**
+ * Multiple producers single consumer queue of messages. Messages are linked through their
+ * own link field (intrusive list with a stub node) so that push does not allocate and does
+ * not take a lock: it is one atomic exchange and one store. Pop is protected by a lock only
+ * taken by consumers which is not contended in the normal one consumer case.
+ * Pop may return 0 while a producer is in the middle of a push. The message is then
+ * available at the latest when the producer emits messageEnqueued.
+ */
 class SDRBASE_API MessageQueue : public QObject {
 	Q_OBJECT
 
@@ -37,14 +45,19 @@ public:
 	Message* pop(); //!< Pop message from queue
 
 	int size(); //!< Returns queue size
-	void clear(); //!< Empty queue
+	void clear(); //!< Empty queue and delete its messages
 
 signals:
 	void messageEnqueued();
 
 private:
-	QMutex m_lock;
-	QQueue<Message*> m_queue;
+	QMutex m_popLock;               //!< consumers only
+	Message m_stub;                 //!< list anchor when empty
+	QAtomicPointer<Message> m_head; //!< last pushed message updated by producers
+	Message *m_tail;                //!< next message to pop
+	QAtomicInt m_size;
+
+	void link(Message *message);
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 
+#include "dsp/spectrumkernels.h"
+
 template<typename T>
 class MovingAverage2D
 {
@@ -105,8 +107,38 @@ public:
         }
     }
 
-    void nextAverage() {
-        m_avgIndex = m_avgIndex == m_depth-1 ? 0 : m_avgIndex+1;
+    /** Array version of storeAndGetAvg for length consecutive values starting at index. avg may be v. */
+    void storeAndGetAvg(T *avg, const T *v, unsigned int index, unsigned int length)
+    {
+        if (m_depth <= 1)
+        {
+            std::copy(v, v+length, avg);
+            return;
+        }
+
+        SpectrumKernels::movingSum(m_sum+index, m_data+m_avgIndex*m_width+index, v, avg, length, (T) (1.0 / m_depth));
+    }
+
+    void nextAverage()
+    {
+        if (m_depth <= 1) {
+            return;
+        }
+
+        if (m_avgIndex == m_depth-1)
+        {
+            m_avgIndex = 0;
+            // sums are only updated with differences: recompute them once per cycle so that rounding errors do not build up
+            std::fill(m_sum, m_sum+m_width, 0);
+
+            for (unsigned int i = 0; i < m_depth; i++) {
+                SpectrumKernels::accumulate(m_sum, m_data+i*m_width, m_width);
+            }
+        }
+        else
+        {
+            m_avgIndex++;
+        }
     }
 
 private:
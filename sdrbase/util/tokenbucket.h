@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_TOKENBUCKET_H_
+#define SDRBASE_UTIL_TOKENBUCKET_H_
+
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+/**
+ * Token bucket rate limiter. Tokens (e.g. datagrams) are refilled continuously at
+ * the given rate up to the bucket depth. Taking more tokens than available blocks
+ * the calling thread just long enough. This lets a sender pace its output with a
+ * few sleeps per burst instead of one sleep per item.
+ */
+class TokenBucket
+{
+public:
+    TokenBucket() :
+        m_rate(0.0),
+        m_depth(1.0),
+        m_tokens(1.0),
+        m_last(std::chrono::steady_clock::now())
+    {}
+
+    /** Rate in tokens per second (0 for unlimited) and maximum burst size in tokens */
+    void setRate(double rate, double depth)
+    {
+        m_rate = rate;
+        m_depth = std::max(depth, 1.0);
+        m_tokens = std::min(m_tokens, m_depth);
+    }
+
+    double getRate() const { return m_rate; }
+    double getDepth() const { return m_depth; }
+    bool isUnlimited() const { return m_rate <= 0.0; }
+
+    /** Wait until n tokens are available then consume them. n is capped to the bucket depth */
+    void take(double n)
+    {
+        if (isUnlimited()) {
+            return;
+        }
+
+        n = std::min(n, m_depth);
+        refill();
+
+        if (m_tokens < n)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>((n - m_tokens) / m_rate));
+            refill();
+        }
+
+        m_tokens -= n; // may go slightly negative if the sleep was short: next take() compensates
+    }
+
+private:
+    double m_rate;
+    double m_depth;
+    double m_tokens;
+    std::chrono::steady_clock::time_point m_last;
+
+    void refill()
+    {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed = now - m_last;
+        m_last = now;
+        m_tokens = std::min(m_depth, m_tokens + elapsed.count() * m_rate);
+    }
+};
+
+#endif /* SDRBASE_UTIL_TOKENBUCKET_H_ */
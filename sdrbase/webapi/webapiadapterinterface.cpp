@@ -36,14 +36,16 @@ QString WebAPIAdapterInterface::instancePresetFileURL = "/sdrangel/preset/file";
 QString WebAPIAdapterInterface::instanceDeviceSetsURL = "/sdrangel/devicesets";
 QString WebAPIAdapterInterface::instanceDeviceSetURL = "/sdrangel/deviceset";
 
-std::regex WebAPIAdapterInterface::devicesetURLRe("^/sdrangel/deviceset/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0-9]{1,2})/focus$");
-std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
-std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
-std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run");
-std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
-std::regex WebAPIAdapterInterface::devicesetChannelsReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channels/report$");
-std::regex WebAPIAdapterInterface::devicesetChannelURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel$");
-std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
-std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report");
+QByteArray WebAPIAdapterInterface::devicesetURL("/sdrangel/deviceset/{deviceSetIndex}");
+QByteArray WebAPIAdapterInterface::devicesetFocusURL("/sdrangel/deviceset/{deviceSetIndex}/focus");
+QByteArray WebAPIAdapterInterface::devicesetDeviceURL("/sdrangel/deviceset/{deviceSetIndex}/device");
+QByteArray WebAPIAdapterInterface::devicesetDeviceSettingsURL("/sdrangel/deviceset/{deviceSetIndex}/device/settings");
+QByteArray WebAPIAdapterInterface::devicesetDeviceRunURL("/sdrangel/deviceset/{deviceSetIndex}/device/run");
+QByteArray WebAPIAdapterInterface::devicesetDeviceReportURL("/sdrangel/deviceset/{deviceSetIndex}/device/report");
+QByteArray WebAPIAdapterInterface::devicesetChannelsReportURL("/sdrangel/deviceset/{deviceSetIndex}/channels/report");
+QByteArray WebAPIAdapterInterface::devicesetChannelURL("/sdrangel/deviceset/{deviceSetIndex}/channel");
+QByteArray WebAPIAdapterInterface::devicesetChannelIndexURL("/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}");
+QByteArray WebAPIAdapterInterface::devicesetChannelSettingsURL("/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings");
+QByteArray WebAPIAdapterInterface::devicesetChannelReportURL("/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/report");
+QByteArray WebAPIAdapterInterface::devicesetSpectrumStreamURL("/sdrangel/deviceset/{deviceSetIndex}/spectrum/stream");
+QByteArray WebAPIAdapterInterface::devicesetProfileURL("/sdrangel/deviceset/{deviceSetIndex}/profile");
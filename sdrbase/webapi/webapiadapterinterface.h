@@ -21,7 +21,7 @@
 #define SDRBASE_WEBAPI_WEBAPIADAPTERINTERFACE_H_
 
 #include <QString>
-#include <regex>
+#include <QByteArray>
 
 #include "SWGErrorResponse.h"
 
@@ -50,11 +50,14 @@ namespace SWGSDRangel
     class SWGDeviceState;
     class SWGDeviceReport;
     class SWGChannelsDetail;
+    class SWGDeviceSetProfile;
     class SWGChannelSettings;
     class SWGChannelReport;
     class SWGSuccessResponse;
 }
 
+class SpectrumStreamer;
+
 class SDRBASE_API WebAPIAdapterInterface
 {
 public:
@@ -724,6 +727,42 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/spectrum/stream (GET)
+     * Not a JSON API: subscribes to the spectrum streamer of the device set whose binary frames are pushed to the client.
+     * On success the streamer stays valid until the caller unsubscribes (with the same iq flag)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumStreamGet(
+            int deviceSetIndex,
+            bool iq,
+            SpectrumStreamer*& streamer,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) iq;
+        (void) streamer;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/profile (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetProfileGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetProfileGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetProfile& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     static QString instanceSummaryURL;
     static QString instanceDevicesURL;
     static QString instanceChannelsURL;
@@ -740,17 +779,19 @@ public:
     static QString instancePresetFileURL;
     static QString instanceDeviceSetsURL;
     static QString instanceDeviceSetURL;
-    static std::regex devicesetURLRe;
-    static std::regex devicesetFocusURLRe;
-    static std::regex devicesetDeviceURLRe;
-    static std::regex devicesetDeviceSettingsURLRe;
-    static std::regex devicesetDeviceRunURLRe;
-    static std::regex devicesetDeviceReportURLRe;
-    static std::regex devicesetChannelURLRe;
-    static std::regex devicesetChannelIndexURLRe;
-    static std::regex devicesetChannelSettingsURLRe;
-    static std::regex devicesetChannelReportURLRe;
-    static std::regex devicesetChannelsReportURLRe;
+    static QByteArray devicesetURL;
+    static QByteArray devicesetFocusURL;
+    static QByteArray devicesetDeviceURL;
+    static QByteArray devicesetDeviceSettingsURL;
+    static QByteArray devicesetDeviceRunURL;
+    static QByteArray devicesetDeviceReportURL;
+    static QByteArray devicesetChannelURL;
+    static QByteArray devicesetChannelIndexURL;
+    static QByteArray devicesetChannelSettingsURL;
+    static QByteArray devicesetChannelReportURL;
+    static QByteArray devicesetChannelsReportURL;
+    static QByteArray devicesetSpectrumStreamURL;
+    static QByteArray devicesetProfileURL;
 };
 
 
@@ -18,6 +18,8 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDirIterator>
+#include <QElapsedTimer>
+#include <QThread>
 #include <QJsonDocument>
 #include <QJsonArray>
 
@@ -25,6 +27,7 @@
 
 #include "httpdocrootsettings.h"
 #include "webapirequestmapper.h"
+#include "dsp/spectrumstreamer.h"
 #include "SWGInstanceSummaryResponse.h"
 #include "SWGInstanceDevicesResponse.h"
 #include "SWGInstanceChannelsResponse.h"
@@ -42,6 +45,7 @@
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
+#include "SWGDeviceSetProfile.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 
@@ -52,6 +56,36 @@ WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
     qtwebapp::HttpDocrootSettings docrootSettings;
     docrootSettings.path = ":/webapi";
     m_staticFileController = new qtwebapp::StaticFileController(docrootSettings, parent);
+
+    m_router.addRoute(WebAPIAdapterInterface::instanceSummaryURL.toLatin1(), RouteInstanceSummary);
+    m_router.addRoute(WebAPIAdapterInterface::instanceDevicesURL.toLatin1(), RouteInstanceDevices);
+    m_router.addRoute(WebAPIAdapterInterface::instanceChannelsURL.toLatin1(), RouteInstanceChannels);
+    m_router.addRoute(WebAPIAdapterInterface::instanceLoggingURL.toLatin1(), RouteInstanceLogging);
+    m_router.addRoute(WebAPIAdapterInterface::instanceAudioURL.toLatin1(), RouteInstanceAudio);
+    m_router.addRoute(WebAPIAdapterInterface::instanceAudioInputParametersURL.toLatin1(), RouteInstanceAudioInputParameters);
+    m_router.addRoute(WebAPIAdapterInterface::instanceAudioOutputParametersURL.toLatin1(), RouteInstanceAudioOutputParameters);
+    m_router.addRoute(WebAPIAdapterInterface::instanceAudioInputCleanupURL.toLatin1(), RouteInstanceAudioInputCleanup);
+    m_router.addRoute(WebAPIAdapterInterface::instanceAudioOutputCleanupURL.toLatin1(), RouteInstanceAudioOutputCleanup);
+    m_router.addRoute(WebAPIAdapterInterface::instanceLocationURL.toLatin1(), RouteInstanceLocation);
+    m_router.addRoute(WebAPIAdapterInterface::instanceDVSerialURL.toLatin1(), RouteInstanceDVSerial);
+    m_router.addRoute(WebAPIAdapterInterface::instancePresetsURL.toLatin1(), RouteInstancePresets);
+    m_router.addRoute(WebAPIAdapterInterface::instancePresetURL.toLatin1(), RouteInstancePreset);
+    m_router.addRoute(WebAPIAdapterInterface::instancePresetFileURL.toLatin1(), RouteInstancePresetFile);
+    m_router.addRoute(WebAPIAdapterInterface::instanceDeviceSetsURL.toLatin1(), RouteInstanceDeviceSets);
+    m_router.addRoute(WebAPIAdapterInterface::instanceDeviceSetURL.toLatin1(), RouteInstanceDeviceSet);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetURL, RouteDeviceset);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetFocusURL, RouteDevicesetFocus);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetDeviceURL, RouteDevicesetDevice);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetDeviceSettingsURL, RouteDevicesetDeviceSettings);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetDeviceRunURL, RouteDevicesetDeviceRun);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetDeviceReportURL, RouteDevicesetDeviceReport);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetChannelsReportURL, RouteDevicesetChannelsReport);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetChannelURL, RouteDevicesetChannel);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetChannelIndexURL, RouteDevicesetChannelIndex);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetChannelSettingsURL, RouteDevicesetChannelSettings);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetChannelReportURL, RouteDevicesetChannelReport);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetSpectrumStreamURL, RouteDevicesetSpectrumStream);
+    m_router.addRoute(WebAPIAdapterInterface::devicesetProfileURL, RouteDevicesetProfile);
 }
 
 WebAPIRequestMapper::~WebAPIRequestMapper()
@@ -87,77 +121,100 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             return;
         }
 
-        if (path == WebAPIAdapterInterface::instanceSummaryURL) {
+        std::vector<std::string> params;
+
+        switch (m_router.match(path, params))
+        {
+        case RouteInstanceSummary:
             instanceSummaryService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDevicesURL) {
+            break;
+        case RouteInstanceDevices:
             instanceDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceChannelsURL) {
+            break;
+        case RouteInstanceChannels:
             instanceChannelsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLoggingURL) {
+            break;
+        case RouteInstanceLogging:
             instanceLoggingService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioURL) {
+            break;
+        case RouteInstanceAudio:
             instanceAudioService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputParametersURL) {
+            break;
+        case RouteInstanceAudioInputParameters:
             instanceAudioInputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputParametersURL) {
+            break;
+        case RouteInstanceAudioOutputParameters:
             instanceAudioOutputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputCleanupURL) {
+            break;
+        case RouteInstanceAudioInputCleanup:
             instanceAudioInputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputCleanupURL) {
+            break;
+        case RouteInstanceAudioOutputCleanup:
             instanceAudioOutputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLocationURL) {
+            break;
+        case RouteInstanceLocation:
             instanceLocationService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDVSerialURL) {
+            break;
+        case RouteInstanceDVSerial:
             instanceDVSerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetsURL) {
+            break;
+        case RouteInstancePresets:
             instancePresetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetURL) {
+            break;
+        case RouteInstancePreset:
             instancePresetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetFileURL) {
+            break;
+        case RouteInstancePresetFile:
             instancePresetFileService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetsURL) {
+            break;
+        case RouteInstanceDeviceSets:
             instanceDeviceSetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetURL) {
+            break;
+        case RouteInstanceDeviceSet:
             instanceDeviceSetService(request, response);
-        }
-        else
-        {
-            std::smatch desc_match;
-            std::string pathStr(path.constData(), path.length());
-
-            if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetURLRe)) {
-                devicesetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceURLRe)) {
-                devicesetDeviceService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
-                devicesetFocusService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
-                devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
-                devicesetDeviceRunService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceReportURLRe)) {
-                devicesetDeviceReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelsReportURLRe)) {
-                devicesetChannelsReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelURLRe)) {
-                devicesetChannelService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelIndexURLRe)) {
-                devicesetChannelIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsURLRe)) {
-                devicesetChannelSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelReportURLRe)) {
-                devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            }
-            else // serve static documentation pages
-            {
-                m_staticFileController->service(request, response);
-            }
-
-//            QDirIterator it(":", QDirIterator::Subdirectories);
-//            while (it.hasNext()) {
-//                qDebug() << "WebAPIRequestMapper::service: " << it.next();
-//            }
-
+            break;
+        case RouteDeviceset:
+            devicesetService(params[0], request, response);
+            break;
+        case RouteDevicesetDevice:
+            devicesetDeviceService(params[0], request, response);
+            break;
+        case RouteDevicesetFocus:
+            devicesetFocusService(params[0], request, response);
+            break;
+        case RouteDevicesetDeviceSettings:
+            devicesetDeviceSettingsService(params[0], request, response);
+            break;
+        case RouteDevicesetDeviceRun:
+            devicesetDeviceRunService(params[0], request, response);
+            break;
+        case RouteDevicesetDeviceReport:
+            devicesetDeviceReportService(params[0], request, response);
+            break;
+        case RouteDevicesetChannelsReport:
+            devicesetChannelsReportService(params[0], request, response);
+            break;
+        case RouteDevicesetChannel:
+            devicesetChannelService(params[0], request, response);
+            break;
+        case RouteDevicesetChannelIndex:
+            devicesetChannelIndexService(params[0], params[1], request, response);
+            break;
+        case RouteDevicesetChannelSettings:
+            devicesetChannelSettingsService(params[0], params[1], request, response);
+            break;
+        case RouteDevicesetChannelReport:
+            devicesetChannelReportService(params[0], params[1], request, response);
+            break;
+        case RouteDevicesetSpectrumStream:
+            devicesetSpectrumStreamService(params[0], request, response);
+            break;
+        case RouteDevicesetProfile:
+            devicesetProfileService(params[0], request, response);
+            break;
+        default: // serve static documentation pages
+            m_staticFileController->service(request, response);
+            break;
         }
     }
 }
@@ -1616,6 +1673,145 @@ void WebAPIRequestMapper::devicesetChannelReportService(
     }
 }
 
+void WebAPIRequestMapper::devicesetSpectrumStreamService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() != "GET")
+    {
+        response.setHeader("Content-Type", "application/json");
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    // subscriber options from the query string
+    bool ok;
+    int frameRate = request.getParameter("frameRate").toInt(&ok);
+    frameRate = !ok ? 10 : frameRate < 1 ? 1 : frameRate > 50 ? 50 : frameRate;
+    int binDecimation = request.getParameter("binDecimation").toInt(&ok);
+    binDecimation = !ok || (binDecimation < 1) ? 1 : binDecimation;
+    int iqDecimation = request.getParameter("iqDecimation").toInt(&ok);
+    iqDecimation = !ok || (iqDecimation < 0) ? 0 : iqDecimation;
+
+    SpectrumStreamer *streamer = 0; // subscribed on success
+    int status;
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        status = m_adapter->devicesetSpectrumStreamGet(deviceSetIndex, iqDecimation > 0, streamer, errorResponse);
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setHeader("Content-Type", "application/json");
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    if (status/100 != 2)
+    {
+        response.setHeader("Content-Type", "application/json");
+        response.setStatus(status);
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    // stream frames in chunked mode until the client leaves or the device set is removed
+    response.setHeader("Content-Type", "application/octet-stream");
+    response.setHeader("Cache-Control", "no-cache");
+    response.setStatus(200, "OK");
+    response.write(QByteArray());
+
+    qint64 framePeriodMs = 1000 / frameRate;
+    quint32 sequence = 0;
+    QByteArray powerFrame, iqFrame;
+    QElapsedTimer timer;
+    timer.start();
+
+    while (response.isConnected() && !streamer->isClosing())
+    {
+        if (streamer->waitForFrame(sequence, 1000))
+        {
+            qint64 frameTimeMs = timer.elapsed();
+            sequence = streamer->getFrames(binDecimation, iqDecimation, powerFrame, iqFrame);
+            response.write(powerFrame);
+
+            if (iqFrame.size() > 0) {
+                response.write(iqFrame);
+            }
+
+            if (!response.waitForBytesWritten(1000)) {
+                break;
+            }
+
+            qint64 remainingMs = framePeriodMs - (timer.elapsed() - frameTimeMs);
+
+            if (remainingMs > 0) {
+                QThread::msleep(remainingMs);
+            }
+        }
+        else if (!streamer->isClosing()) // no frame for a while: tell the client we are still alive
+        {
+            response.write(streamer->getHeartbeatFrame());
+
+            if (!response.waitForBytesWritten(1000)) {
+                break;
+            }
+        }
+    }
+
+    streamer->unsubscribe(iqDecimation > 0);
+
+    if (response.isConnected()) {
+        response.write(QByteArray(), true);
+    }
+}
+
+void WebAPIRequestMapper::devicesetProfileService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        try
+        {
+            SWGSDRangel::SWGDeviceSetProfile normalResponse;
+            int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+            int status = m_adapter->devicesetProfileGet(deviceSetIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        catch (const boost::bad_lexical_cast &e)
+        {
+            errorResponse.init();
+            *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+            response.setStatus(400,"Invalid data");
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 bool WebAPIRequestMapper::parseJsonBody(QString& jsonStr, QJsonObject& jsonObject, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
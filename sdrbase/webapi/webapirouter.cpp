@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QList>
+
+#include "webapirouter.h"
+
+WebAPIRouter::Node::~Node()
+{
+    for (std::vector<std::pair<QByteArray, Node*> >::iterator it = m_children.begin(); it != m_children.end(); ++it) {
+        delete it->second;
+    }
+
+    delete m_indexChild;
+}
+
+WebAPIRouter::WebAPIRouter()
+{}
+
+WebAPIRouter::~WebAPIRouter()
+{}
+
+void WebAPIRouter::addRoute(const QByteArray& pattern, int routeId)
+{
+    QList<QByteArray> segments = pattern.split('/');
+    Node *node = &m_root;
+
+    for (int i = 1; i < segments.size(); i++) // pattern starts with a slash
+    {
+        const QByteArray& segment = segments.at(i);
+
+        if (segment.startsWith('{') && segment.endsWith('}'))
+        {
+            if (!node->m_indexChild) {
+                node->m_indexChild = new Node();
+            }
+
+            node = node->m_indexChild;
+            continue;
+        }
+
+        Node *child = 0;
+
+        for (std::vector<std::pair<QByteArray, Node*> >::iterator it = node->m_children.begin(); it != node->m_children.end(); ++it)
+        {
+            if (it->first == segment)
+            {
+                child = it->second;
+                break;
+            }
+        }
+
+        if (!child)
+        {
+            child = new Node();
+            node->m_children.push_back(std::pair<QByteArray, Node*>(segment, child));
+        }
+
+        node = child;
+    }
+
+    node->m_routeId = routeId;
+}
+
+int WebAPIRouter::match(const QByteArray& path, std::vector<std::string>& params) const
+{
+    params.clear();
+    const char *p = path.constData();
+    const char *end = p + path.size();
+
+    if ((p == end) || (*p != '/')) {
+        return -1;
+    }
+
+    const Node *node = &m_root;
+
+    while (p < end)
+    {
+        const char *segment = p + 1;
+        const char *segmentEnd = (const char *) memchr(segment, '/', end - segment);
+
+        if (!segmentEnd) {
+            segmentEnd = end;
+        }
+
+        int length = segmentEnd - segment;
+        const Node *next = 0;
+
+        for (std::vector<std::pair<QByteArray, Node*> >::const_iterator it = node->m_children.begin(); it != node->m_children.end(); ++it)
+        {
+            if ((it->first.size() == length) && (memcmp(it->first.constData(), segment, length) == 0))
+            {
+                next = it->second;
+                break;
+            }
+        }
+
+        if (!next && node->m_indexChild && isIndex(segment, length))
+        {
+            params.push_back(std::string(segment, length));
+            next = node->m_indexChild;
+        }
+
+        if (!next) {
+            return -1;
+        }
+
+        node = next;
+        p = segmentEnd;
+    }
+
+    return node->m_routeId;
+}
+
+bool WebAPIRouter::isIndex(const char *segment, int length)
+{
+    if ((length < 1) || (length > 2)) {
+        return false;
+    }
+
+    for (int i = 0; i < length; i++)
+    {
+        if ((segment[i] < '0') || (segment[i] > '9')) {
+            return false;
+        }
+    }
+
+    return true;
+}
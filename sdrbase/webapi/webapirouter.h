@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIROUTER_H_
+#define SDRBASE_WEBAPI_WEBAPIROUTER_H_
+
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+
+#include "export.h"
+
+/**
+ * Maps request paths to route identifiers with a trie of path segments built once.
+ * A pattern segment written {name} matches an index of one or two decimal digits which is
+ * returned in the parameters list in path order. Matching walks the path once and does not
+ * allocate except for the returned parameters.
+ */
+class SDRBASE_API WebAPIRouter
+{
+public:
+    WebAPIRouter();
+    ~WebAPIRouter();
+
+    void addRoute(const QByteArray& pattern, int routeId);
+    int match(const QByteArray& path, std::vector<std::string>& params) const; //!< route identifier or -1 if none matches
+
+private:
+    struct Node
+    {
+        std::vector<std::pair<QByteArray, Node*> > m_children; //!< literal segments
+        Node *m_indexChild; //!< {index} segment
+        int m_routeId;      //!< route ending at this node or -1
+
+        Node() :
+            m_indexChild(0),
+            m_routeId(-1)
+        {}
+        ~Node();
+    };
+
+    Node m_root;
+
+    static bool isIndex(const char *segment, int length);
+};
+
+#endif // SDRBASE_WEBAPI_WEBAPIROUTER_H_
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/downchannelizer.h"
+#include "audio/audiodevicemanager.h"
+#include "device/devicesourceapi.h"
+
+#include "demodnfm/nfmdemod.h"
+#include "demodam/amdemod.h"
+#include "demodssb/ssbdemod.h"
+#include "demodwfm/wfmdemod.h"
+#include "demodbfm/bfmdemod.h"
+
+#include "benchdemods.h"
+
+const char *BenchDemods::m_names[] = {"nfm", "am", "ssb", "wfm", "bfm", 0};
+
+BenchDemods::BenchDemods()
+{
+    DSPEngine::instance()->getAudioDeviceManager()->setNullOutput(true);
+    m_deviceSourceEngine = DSPEngine::instance()->addDeviceSourceEngine();
+    m_deviceSourceEngine->start();
+    m_deviceSourceAPI = new DeviceSourceAPI(0, m_deviceSourceEngine);
+}
+
+BenchDemods::~BenchDemods()
+{
+    m_deviceSourceEngine->stop();
+    DSPEngine::instance()->removeLastDeviceSourceEngine();
+    delete m_deviceSourceAPI;
+    DSPEngine::instance()->getAudioDeviceManager()->setNullOutput(false);
+}
+
+int BenchDemods::getInputSampleRate(const QString& name)
+{
+    if ((name == "wfm") || (name == "bfm")) {
+        return 384000;
+    } else {
+        return 96000;
+    }
+}
+
+BasebandSampleSink *BenchDemods::create(const QString& name)
+{
+    BasebandSampleSink *demod;
+
+    if (name == "nfm") {
+        demod = new NFMDemod(m_deviceSourceAPI);
+    } else if (name == "am") {
+        demod = new AMDemod(m_deviceSourceAPI);
+    } else if (name == "ssb") {
+        demod = new SSBDemod(m_deviceSourceAPI);
+    } else if (name == "wfm") {
+        demod = new WFMDemod(m_deviceSourceAPI);
+    } else if (name == "bfm") {
+        demod = new BFMDemod(m_deviceSourceAPI);
+    } else {
+        return 0;
+    }
+
+    // what the channelizer tells the channel once it is set to the channel sample rate
+    DownChannelizer::MsgChannelizerNotification *notif =
+        DownChannelizer::MsgChannelizerNotification::create(getInputSampleRate(name), m_inputFrequencyOffset);
+    demod->handleMessage(*notif);
+    delete notif;
+
+    // sets the channel running as the device engine does when acquisition starts
+    demod->start();
+
+    return demod;
+}
+
+double BenchDemods::getMagSqPeak(const QString& name, BasebandSampleSink *demod)
+{
+    double avg = 0.0, peak = 0.0;
+    int nbSamples;
+
+    if (name == "nfm") {
+        ((NFMDemod *) demod)->getMagSqLevels(avg, peak, nbSamples);
+    } else if (name == "am") {
+        ((AMDemod *) demod)->getMagSqLevels(avg, peak, nbSamples);
+    } else if (name == "ssb") {
+        ((SSBDemod *) demod)->getMagSqLevels(avg, peak, nbSamples);
+    } else if (name == "wfm") {
+        ((WFMDemod *) demod)->getMagSqLevels(avg, peak, nbSamples);
+    } else if (name == "bfm") {
+        ((BFMDemod *) demod)->getMagSqLevels(avg, peak, nbSamples);
+    }
+
+    return peak;
+}
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHDEMODS_H_
+#define SDRBENCH_BENCHDEMODS_H_
+
+#include <QString>
+
+class BasebandSampleSink;
+class DSPDeviceSourceEngine;
+class DeviceSourceAPI;
+
+/**
+ * Runs the NFM, AM, SSB, WFM and BFM demodulator channel sinks of the plugins without a device.
+ * The channels are created on a device set made of a DSP device source engine that never acquires
+ * and its DeviceSourceAPI. The audio outputs are null so the audio FIFOs of the channels are not
+ * read and fill up. Samples are fed directly to the channel sink at its channel sample rate as the
+ * channelizer would do.
+ */
+class BenchDemods
+{
+public:
+    BenchDemods();
+    ~BenchDemods();
+
+    BasebandSampleSink *create(const QString& name); //!< "nfm", "am", "ssb", "wfm" or "bfm" started. Null if unknown
+    static double getMagSqPeak(const QString& name, BasebandSampleSink *demod); //!< peak magnitude squared seen by the channel. Zero if nothing was processed
+
+    static int getInputSampleRate(const QString& name);
+    static const char *m_names[]; //!< null terminated list of the demodulator names
+    static const int m_inputFrequencyOffset = 10000; //!< signals are generated 10 kHz above the center
+
+private:
+    DSPDeviceSourceEngine *m_deviceSourceEngine;
+    DeviceSourceAPI *m_deviceSourceAPI;
+};
+
+#endif // SDRBENCH_BENCHDEMODS_H_
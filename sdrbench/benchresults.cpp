@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QMap>
+#include <QDebug>
+
+#include "benchresults.h"
+
+void BenchResults::add(const QString& test, const QString& scenario, const QString& isa, qint64 nsecs, double rate, const QString& unit)
+{
+    Result result;
+    result.m_test = test;
+    result.m_scenario = scenario;
+    result.m_isa = isa;
+    result.m_nsecs = nsecs;
+    result.m_rate = rate;
+    result.m_unit = unit;
+    m_results.push_back(result);
+}
+
+bool BenchResults::writeJson(const QString& fileName, const QJsonObject& parameters) const
+{
+    QJsonArray results;
+
+    for (std::vector<Result>::const_iterator it = m_results.begin(); it != m_results.end(); ++it)
+    {
+        QJsonObject result;
+        result.insert("test", it->m_test);
+        result.insert("scenario", it->m_scenario);
+        result.insert("isa", it->m_isa);
+        result.insert("nsecs", it->m_nsecs);
+        result.insert("rate", it->m_rate);
+        result.insert("unit", it->m_unit);
+        results.append(result);
+    }
+
+    QJsonObject root(parameters);
+    root.insert("results", results);
+
+    QFile file;
+    bool opened;
+
+    if (fileName == "-")
+    {
+        opened = file.open(stdout, QIODevice::WriteOnly);
+    }
+    else
+    {
+        file.setFileName(fileName);
+        opened = file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    }
+
+    if (!opened)
+    {
+        qWarning("BenchResults::writeJson: cannot open %s", qPrintable(fileName));
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    file.close();
+    return true;
+}
+
+int BenchResults::compare(const QString& baselineFileName, float tolerance) const
+{
+    QFile file(baselineFileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("BenchResults::compare: cannot open %s", qPrintable(baselineFileName));
+        return -1;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+
+    if (!doc.isObject() || !doc.object().value("results").isArray())
+    {
+        qWarning("BenchResults::compare: %s is not a benchmark results file: %s",
+            qPrintable(baselineFileName), qPrintable(error.errorString()));
+        return -1;
+    }
+
+    QMap<QString, double> baseline;
+    QJsonArray baselineResults = doc.object().value("results").toArray();
+
+    for (QJsonArray::const_iterator it = baselineResults.begin(); it != baselineResults.end(); ++it)
+    {
+        QJsonObject result = (*it).toObject();
+        baseline.insert(getKey(result.value("test").toString(), result.value("scenario").toString(), result.value("isa").toString()),
+            result.value("rate").toDouble());
+    }
+
+    int nbRegressions = 0;
+    int nbCompared = 0;
+
+    for (std::vector<Result>::const_iterator it = m_results.begin(); it != m_results.end(); ++it)
+    {
+        QMap<QString, double>::const_iterator baseIt = baseline.find(getKey(it->m_test, it->m_scenario, it->m_isa));
+        QString line = QString("BenchResults::compare: %1 %2 [%3]: ").arg(it->m_test).arg(it->m_scenario).arg(it->m_isa);
+
+        if ((baseIt == baseline.end()) || (baseIt.value() <= 0.0))
+        {
+            qInfo("%s", qPrintable(line + QString("%1 %2 - not in baseline").arg(it->m_rate, 0, 'f', 1).arg(it->m_unit)));
+            continue;
+        }
+
+        double change = ((it->m_rate / baseIt.value()) - 1.0) * 100.0;
+        bool regression = change < -tolerance;
+        nbRegressions += regression ? 1 : 0;
+        nbCompared++;
+        qInfo("%s", qPrintable(line + QString("%1 -> %2 %3 (%4%5%)%6")
+            .arg(baseIt.value(), 0, 'f', 1)
+            .arg(it->m_rate, 0, 'f', 1)
+            .arg(it->m_unit)
+            .arg(change < 0.0 ? "" : "+")
+            .arg(change, 0, 'f', 1)
+            .arg(regression ? " REGRESSION" : "")));
+    }
+
+    qInfo("BenchResults::compare: %d results compared with %s: %d regression(s) beyond %.1f%%",
+        nbCompared, qPrintable(baselineFileName), nbRegressions, tolerance);
+
+    return nbRegressions;
+}
+
+QString BenchResults::getKey(const QString& test, const QString& scenario, const QString& isa)
+{
+    return test + "|" + scenario + "|" + isa;
+}
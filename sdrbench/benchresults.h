@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2019 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHRESULTS_H_
+#define SDRBENCH_BENCHRESULTS_H_
+
+#include <vector>
+
+#include <QString>
+#include <QJsonObject>
+
+/**
+ * Results of a benchmark run. They can be saved as JSON and compared to the JSON results of a
+ * previous run taken as the baseline. Every result is a throughput so higher is better.
+ */
+class BenchResults
+{
+public:
+    struct Result
+    {
+        QString m_test;     //!< test name as given with the --test option
+        QString m_scenario; //!< variant of the test
+        QString m_isa;      //!< SIMD instruction set used by the run
+        qint64 m_nsecs;     //!< total run time in nanoseconds
+        double m_rate;      //!< throughput
+        QString m_unit;     //!< unit of the throughput
+    };
+
+    void add(const QString& test, const QString& scenario, const QString& isa, qint64 nsecs, double rate, const QString& unit);
+    const std::vector<Result>& getResults() const { return m_results; }
+
+    /** Write the parameters of the run and the results in JSON format. "-" writes to the standard output */
+    bool writeJson(const QString& fileName, const QJsonObject& parameters) const;
+    /**
+     * Compare the results with the results of a baseline JSON file. A result with a throughput lower than the
+     * baseline by more than tolerance percent is a regression. Returns the number of regressions or -1 if the
+     * baseline could not be read.
+     */
+    int compare(const QString& baselineFileName, float tolerance) const;
+
+private:
+    std::vector<Result> m_results;
+
+    static QString getKey(const QString& test, const QString& scenario, const QString& isa);
+};
+
+#endif // SDRBENCH_BENCHRESULTS_H_
@@ -19,9 +19,51 @@
 
 #include <QDebug>
 #include <QElapsedTimer>
+#include <QCoreApplication>
+#include <QSysInfo>
+#include <QJsonObject>
 
+#include "dsp/nullsink.h"
+#include "dsp/basebandsamplesource.h"
+#include "dsp/dspcommands.h"
+#include "dsp/hbfilterkernels.h"
+#include "dsp/spectrumkernels.h"
+#include "dsp/goertzelbank.h"
+#include "dsp/ctcssdetector.h"
+#include "dsp/afsquelch.h"
+#include "dsp/fftengine.h"
+#include "dsp/fftwindow.h"
+#include "dsp/kissengine.h"
+#ifdef USE_FFTW
+#include "dsp/fftwengine.h"
+#endif
+#include "dsp/fftfilt.h"
+#include "dsp/interpolator.h"
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "dsp/phasediscri.h"
+#include "util/movingaverage2d.h"
+
+#ifdef BENCH_DEMODS
+#include "benchdemods.h"
+#endif
 #include "mainbench.h"
 
+/** Stands for the modulator in the up channelizer test */
+class BenchSampleSource : public BasebandSampleSource
+{
+public:
+    BenchSampleSource() : m_sample(SDR_TX_SCALEF/2, 0) {}
+    virtual void start() {}
+    virtual void stop() {}
+    virtual void pull(Sample& sample) { sample = m_sample; }
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples) { std::fill(begin, begin + nbSamples, m_sample); }
+    virtual bool handleMessage(const Message& cmd) { (void) cmd; return true; }
+
+private:
+    Sample m_sample;
+};
+
 MainBench *MainBench::m_instance = 0;
 
 MainBench::MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser, QObject *parent) :
@@ -29,7 +71,9 @@ MainBench::MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser
     m_logger(logger),
     m_parser(parser),
     m_uniform_distribution_f(-1.0, 1.0),
-    m_uniform_distribution_s16(-2048, 2047)
+    m_uniform_distribution_s16(-2048, 2047),
+    m_benchSink(0.0f),
+    m_exitCode(0)
 {
     qDebug() << "MainBench::MainBench: start";
     m_instance = this;
@@ -48,23 +92,137 @@ void MainBench::run()
         << " repet: " << m_parser.getRepetition()
         << " log2f: " << m_parser.getLog2Factor();
 
-    if (m_parser.getTestType() == ParserBench::TestDecimatorsII) {
+    if (m_parser.getTestType() == ParserBench::TestAll)
+    {
+        for (int testType = 0; testType < (int) ParserBench::TestAll; testType++) {
+            runTests((ParserBench::TestType) testType);
+        }
+    }
+    else
+    {
+        runTests(m_parser.getTestType());
+    }
+
+    qDebug() << "MainBench::run: end: " << m_benchSink;
+    saveResults();
+    emit finished();
+}
+
+void MainBench::runTests(ParserBench::TestType testType)
+{
+    m_testName = ParserBench::getTestName(testType);
+
+    if (!isISADependent(testType))
+    {
+        m_isaName = HBFilterKernels::getISAName(HBFilterKernels::getDetectedISA());
+        runTest(testType);
+        return;
+    }
+
+    // run the test for every SIMD instruction set supported by this CPU
+    for (int isa = 0; isa < (int) HBFilterKernels::ISAEnd; isa++)
+    {
+        if (!HBFilterKernels::setISA((HBFilterKernels::ISA) isa)) {
+            continue;
+        }
+
+        SpectrumKernels::setISA((HBFilterKernels::ISA) isa);
+        GoertzelBank::setISA((HBFilterKernels::ISA) isa);
+
+        m_isaName = HBFilterKernels::getISAName((HBFilterKernels::ISA) isa);
+        qDebug() << "MainBench::runTests: instruction set: " << m_isaName;
+        runTest(testType);
+    }
+
+    HBFilterKernels::setISA(HBFilterKernels::getDetectedISA());
+    SpectrumKernels::setISA(HBFilterKernels::getDetectedISA());
+    GoertzelBank::setISA(HBFilterKernels::getDetectedISA());
+}
+
+/** Tests of code using the run time dispatched SIMD kernels are run for each instruction set */
+bool MainBench::isISADependent(ParserBench::TestType testType)
+{
+    switch (testType)
+    {
+    case ParserBench::TestDecimatorsII:
+    case ParserBench::TestDecimatorsIF:
+    case ParserBench::TestDecimatorsFI:
+    case ParserBench::TestDecimatorsFF:
+    case ParserBench::TestDecimatorsInfII:
+    case ParserBench::TestDecimatorsSupII:
+    case ParserBench::TestDownChannelizer:
+    case ParserBench::TestSpectrum:
+    case ParserBench::TestGoertzel:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void MainBench::runTest(ParserBench::TestType testType)
+{
+    if (testType == ParserBench::TestDecimatorsII) {
         testDecimateII();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsInfII) {
+    } else if (testType == ParserBench::TestDecimatorsInfII) {
         testDecimateII(ParserBench::TestDecimatorsInfII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsSupII) {
+    } else if (testType == ParserBench::TestDecimatorsSupII) {
         testDecimateII(ParserBench::TestDecimatorsSupII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsIF) {
+    } else if (testType == ParserBench::TestDecimatorsIF) {
         testDecimateIF();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFI) {
+    } else if (testType == ParserBench::TestDecimatorsFI) {
         testDecimateFI();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFF) {
+    } else if (testType == ParserBench::TestDecimatorsFF) {
         testDecimateFF();
+    } else if (testType == ParserBench::TestDownChannelizer) {
+        testDownChannelizer();
+    } else if (testType == ParserBench::TestSpectrum) {
+        testSpectrum();
+    } else if (testType == ParserBench::TestGoertzel) {
+        testGoertzel();
+    } else if (testType == ParserBench::TestUpChannelizer) {
+        testUpChannelizer();
+    } else if (testType == ParserBench::TestInterpolator) {
+        testInterpolator();
+    } else if (testType == ParserBench::TestFFTFilt) {
+        testFFTFilt();
+    } else if (testType == ParserBench::TestFFT) {
+        testFFT();
+    } else if (testType == ParserBench::TestNCO) {
+        testNCO();
+    } else if (testType == ParserBench::TestPhaseDiscri) {
+        testPhaseDiscri();
+    } else if (testType == ParserBench::TestDemod) {
+        testDemod();
     } else {
-        qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
+        qDebug() << "MainBench::runTest: unknown test type: " << testType;
     }
+}
 
-    emit finished();
+void MainBench::saveResults()
+{
+    if (!m_parser.getJsonFile().isEmpty())
+    {
+        QJsonObject parameters;
+        parameters.insert("application", QCoreApplication::applicationName());
+        parameters.insert("version", QCoreApplication::applicationVersion());
+        parameters.insert("architecture", QSysInfo::currentCpuArchitecture());
+        parameters.insert("test", m_parser.getTestStr());
+        parameters.insert("nbSamples", (qint64) m_parser.getNbSamples());
+        parameters.insert("repetition", (qint64) m_parser.getRepetition());
+        parameters.insert("log2Factor", (qint64) m_parser.getLog2Factor());
+        parameters.insert("rxSampleSize", SDR_RX_SAMP_SZ);
+
+        if (!m_results.writeJson(m_parser.getJsonFile(), parameters)) {
+            m_exitCode = 1;
+        }
+    }
+
+    if (!m_parser.getCompareFile().isEmpty())
+    {
+        if (m_results.compare(m_parser.getCompareFile(), m_parser.getTolerance()) != 0) { // regressions or no baseline
+            m_exitCode = 1;
+        }
+    }
 }
 
 void MainBench::testDecimateII(ParserBench::TestType testType)
@@ -104,7 +262,7 @@ void MainBench::testDecimateII(ParserBench::TestType testType)
         }
     }
 
-    printResults("MainBench::testDecimateII", nsecs);
+    printResults(QString("log2 %1").arg(m_parser.getLog2Factor()), nsecs);
 
     qDebug() << "MainBench::testDecimateII: cleanup test data";
     delete[] buf;
@@ -131,7 +289,7 @@ void MainBench::testDecimateIF()
         nsecs += timer.nsecsElapsed();
     }
 
-    printResults("MainBench::testDecimateIF", nsecs);
+    printResults(QString("log2 %1").arg(m_parser.getLog2Factor()), nsecs);
 
     qDebug() << "MainBench::testDecimateIF: cleanup test data";
     delete[] buf;
@@ -158,7 +316,7 @@ void MainBench::testDecimateFI()
         nsecs += timer.nsecsElapsed();
     }
 
-    printResults("MainBench::testDecimateFI", nsecs);
+    printResults(QString("log2 %1").arg(m_parser.getLog2Factor()), nsecs);
 
     qDebug() << "MainBench::testDecimateFI: cleanup test data";
     delete[] buf;
@@ -185,12 +343,656 @@ void MainBench::testDecimateFF()
         nsecs += timer.nsecsElapsed();
     }
 
-    printResults("MainBench::testDecimateFF", nsecs);
+    printResults(QString("log2 %1").arg(m_parser.getLog2Factor()), nsecs);
 
     qDebug() << "MainBench::testDecimateFF: cleanup test data";
     delete[] buf;
 }
 
+void MainBench::testDownChannelizer()
+{
+    QElapsedTimer timer;
+    int sampleRate = 3072000; // divisible by 2^6
+
+    qDebug() << "MainBench::testDownChannelizer: create test data";
+
+    SampleVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (SampleVector::iterator it = buf.begin(); it != buf.end(); ++it)
+    {
+        it->m_real = my_rand();
+        it->m_imag = my_rand();
+    }
+
+    qDebug() << "MainBench::testDownChannelizer: run test";
+
+    // each depth yields log2Decim center stages
+    for (int log2Decim = 0; log2Decim <= m_maxLog2Channelizer; log2Decim++)
+    {
+        qint64 nsecsSampleMajor = 0;
+        qint64 nsecsStageMajor = 0;
+        NullSink nullSink;
+        DownChannelizer channelizer(&nullSink);
+        DSPSignalNotification notif(sampleRate, 0);
+        channelizer.handleMessage(notif);
+        DSPConfigureChannelizer configure(sampleRate / (1<<log2Decim), 0);
+        channelizer.handleMessage(configure);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            channelizer.setBlockProcessing(false);
+            timer.start();
+            downChannelize(channelizer, buf);
+            nsecsSampleMajor += timer.nsecsElapsed();
+
+            channelizer.setBlockProcessing(true);
+            timer.start();
+            downChannelize(channelizer, buf);
+            nsecsStageMajor += timer.nsecsElapsed();
+        }
+
+        printResults(QString("sample major log2 %1").arg(log2Decim), nsecsSampleMajor);
+        printResults(QString("stage major log2 %1").arg(log2Decim), nsecsStageMajor);
+    }
+}
+
+void MainBench::testUpChannelizer()
+{
+    QElapsedTimer timer;
+    int sampleRate = 3072000; // divisible by 2^6
+    SampleVector buf(m_parser.getNbSamples());
+
+    qDebug() << "MainBench::testUpChannelizer: run test";
+
+    // each depth yields log2Interp center stages. Throughput is given in output samples.
+    for (int log2Interp = 0; log2Interp <= m_maxLog2Channelizer; log2Interp++)
+    {
+        qint64 nsecs = 0;
+        BenchSampleSource sampleSource;
+        UpChannelizer channelizer(&sampleSource);
+        DSPSignalNotification notif(sampleRate, 0);
+        channelizer.handleMessage(notif);
+        DSPConfigureChannelizer configure(sampleRate / (1<<log2Interp), 0);
+        channelizer.handleMessage(configure);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            upChannelize(channelizer, buf);
+            nsecs += timer.nsecsElapsed();
+        }
+
+        m_benchSink += buf.back().m_real;
+        printResults(QString("log2 %1").arg(log2Interp), nsecs);
+    }
+}
+
+void MainBench::testInterpolator()
+{
+    QElapsedTimer timer;
+    std::vector<Complex> buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    Complex ci, sum(0.0f, 0.0f);
+
+    qDebug() << "MainBench::testInterpolator: create test data";
+
+    for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = Complex(my_rand(), my_rand());
+    }
+
+    qDebug() << "MainBench::testInterpolator: run test";
+
+    // decimation as done by the demodulators from the channel rate to the 48 kS/s audio rate
+    const int decimInputRates[3] = {96000, 192000, 384000};
+
+    for (int r = 0; r < 3; r++)
+    {
+        qint64 nsecs = 0;
+        Interpolator interpolator;
+        interpolator.create(16, decimInputRates[r], 12500 / 2.2f);
+        Real distance = decimInputRates[r] / 48000.0f;
+        Real distanceRemain = distance;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it)
+            {
+                if (interpolator.decimate(&distanceRemain, *it, &ci))
+                {
+                    sum += ci;
+                    distanceRemain += distance;
+                }
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("decimate %1k to 48k").arg(decimInputRates[r] / 1000), nsecs);
+    }
+
+    // interpolation as done by the AM demodulator when the channel rate is lower than the audio rate
+    const int interpInputRates[2] = {24000, 32000};
+
+    for (int r = 0; r < 2; r++)
+    {
+        qint64 nsecs = 0;
+        Interpolator interpolator;
+        interpolator.create(16, interpInputRates[r], 5000 / 2.2f);
+        Real distance = interpInputRates[r] / 48000.0f;
+        Real distanceRemain = 0.0f;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it)
+            {
+                sum += ci;
+
+                while (interpolator.interpolate(&distanceRemain, *it, &ci)) {
+                    sum += ci;
+                }
+
+                distanceRemain += distance;
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("interpolate %1k to 48k").arg(interpInputRates[r] / 1000), nsecs);
+    }
+
+    m_benchSink += sum.real();
+}
+
+void MainBench::testFFTFilt()
+{
+    QElapsedTimer timer;
+    std::vector<Complex> buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    fftfilt::cmplx *out;
+    float *rout;
+    int nbOut = 0;
+
+    qDebug() << "MainBench::testFFTFilt: create test data";
+
+    for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = Complex(my_rand(), my_rand());
+    }
+
+    qDebug() << "MainBench::testFFTFilt: run test";
+
+    // filters with the bandwidths used by the SSB and AM demodulators at 48 kS/s
+    for (int fftLen = 256; fftLen <= 4096; fftLen *= 4)
+    {
+        qint64 nsecsFilt = 0, nsecsSSB = 0, nsecsDSB = 0, nsecsAsym = 0, nsecsRealSSB = 0, nsecsRealDSB = 0;
+        fftfilt bandpassFilter(-3000.0f / 48000.0f, 3000.0f / 48000.0f, fftLen);
+        fftfilt ssbFilter(300.0f / 48000.0f, 3000.0f / 48000.0f, fftLen);
+        fftfilt dsbFilter(6000.0f / 48000.0f, 2*fftLen);
+        fftfilt asymFilter(-500.0f / 48000.0f, 3000.0f / 48000.0f, fftLen);
+        rfftfilt realSSBFilter(300.0f / 48000.0f, 3000.0f / 48000.0f, fftLen);
+        rfftfilt realDSBFilter(6000.0f / 48000.0f, 2*fftLen);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += bandpassFilter.runFilt(*it, &out);
+            }
+
+            nsecsFilt += timer.nsecsElapsed();
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += ssbFilter.runSSB(*it, &out, true);
+            }
+
+            nsecsSSB += timer.nsecsElapsed();
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += dsbFilter.runDSB(*it, &out);
+            }
+
+            nsecsDSB += timer.nsecsElapsed();
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += asymFilter.runAsym(*it, &out, true);
+            }
+
+            nsecsAsym += timer.nsecsElapsed();
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += realSSBFilter.runSSB(it->real(), &out, true);
+            }
+
+            nsecsRealSSB += timer.nsecsElapsed();
+            timer.start();
+
+            for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+                nbOut += realDSBFilter.runDSB(it->real(), &rout);
+            }
+
+            nsecsRealDSB += timer.nsecsElapsed();
+        }
+
+        printResults(QString("runFilt %1").arg(fftLen), nsecsFilt);
+        printResults(QString("runSSB %1").arg(fftLen), nsecsSSB);
+        printResults(QString("runDSB %1").arg(2*fftLen), nsecsDSB);
+        printResults(QString("runAsym %1").arg(fftLen), nsecsAsym);
+        printResults(QString("real runSSB %1").arg(fftLen), nsecsRealSSB);
+        printResults(QString("real runDSB %1").arg(2*fftLen), nsecsRealDSB);
+    }
+
+    m_benchSink += nbOut;
+}
+
+void MainBench::testFFT()
+{
+    QElapsedTimer timer;
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    std::vector<std::pair<QString, FFTEngine*> > engines;
+    engines.push_back(std::pair<QString, FFTEngine*>("kiss", new KissEngine));
+#ifdef USE_FFTW
+    engines.push_back(std::pair<QString, FFTEngine*>("fftw", new FFTWEngine));
+#endif
+
+    qDebug() << "MainBench::testFFT: run test";
+
+    for (std::vector<std::pair<QString, FFTEngine*> >::iterator engine = engines.begin(); engine != engines.end(); ++engine)
+    {
+        FFTEngine *fft = engine->second;
+
+        for (int fftSize = 64; fftSize <= 16384; fftSize *= 2)
+        {
+            qint64 nsecsComplex = 0;
+            qint64 nsecsReal = 0;
+            int nbFFT = std::max(1, (int) (m_parser.getNbSamples() / fftSize)); // same number of samples for all sizes
+
+            fft->configure(fftSize, false);
+            std::generate(fft->in(), fft->in() + fftSize, [&my_rand]() { return Complex(my_rand(), my_rand()); });
+
+            for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+            {
+                timer.start();
+
+                for (int n = 0; n < nbFFT; n++) {
+                    fft->transform();
+                }
+
+                nsecsComplex += timer.nsecsElapsed();
+            }
+
+            m_benchSink += fft->out()[0].real();
+            fft->configureReal(fftSize, false);
+            std::generate(fft->realIn(), fft->realIn() + fftSize, my_rand);
+
+            for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+            {
+                timer.start();
+
+                for (int n = 0; n < nbFFT; n++) {
+                    fft->transform();
+                }
+
+                nsecsReal += timer.nsecsElapsed();
+            }
+
+            m_benchSink += fft->out()[0].real();
+            printResults(QString("%1 complex %2").arg(engine->first).arg(fftSize), nsecsComplex, nbFFT * (double) m_parser.getRepetition(), "FFT/s");
+            printResults(QString("%1 real %2").arg(engine->first).arg(fftSize), nsecsReal, nbFFT * (double) m_parser.getRepetition(), "FFT/s");
+        }
+
+        delete fft;
+    }
+}
+
+void MainBench::testNCO()
+{
+    QElapsedTimer timer;
+    std::vector<Complex> buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    qint64 nsecsNCO = 0, nsecsNCOF = 0, nsecsNCOMix = 0, nsecsNCOFMix = 0;
+    Complex sum(0.0f, 0.0f);
+    NCO nco;
+    NCOF ncof;
+    nco.setFreq(10000.0f, 48000.0f);
+    ncof.setFreq(10000.0f, 48000.0f);
+
+    qDebug() << "MainBench::testNCO: create test data";
+
+    for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = Complex(my_rand(), my_rand());
+    }
+
+    qDebug() << "MainBench::testNCO: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (unsigned int s = 0; s < buf.size(); s++) {
+            sum += nco.nextIQ();
+        }
+
+        nsecsNCO += timer.nsecsElapsed();
+        timer.start();
+
+        for (unsigned int s = 0; s < buf.size(); s++) {
+            sum += ncof.nextIQ();
+        }
+
+        nsecsNCOF += timer.nsecsElapsed();
+        timer.start();
+
+        for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+            sum += *it * nco.nextIQ();
+        }
+
+        nsecsNCOMix += timer.nsecsElapsed();
+        timer.start();
+
+        for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+            sum += *it * ncof.nextIQ();
+        }
+
+        nsecsNCOFMix += timer.nsecsElapsed();
+    }
+
+    m_benchSink += sum.real();
+    printResults("NCO nextIQ", nsecsNCO);
+    printResults("NCOF nextIQ", nsecsNCOF);
+    printResults("NCO mix", nsecsNCOMix);
+    printResults("NCOF mix", nsecsNCOFMix);
+}
+
+void MainBench::testPhaseDiscri()
+{
+    QElapsedTimer timer;
+    SampleVector signal(m_parser.getNbSamples());
+    std::vector<Complex> buf(m_parser.getNbSamples());
+    qint64 nsecs = 0, nsecsDelta = 0, nsecs2 = 0;
+    PhaseDiscriminators phaseDiscri;
+    double magsq;
+    Real fmDev, sum = 0.0f;
+    phaseDiscri.setFMScaling(48000.0f / 5000.0f);
+
+    qDebug() << "MainBench::testPhaseDiscri: create test data";
+
+    createSignal(signal, 48000, 0.0f, 0.0f, 5000.0f);
+
+    for (unsigned int s = 0; s < buf.size(); s++) {
+        buf[s] = Complex(signal[s].real(), signal[s].imag());
+    }
+
+    qDebug() << "MainBench::testPhaseDiscri: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        phaseDiscri.reset();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+            sum += phaseDiscri.phaseDiscriminator(*it);
+        }
+
+        nsecs += timer.nsecsElapsed();
+        phaseDiscri.reset();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+            sum += phaseDiscri.phaseDiscriminatorDelta(*it, magsq, fmDev);
+        }
+
+        nsecsDelta += timer.nsecsElapsed();
+        phaseDiscri.reset();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = buf.begin(); it != buf.end(); ++it) {
+            sum += phaseDiscri.phaseDiscriminator2(*it);
+        }
+
+        nsecs2 += timer.nsecsElapsed();
+    }
+
+    m_benchSink += sum;
+    printResults("phaseDiscriminator", nsecs);
+    printResults("phaseDiscriminatorDelta", nsecsDelta);
+    printResults("phaseDiscriminator2", nsecs2);
+}
+
+void MainBench::testDemod()
+{
+#ifdef BENCH_DEMODS
+    QElapsedTimer timer;
+    SampleVector buf(m_parser.getNbSamples());
+    BenchDemods benchDemods;
+
+    for (int d = 0; BenchDemods::m_names[d]; d++)
+    {
+        QString name(BenchDemods::m_names[d]);
+        int inputSampleRate = BenchDemods::getInputSampleRate(name);
+        BasebandSampleSink *demod = benchDemods.create(name);
+        qint64 nsecs = 0;
+
+        qDebug() << "MainBench::testDemod: create test data for " << name;
+
+        // 1 kHz tone modulation 10 kHz above the center
+        if (name == "am") {
+            createSignal(buf, inputSampleRate, 10000.0f, 0.8f, 0.0f);
+        } else if (name == "ssb") {
+            createSignal(buf, inputSampleRate, 11000.0f, 0.0f, 0.0f);
+        } else if (name == "nfm") {
+            createSignal(buf, inputSampleRate, 10000.0f, 0.0f, 2000.0f);
+        } else {
+            createSignal(buf, inputSampleRate, 10000.0f, 0.0f, 75000.0f);
+        }
+
+        qDebug() << "MainBench::testDemod: run test for " << name;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            SampleVector::const_iterator begin = buf.begin();
+
+            while (begin != buf.end())
+            {
+                SampleVector::const_iterator end = begin + std::min((std::size_t) m_channelizerBlockSize, (std::size_t) (buf.end() - begin));
+                demod->feed(begin, end, false);
+                begin = end;
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        demod->stop();
+
+        // a channel that is not running returns from feed immediately
+        if (BenchDemods::getMagSqPeak(name, demod) > 0.0) {
+            printResults(QString("%1 %2k").arg(name).arg(inputSampleRate / 1000), nsecs);
+        } else {
+            qCritical("MainBench::testDemod: %s: no sample was processed", qPrintable(name));
+            m_exitCode = 1;
+        }
+
+        delete demod;
+    }
+#else
+    qWarning("MainBench::testDemod: the demodulator plugins are built with the server only (BUILD_SERVER)");
+#endif
+}
+
+void MainBench::testSpectrum()
+{
+    QElapsedTimer timer;
+    FFTEngine *fft = FFTEngine::create();
+    FFTWindow window;
+    MovingAverage2D<Real> movingAverage;
+    std::vector<Complex> buf(m_parser.getNbSamples());
+    std::vector<Real> powerSpectrum;
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    qDebug() << "MainBench::testSpectrum: create test data";
+
+    for (std::vector<Complex>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = Complex(my_rand(), my_rand());
+    }
+
+    qDebug() << "MainBench::testSpectrum: run test";
+
+    // same processing as SpectrumVis with moving average and dB scale without overlap
+    for (int fftSize = 64; fftSize <= 4096; fftSize *= 2)
+    {
+        qint64 nsecs = 0;
+        int nbSpectra = 0;
+        int halfSize = fftSize / 2;
+        Real ofs = 20.0f * log10f(1.0f / fftSize);
+        Real mult = 10.0f / log2f(10.0f);
+        fft->configure(fftSize, false);
+        window.create(FFTWindow::BlackmanHarris, fftSize);
+        movingAverage.resize(fftSize, m_spectrumAverageNb);
+        powerSpectrum.resize(fftSize);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            for (unsigned int s = 0; s + fftSize <= buf.size(); s += fftSize)
+            {
+                window.apply(&buf[s], fft->in());
+                fft->transform();
+                const Real *fftOut = reinterpret_cast<const Real*>(fft->out());
+                SpectrumKernels::magSq(fftOut + 2*halfSize, &powerSpectrum[0], halfSize);
+                SpectrumKernels::magSq(fftOut, &powerSpectrum[halfSize], halfSize);
+                movingAverage.storeAndGetAvg(&powerSpectrum[0], &powerSpectrum[0], 0, fftSize);
+                movingAverage.nextAverage();
+                SpectrumKernels::powerToDB(&powerSpectrum[0], &powerSpectrum[0], fftSize, mult, ofs);
+                nbSpectra++;
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("FFT size %1").arg(fftSize), nsecs, nbSpectra, "spectra/s");
+    }
+
+    delete fft;
+}
+
+void MainBench::testGoertzel()
+{
+    QElapsedTimer timer;
+    qint64 nsecsCTCSSSample = 0;
+    qint64 nsecsCTCSSBatch = 0;
+    qint64 nsecsAFSquelchSample = 0;
+    qint64 nsecsAFSquelchBatch = 0;
+    std::vector<Real> buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    // same settings as in the NFM demodulator at 48 kS/s audio sample rate
+    const int audioSampleRate = 48000;
+    const double afSqTones[2] = {1000.0, 6000.0};
+    CTCSSDetector ctcssDetector;
+    AFSquelch afSquelch;
+    ctcssDetector.setCoefficients(audioSampleRate/16, audioSampleRate/8);
+    afSquelch.setCoefficients(audioSampleRate/2000, 600, audioSampleRate, 200, 0, afSqTones);
+
+    qDebug() << "MainBench::testGoertzel: create test data";
+
+    for (std::vector<Real>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = my_rand();
+    }
+
+    qDebug() << "MainBench::testGoertzel: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        ctcssDetector.reset();
+        timer.start();
+
+        for (std::vector<Real>::iterator it = buf.begin(); it != buf.end(); ++it) {
+            ctcssDetector.analyze(&(*it));
+        }
+
+        nsecsCTCSSSample += timer.nsecsElapsed();
+        ctcssDetector.reset();
+        timer.start();
+
+        for (unsigned int s = 0; s < buf.size(); s += m_goertzelBlockSize) {
+            ctcssDetector.analyze(&buf[s], std::min((std::size_t) m_goertzelBlockSize, buf.size() - s));
+        }
+
+        nsecsCTCSSBatch += timer.nsecsElapsed();
+        afSquelch.reset();
+        timer.start();
+
+        for (std::vector<Real>::iterator it = buf.begin(); it != buf.end(); ++it) {
+            afSquelch.analyze((double) *it);
+        }
+
+        nsecsAFSquelchSample += timer.nsecsElapsed();
+        afSquelch.reset();
+        timer.start();
+
+        for (unsigned int s = 0; s < buf.size(); s += m_goertzelBlockSize) {
+            afSquelch.analyze(&buf[s], std::min((std::size_t) m_goertzelBlockSize, buf.size() - s));
+        }
+
+        nsecsAFSquelchBatch += timer.nsecsElapsed();
+    }
+
+    printResults(QString("CTCSS %1 tones sample by sample").arg(ctcssDetector.getNTones()), nsecsCTCSSSample);
+    printResults(QString("CTCSS %1 tones batch").arg(ctcssDetector.getNTones()), nsecsCTCSSBatch);
+    printResults("AF squelch sample by sample", nsecsAFSquelchSample);
+    printResults("AF squelch batch", nsecsAFSquelchBatch);
+}
+
+void MainBench::downChannelize(DownChannelizer& channelizer, const SampleVector& buf)
+{
+    SampleVector::const_iterator begin = buf.begin();
+
+    while (begin != buf.end())
+    {
+        SampleVector::const_iterator end = begin + std::min((std::size_t) m_channelizerBlockSize, (std::size_t) (buf.end() - begin));
+        channelizer.feed(begin, end, false);
+        begin = end;
+    }
+}
+
+void MainBench::upChannelize(UpChannelizer& channelizer, SampleVector& buf)
+{
+    SampleVector::iterator begin = buf.begin();
+
+    while (begin != buf.end())
+    {
+        unsigned int nbSamples = std::min((std::size_t) m_channelizerBlockSize, (std::size_t) (buf.end() - begin));
+        channelizer.pull(begin, nbSamples);
+        begin += nbSamples;
+    }
+}
+
+/** Carrier at offset Hz modulated by a 1 kHz tone in amplitude (amDepth) and/or frequency (fmDeviation in Hz) with some noise */
+void MainBench::createSignal(SampleVector& buf, int sampleRate, Real offset, Real amDepth, Real fmDeviation)
+{
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    double phase = 0.0;
+
+    for (unsigned int s = 0; s < buf.size(); s++)
+    {
+        double tone = sin((2.0 * M_PI * 1000.0 * s) / sampleRate);
+        phase += (2.0 * M_PI * (offset + fmDeviation * tone)) / sampleRate;
+        phase = phase > M_PI ? phase - 2.0 * M_PI : phase;
+        Real amplitude = 0.3f * (1.0f + amDepth * tone);
+        buf[s].m_real = (amplitude * cos(phase) + 0.01f * my_rand()) * SDR_RX_SCALEF;
+        buf[s].m_imag = (amplitude * sin(phase) + 0.01f * my_rand()) * SDR_RX_SCALEF;
+    }
+}
+
 void MainBench::decimateII(const qint16* buf, int len)
 {
     SampleVector::iterator it = m_convertBuffer.begin();
@@ -383,10 +1185,17 @@ void MainBench::decimateFF(const float *buf, int len)
     }
 }
 
-void MainBench::printResults(const QString& prefix, qint64 nsecs)
+void MainBench::printResults(const QString& scenario, qint64 nsecs)
+{
+    printResults(scenario, nsecs, (m_parser.getNbSamples() * (double) m_parser.getRepetition()) / 1000.0, "kS/s");
+}
+
+void MainBench::printResults(const QString& scenario, qint64 nsecs, double nbItems, const QString& unit)
 {
-    double ratekSs = (m_parser.getNbSamples()*m_parser.getRepetition() / (double) nsecs) * 1e6;
+    double rate = nsecs == 0 ? 0.0 : (nbItems / (double) nsecs) * 1e9;
     QDebug info = qInfo();
     info.noquote();
-    info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
+    info << tr("MainBench::%1 %2 [%3]: ran test in %L4 ns - %5 %6")
+        .arg(m_testName).arg(scenario).arg(m_isaName).arg(nsecs).arg(rate, 0, 'f', 1).arg(unit);
+    m_results.add(m_testName, scenario, m_isaName, nsecs, rate, unit);
 }
@@ -28,7 +28,10 @@
 #include "dsp/decimatorsif.h"
 #include "dsp/decimatorsfi.h"
 #include "dsp/decimatorsff.h"
+#include "dsp/downchannelizer.h"
+#include "dsp/upchannelizer.h"
 #include "parserbench.h"
+#include "benchresults.h"
 
 namespace qtwebapp {
     class LoggerWithFile;
@@ -41,6 +44,8 @@ public:
     explicit MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser, QObject *parent = 0);
     ~MainBench();
 
+    int getExitCode() const { return m_exitCode; } //!< non zero if the results could not be saved or a regression was found
+
 public slots:
     void run();
 
@@ -48,17 +53,40 @@ signals:
     void finished();
 
 private:
+    void runTests(ParserBench::TestType testType);
+    void runTest(ParserBench::TestType testType);
+    void saveResults();
     void testDecimateII(ParserBench::TestType testType = ParserBench::TestDecimatorsII);
     void testDecimateIF();
     void testDecimateFI();
     void testDecimateFF();
+    void testDownChannelizer();
+    void testSpectrum();
+    void testGoertzel();
+    void testUpChannelizer();
+    void testInterpolator();
+    void testFFTFilt();
+    void testFFT();
+    void testNCO();
+    void testPhaseDiscri();
+    void testDemod();
     void decimateII(const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
     void decimateIF(const qint16 *buf, int len);
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
-    void printResults(const QString& prefix, qint64 nsecs);
+    void downChannelize(DownChannelizer& channelizer, const SampleVector& buf);
+    void upChannelize(UpChannelizer& channelizer, SampleVector& buf);
+    void createSignal(SampleVector& buf, int sampleRate, Real offset, Real amDepth, Real fmDeviation);
+    void printResults(const QString& scenario, qint64 nsecs); //!< throughput in kS/s of the test samples
+    void printResults(const QString& scenario, qint64 nsecs, double nbItems, const QString& unit);
+    static bool isISADependent(ParserBench::TestType testType);
+
+    static const unsigned int m_channelizerBlockSize = 16384; //!< Size of blocks fed to the channelizer
+    static const int m_spectrumAverageNb = 10;                //!< Moving average depth of the spectrum test
+    static const int m_goertzelBlockSize = 1024;              //!< Size of blocks fed to the tone detectors in batch mode
+    static const int m_maxLog2Channelizer = 6;                //!< Maximum depth of the channelizer tests
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -73,7 +101,12 @@ private:
     DecimatorsFF m_decimatorsFF;
 
     SampleVector m_convertBuffer;
+    QString m_isaName; //!< Name of the SIMD instruction set used by the half-band kernels in the current run
     FSampleVector m_convertBufferF;
+    QString m_testName; //!< Name of the test being run
+    BenchResults m_results;
+    Real m_benchSink;   //!< Accumulates test outputs so that the tested code is not optimized away
+    int m_exitCode;
 };
 
 #endif // SDRBENCH_MAINBENCH_H_
@@ -22,6 +22,26 @@
 
 #include "parserbench.h"
 
+const char *ParserBench::m_testNames[] = {
+    "decimateii",
+    "decimateif",
+    "decimatefi",
+    "decimateff",
+    "decimateinfii",
+    "decimatesupii",
+    "downchannelizer",
+    "spectrum",
+    "goertzel",
+    "upchannelizer",
+    "interpolator",
+    "fftfilt",
+    "fft",
+    "nco",
+    "phasediscri",
+    "demod",
+    "all"
+};
+
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
         "Test type.",
@@ -38,12 +58,25 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_jsonOption(QStringList() << "j" << "json",
+        "Write the results in JSON format to this file (- for standard output).",
+        "file",
+        ""),
+    m_compareOption(QStringList() << "c" << "compare",
+        "Compare the results with this JSON results file of a previous run.",
+        "file",
+        ""),
+    m_toleranceOption(QStringList() << "tolerance",
+        "Throughput loss in percent beyond which a comparison is reported as a regression.",
+        "percent",
+        "10")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_tolerance = 10.0f;
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -53,6 +86,9 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_jsonOption);
+    m_parser.addOption(m_compareOption);
+    m_parser.addOption(m_toleranceOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,21 +147,30 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // results in JSON and comparison
+
+    m_jsonFile = m_parser.value(m_jsonOption);
+    m_compareFile = m_parser.value(m_compareOption);
+
+    QString toleranceStr = m_parser.value(m_toleranceOption);
+    float tolerance = toleranceStr.toFloat(&ok);
+
+    if (ok && (tolerance >= 0.0f)) {
+        m_tolerance = tolerance;
+    } else {
+        qWarning() << "ParserBench::parse: tolerance invalid. Defaulting to " << m_tolerance;
+    }
 }
 
 ParserBench::TestType ParserBench::getTestType() const
 {
-    if (m_testStr == "decimatefi") {
-        return TestDecimatorsFI;
-    } else if (m_testStr == "decimateff") {
-        return TestDecimatorsFF;
-    } else if (m_testStr == "decimateif") {
-        return TestDecimatorsIF;
-    } else if (m_testStr == "decimateinfii") {
-        return TestDecimatorsInfII;
-    } else if (m_testStr == "decimatesupii") {
-        return TestDecimatorsSupII;
-    } else {
-        return TestDecimatorsII;
+    for (int testType = 0; testType <= (int) TestAll; testType++)
+    {
+        if (m_testStr == m_testNames[testType]) {
+            return (TestType) testType;
+        }
     }
+
+    return TestDecimatorsII;
 }
@@ -32,7 +32,18 @@ public:
         TestDecimatorsFI,
         TestDecimatorsFF,
         TestDecimatorsInfII,
-        TestDecimatorsSupII
+        TestDecimatorsSupII,
+        TestDownChannelizer,
+        TestSpectrum,
+        TestGoertzel,
+        TestUpChannelizer,
+        TestInterpolator,
+        TestFFTFilt,
+        TestFFT,
+        TestNCO,
+        TestPhaseDiscri,
+        TestDemod,
+        TestAll //!< run all the tests above
     } TestType;
 
     ParserBench();
@@ -42,21 +53,32 @@ public:
 
     const QString& getTestStr() const { return m_testStr; }
     TestType getTestType() const;
+    static QString getTestName(TestType testType) { return m_testNames[testType]; }
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    const QString& getJsonFile() const { return m_jsonFile; }
+    const QString& getCompareFile() const { return m_compareFile; }
+    float getTolerance() const { return m_tolerance; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    QString  m_jsonFile;    //!< results are written in this file in JSON format if not empty
+    QString  m_compareFile; //!< results are compared with this JSON file if not empty
+    float    m_tolerance;   //!< throughput loss in percent beyond which a comparison is a regression
 
+    static const char *m_testNames[]; //!< test names in TestType order
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_jsonOption;
+    QCommandLineOption m_compareOption;
+    QCommandLineOption m_toleranceOption;
 };
 
 
@@ -4,9 +4,12 @@
 BasicDeviceSettingsDialog::BasicDeviceSettingsDialog(QWidget *parent) :
     QDialog(parent),
     ui(new Ui::BasicDeviceSettingsDialog),
+    m_fileRecordFormat(0),
     m_hasChanged(false)
 {
     ui->setupUi(this);
+    ui->fileRecordFormatLabel->hide();
+    ui->fileRecordFormat->hide();
     setUseReverseAPI(false);
     setReverseAPIAddress("127.0.0.1");
     setReverseAPIPort(8888);
@@ -47,6 +50,14 @@ void BasicDeviceSettingsDialog::setReverseAPIDeviceIndex(uint16_t deviceIndex)
     ui->reverseAPIDeviceIndex->setText(tr("%1").arg(m_reverseAPIDeviceIndex));
 }
 
+void BasicDeviceSettingsDialog::setFileRecordFormat(int fileRecordFormat)
+{
+    m_fileRecordFormat = fileRecordFormat < 0 ? 0 : fileRecordFormat > 1 ? 1 : fileRecordFormat;
+    ui->fileRecordFormat->setCurrentIndex(m_fileRecordFormat);
+    ui->fileRecordFormatLabel->show();
+    ui->fileRecordFormat->show();
+}
+
 void BasicDeviceSettingsDialog::on_reverseAPI_toggled(bool checked)
 {
     m_useReverseAPI = checked;
@@ -81,6 +92,11 @@ void BasicDeviceSettingsDialog::on_reverseAPIDeviceIndex_editingFinished()
     }
 }
 
+void BasicDeviceSettingsDialog::on_fileRecordFormat_currentIndexChanged(int index)
+{
+    m_fileRecordFormat = index < 0 ? 0 : index;
+}
+
 void BasicDeviceSettingsDialog::accept()
 {
     m_hasChanged = true;
@@ -21,16 +21,19 @@ public:
     const QString& getReverseAPIAddress() const { return m_reverseAPIAddress; }
     uint16_t getReverseAPIPort() const { return m_reverseAPIPort; }
     uint16_t getReverseAPIDeviceIndex() const { return m_reverseAPIDeviceIndex; }
+    int getFileRecordFormat() const { return m_fileRecordFormat; }
     void setUseReverseAPI(bool useReverseAPI);
     void setReverseAPIAddress(const QString& address);
     void setReverseAPIPort(uint16_t port);
     void setReverseAPIDeviceIndex(uint16_t deviceIndex);
+    void setFileRecordFormat(int fileRecordFormat); //!< also shows the record format selection (devices that record)
 
 private slots:
     void on_reverseAPI_toggled(bool checked);
     void on_reverseAPIAddress_editingFinished();
     void on_reverseAPIPort_editingFinished();
     void on_reverseAPIDeviceIndex_editingFinished();
+    void on_fileRecordFormat_currentIndexChanged(int index);
     void accept();
 
 private:
@@ -39,6 +42,7 @@ private:
     QString m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
     uint16_t m_reverseAPIDeviceIndex;
+    int m_fileRecordFormat;
     bool m_hasChanged;
 };
 
@@ -28,10 +28,13 @@ SamplingDeviceControl::SamplingDeviceControl(int tabIndex, bool rxElseTx, QWidge
     m_pluginManager(0),
     m_deviceTabIndex(tabIndex),
     m_rxElseTx(rxElseTx),
-    m_selectedDeviceIndex(-1)
+    m_selectedDeviceIndex(-1),
+    m_selectedDeviceSequence(0),
+    m_selectedDeviceItemIndex(0)
 {
     ui->setupUi(this);
     ui->deviceSelectedText->setText("None");
+    connect(DeviceEnumerator::instance(), SIGNAL(deviceListChanged()), this, SLOT(deviceListChanged()));
 }
 
 SamplingDeviceControl::~SamplingDeviceControl()
@@ -66,17 +69,38 @@ void SamplingDeviceControl::setSelectedDeviceIndex(int index)
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getRxSamplingDevice(index);
         DeviceEnumerator::instance()->changeRxSelection(m_deviceTabIndex, index);
         ui->deviceSelectedText->setText(samplingDevice.displayedName);
+        m_selectedDeviceId = samplingDevice.id;
+        m_selectedDeviceSequence = samplingDevice.sequence;
+        m_selectedDeviceItemIndex = samplingDevice.deviceItemIndex;
     }
     else
     {
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getTxSamplingDevice(index);
         DeviceEnumerator::instance()->changeTxSelection(m_deviceTabIndex, index);
         ui->deviceSelectedText->setText(samplingDevice.displayedName);
+        m_selectedDeviceId = samplingDevice.id;
+        m_selectedDeviceSequence = samplingDevice.sequence;
+        m_selectedDeviceItemIndex = samplingDevice.deviceItemIndex;
     }
 
     m_selectedDeviceIndex = index;
 }
 
+void SamplingDeviceControl::deviceListChanged()
+{
+    if (m_selectedDeviceIndex < 0) {
+        return;
+    }
+
+    int index = m_rxElseTx ?
+        DeviceEnumerator::instance()->getRxSamplingDeviceIndex(m_selectedDeviceId, m_selectedDeviceSequence, m_selectedDeviceItemIndex) :
+        DeviceEnumerator::instance()->getTxSamplingDeviceIndex(m_selectedDeviceId, m_selectedDeviceSequence, m_selectedDeviceItemIndex);
+
+    if (index >= 0) { // the device in use may have moved in the list
+        setSelectedDeviceIndex(index);
+    }
+}
+
 void SamplingDeviceControl::removeSelectedDeviceIndex()
 {
     if (m_rxElseTx)
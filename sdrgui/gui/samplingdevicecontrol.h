@@ -52,6 +52,7 @@ public:
 private slots:
     void on_deviceChange_clicked();
     void on_deviceReload_clicked();
+    void deviceListChanged();
 
 private:
     Ui::SamplingDeviceControl* ui;
@@ -59,6 +60,9 @@ private:
     int m_deviceTabIndex;
     bool m_rxElseTx;
     int m_selectedDeviceIndex;
+    QString m_selectedDeviceId;    //!< identifies the selected device when the devices list changes
+    int m_selectedDeviceSequence;
+    int m_selectedDeviceItemIndex;
 
 signals:
     void changed();
@@ -294,8 +294,10 @@ void MainWindow::addSourceDevice(int deviceIndex)
             m_deviceUIs.back()->m_deviceSourceAPI->getSampleSourcePluginInstanceGUI());
 
 
+    DeviceEnumerator::HardwareLocker hardwareLocker(m_deviceUIs.back()->m_deviceSourceAPI->getSampleSourceId()); // a rescan may be probing the same hardware
     DeviceSampleSource *source = m_deviceUIs.back()->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceInput(
             m_deviceUIs.back()->m_deviceSourceAPI->getSampleSourceId(), m_deviceUIs.back()->m_deviceSourceAPI);
+    hardwareLocker.unlock();
     m_deviceUIs.back()->m_deviceSourceAPI->setSampleSource(source);
     QWidget *gui;
     PluginInstanceGUI *pluginGUI = m_deviceUIs.back()->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceGUI(
@@ -365,8 +367,10 @@ void MainWindow::addSinkDevice()
     m_deviceUIs.back()->m_deviceSinkAPI->getPluginInterface()->deleteSampleSourcePluginInstanceGUI(
             m_deviceUIs.back()->m_deviceSinkAPI->getSampleSinkPluginInstanceGUI());
 
+    DeviceEnumerator::HardwareLocker hardwareLocker(m_deviceUIs.back()->m_deviceSinkAPI->getSampleSinkId()); // a rescan may be probing the same hardware
     DeviceSampleSink *sink = m_deviceUIs.back()->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceOutput(
             m_deviceUIs.back()->m_deviceSinkAPI->getSampleSinkId(), m_deviceUIs.back()->m_deviceSinkAPI);
+    hardwareLocker.unlock();
     m_deviceUIs.back()->m_deviceSinkAPI->setSampleSink(sink);
     QWidget *gui;
     PluginInstanceGUI *pluginUI = m_deviceUIs.back()->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceGUI(
@@ -1551,8 +1555,10 @@ void MainWindow::sampleSourceChanged()
         }
 
         // constructs new GUI and input object
+        DeviceEnumerator::HardwareLocker hardwareLocker(deviceUI->m_deviceSourceAPI->getSampleSourceId()); // a rescan may be probing the same hardware
         DeviceSampleSource *source = deviceUI->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceInput(
                 deviceUI->m_deviceSourceAPI->getSampleSourceId(), deviceUI->m_deviceSourceAPI);
+        hardwareLocker.unlock();
         deviceUI->m_deviceSourceAPI->setSampleSource(source);
         QWidget *gui;
         PluginInstanceGUI *pluginUI = deviceUI->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceGUI(
@@ -1640,8 +1646,10 @@ void MainWindow::sampleSinkChanged()
         }
 
         // constructs new GUI and output object
+        DeviceEnumerator::HardwareLocker hardwareLocker(deviceUI->m_deviceSinkAPI->getSampleSinkId()); // a rescan may be probing the same hardware
         DeviceSampleSink *sink = deviceUI->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceOutput(
                 deviceUI->m_deviceSinkAPI->getSampleSinkId(), deviceUI->m_deviceSinkAPI);
+        hardwareLocker.unlock();
         deviceUI->m_deviceSinkAPI->setSampleSink(sink);
         QWidget *gui;
         PluginInstanceGUI *pluginUI = deviceUI->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceGUI(
@@ -45,7 +45,6 @@ SOURCES += mainwindow.cpp\
         dsp/spectrumscopecombovis.cpp\
         dsp/scopevis.cpp\
         dsp/scopevisxy.cpp\
-        dsp/spectrumvis.cpp\
         gui/aboutdialog.cpp\
         gui/addpresetdialog.cpp\
         gui/basicchannelsettingsdialog.cpp\
@@ -103,7 +102,6 @@ HEADERS  += mainwindow.h\
         dsp/spectrumscopecombovis.h\
         dsp/scopevis.h\
         dsp/scopevisxy.h\
-        dsp/spectrumvis.h\
         gui/aboutdialog.h\
         gui/addpresetdialog.h\
         gui/audiodialog.h\
@@ -288,6 +288,7 @@ int WebAPIAdapterGUI::instanceAudioGet(
     outputDevices->back()->setUdpDecimationFactor((int) outputDeviceInfo.udpDecimationFactor);
     *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
     outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+    outputDevices->back()->setUdpFramesDropped(m_mainWindow.m_dspEngine->getAudioDeviceManager()->getOutputUDPNbFramesDropped(-1));
 
     // real output devices
     for (int i = 0; i < nbOutputDevices; i++)
@@ -308,6 +309,7 @@ int WebAPIAdapterGUI::instanceAudioGet(
         outputDevices->back()->setUdpDecimationFactor((int) outputDeviceInfo.udpDecimationFactor);
         *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
         outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+        outputDevices->back()->setUdpFramesDropped(m_mainWindow.m_dspEngine->getAudioDeviceManager()->getOutputUDPNbFramesDropped(i));
     }
 
     return 200;
@@ -35,6 +35,7 @@ DeviceSet::DeviceSet(int tabIndex)
     m_deviceSourceAPI = 0;
     m_deviceSinkEngine = 0;
     m_deviceSinkAPI = 0;
+    m_spectrumStreamer = 0;
     m_deviceTabIndex = tabIndex;
 }
 
@@ -28,6 +28,7 @@ class PluginAPI;
 class ChannelSinkAPI;
 class ChannelSourceAPI;
 class Preset;
+class SpectrumStreamer;
 
 class DeviceSet
 {
@@ -36,6 +37,7 @@ public:
     DeviceSourceAPI *m_deviceSourceAPI;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DeviceSinkAPI *m_deviceSinkAPI;
+    SpectrumStreamer *m_spectrumStreamer;
 
     DeviceSet(int tabIndex);
     ~DeviceSet();
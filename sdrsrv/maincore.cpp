@@ -26,6 +26,9 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/dspprofile.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/spectrumstreamer.h"
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
 #include "device/deviceset.h"
@@ -36,6 +39,10 @@
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadaptersrv.h"
 
+#include "SWGDeviceSettings.h"
+#include "SWGFileSourceSettings.h"
+#include "SWGDeviceState.h"
+
 #include "maincore.h"
 
 MESSAGE_CLASS_DEFINITION(MainCore::MsgDeleteInstance, Message)
@@ -56,13 +63,20 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     m_masterTabIndex(-1),
     m_dspEngine(DSPEngine::instance()),
     m_lastEngineState(DSPDeviceSourceEngine::StNotStarted),
-    m_logger(logger)
+    m_logger(logger),
+    m_offlineDrainedTicks(0)
 {
     qDebug() << "MainCore::MainCore: start";
 
     m_instance = this;
     m_settings.setAudioDeviceManager(m_dspEngine->getAudioDeviceManager());
 
+    if (!parser.getOfflineFileName().isEmpty()) // before any device set or audio output is created
+    {
+        m_dspEngine->setOffline(true);
+        m_dspEngine->getAudioDeviceManager()->setOutputDirectory(parser.getWavDirectory());
+    }
+
     m_pluginManager = new PluginManager(this);
     m_pluginManager->loadPlugins(QString("pluginssrv"));
 
@@ -85,11 +99,23 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
     m_apiServer->start();
 
+    if (parser.getProfilePeriod() > 0)
+    {
+        connect(&m_profileTimer, SIGNAL(timeout()), this, SLOT(logProfiles()));
+        m_profileTimer.start(parser.getProfilePeriod() * 1000);
+    }
+
+    if (!parser.getOfflineFileName().isEmpty()) {
+        startOffline(parser.getOfflineFileName(), parser.getPresetName());
+    }
+
     qDebug() << "MainCore::MainCore: end";
 }
 
 MainCore::~MainCore()
 {
+    m_profileTimer.stop();
+
     while (m_deviceSets.size() > 0) {
         removeLastDevice();
     }
@@ -106,6 +132,115 @@ MainCore::~MainCore()
     delete m_logger;
 }
 
+void MainCore::logProfiles()
+{
+    for (unsigned int i = 0; i < m_deviceSets.size(); i++)
+    {
+        if (m_deviceSets[i]->m_deviceSourceEngine == 0) {
+            continue;
+        }
+
+        DSPProfile profile(DSPProfileStage::ConsumerLog);
+        m_deviceSets[i]->m_deviceSourceEngine->getProfile(profile);
+        m_dspEngine->getAudioDeviceManager()->getOutputProfileStages(profile);
+        qInfo("MainCore::logProfiles: device set %u:\n%s", i, qPrintable(profile.toString()));
+    }
+}
+
+/**
+ * Offline processing of a recording: a file source device set is created with the channels of
+ * the preset if any then the recording is played as fast as the channels can process it.
+ */
+void MainCore::startOffline(const QString& fileName, const QString& presetName)
+{
+    qInfo("MainCore::startOffline: %s preset: %s", qPrintable(fileName), presetName.isEmpty() ? "none" : qPrintable(presetName));
+    addSourceDevice(); // file source by default
+    int deviceSetIndex = m_deviceSets.size() - 1;
+
+    if (!presetName.isEmpty())
+    {
+        QString group = presetName.section('/', 0, 0);
+        QString description = presetName.section('/', 1);
+        const Preset *preset = 0;
+
+        for (int i = 0; i < m_settings.getPresetCount(); i++)
+        {
+            const Preset *candidate = m_settings.getPreset(i);
+
+            if (candidate->isSourcePreset() && (candidate->getGroup() == group) && (candidate->getDescription() == description))
+            {
+                preset = candidate;
+                break;
+            }
+        }
+
+        if (preset) {
+            loadPresetSettings(preset, deviceSetIndex);
+        } else {
+            qWarning("MainCore::startOffline: preset %s not found", qPrintable(presetName));
+        }
+    }
+
+    DeviceSampleSource *source = m_deviceSets[deviceSetIndex]->m_deviceSourceAPI->getSampleSource();
+    QString errorMessage;
+    SWGSDRangel::SWGDeviceSettings deviceSettings;
+    deviceSettings.setFileSourceSettings(new SWGSDRangel::SWGFileSourceSettings());
+    deviceSettings.getFileSourceSettings()->init();
+    deviceSettings.getFileSourceSettings()->setFileName(new QString(fileName));
+    source->webapiSettingsPutPatch(false, QStringList() << "fileName", deviceSettings, errorMessage);
+
+    SWGSDRangel::SWGDeviceState deviceState;
+    deviceState.init();
+    source->webapiRun(true, deviceState, errorMessage);
+
+    connect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(checkOfflineEnd()));
+}
+
+/**
+ * The run is over when the recording has been read to the end and everything has gone through
+ * the channels or if the device could not be started. The device sets are removed before exit
+ * which finalizes the WAV files.
+ */
+void MainCore::checkOfflineEnd()
+{
+    bool done = true;
+
+    for (unsigned int i = 0; i < m_deviceSets.size(); i++)
+    {
+        DSPDeviceSourceEngine *engine = m_deviceSets[i]->m_deviceSourceEngine;
+
+        if (engine == 0) {
+            continue;
+        }
+
+        if ((engine->state() != DSPDeviceSourceEngine::StError)
+         && (!engine->getSource() || !engine->getSource()->isEndOfStream() || !engine->isDrained()))
+        {
+            done = false;
+            break;
+        }
+    }
+
+    if (!done)
+    {
+        m_offlineDrainedTicks = 0;
+        return;
+    }
+
+    if (++m_offlineDrainedTicks < 4) { // let the channels write their last audio samples
+        return;
+    }
+
+    qInfo("MainCore::checkOfflineEnd: offline processing finished");
+    disconnect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(checkOfflineEnd()));
+
+    while (m_deviceSets.size() > 0) {
+        removeLastDevice();
+    }
+
+    emit finished();
+}
+
 bool MainCore::handleMessage(const Message& cmd)
 {
     if (MsgDeleteInstance::match(cmd))
@@ -270,9 +405,15 @@ void MainCore::addSinkDevice()
     sprintf(uidCStr, "UID:%d", dspDeviceSinkEngineUID);
 
     int deviceTabIndex = m_deviceSets.size();
+    SpectrumStreamer *spectrumStreamer = new SpectrumStreamer(SDR_TX_SCALEF);
+    dspDeviceSinkEngine->addSpectrumSink(spectrumStreamer);
+
+    m_deviceSetsMutex.lock();
     m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
     m_deviceSets.back()->m_deviceSourceEngine = 0;
     m_deviceSets.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
+    m_deviceSets.back()->m_spectrumStreamer = spectrumStreamer;
+    m_deviceSetsMutex.unlock();
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
@@ -298,8 +439,10 @@ void MainCore::addSinkDevice()
     // delete previous plugin instance
     //m_deviceSets.back()->m_deviceSinkAPI->getPluginInterface()->deleteSampleSinkPluginInstanceOutput()
 
+    DeviceEnumerator::HardwareLocker hardwareLocker(m_deviceSets.back()->m_deviceSinkAPI->getSampleSinkId()); // a rescan may be probing the same hardware
     DeviceSampleSink *sink = m_deviceSets.back()->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceOutput(
             m_deviceSets.back()->m_deviceSinkAPI->getSampleSinkId(), m_deviceSets.back()->m_deviceSinkAPI);
+    hardwareLocker.unlock();
     m_deviceSets.back()->m_deviceSinkAPI->setSampleSink(sink);
 }
 
@@ -313,8 +456,14 @@ void MainCore::addSourceDevice()
     sprintf(uidCStr, "UID:%d", dspDeviceSourceEngineUID);
 
     int deviceTabIndex = m_deviceSets.size();
+    SpectrumStreamer *spectrumStreamer = new SpectrumStreamer(SDR_RX_SCALEF);
+    dspDeviceSourceEngine->addSink(spectrumStreamer);
+
+    m_deviceSetsMutex.lock();
     m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
     m_deviceSets.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
+    m_deviceSets.back()->m_spectrumStreamer = spectrumStreamer;
+    m_deviceSetsMutex.unlock();
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
@@ -335,8 +484,10 @@ void MainCore::addSourceDevice()
     m_deviceSets.back()->m_deviceSourceAPI->setSampleSourceDisplayName(samplingDevice.displayedName);
     m_deviceSets.back()->m_deviceSourceAPI->setSampleSourcePluginInterface(DeviceEnumerator::instance()->getRxPluginInterface(fileSourceDeviceIndex));
 
+    DeviceEnumerator::HardwareLocker hardwareLocker(m_deviceSets.back()->m_deviceSourceAPI->getSampleSourceId()); // a rescan may be probing the same hardware
     DeviceSampleSource *source = m_deviceSets.back()->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceInput(
             m_deviceSets.back()->m_deviceSourceAPI->getSampleSourceId(), m_deviceSets.back()->m_deviceSourceAPI);
+    hardwareLocker.unlock();
     m_deviceSets.back()->m_deviceSourceAPI->setSampleSource(source);
 }
 
@@ -354,8 +505,19 @@ void MainCore::removeLastDevice()
                 m_deviceSets.back()->m_deviceSourceAPI->getSampleSource());
         m_deviceSets.back()->m_deviceSourceAPI->clearBuddiesLists(); // clear old API buddies lists
 
+        m_deviceSetsMutex.lock(); // no new stream subscription from now on
+        SpectrumStreamer *spectrumStreamer = m_deviceSets.back()->m_spectrumStreamer;
+        m_deviceSets.back()->m_spectrumStreamer = 0;
+        m_deviceSetsMutex.unlock();
+
+        lastDeviceEngine->removeSink(spectrumStreamer);
+        delete spectrumStreamer; // ends the streams to clients
+
         DeviceSourceAPI *sourceAPI = m_deviceSets.back()->m_deviceSourceAPI;
+        m_deviceSetsMutex.lock();
         delete m_deviceSets.back();
+        m_deviceSets.pop_back();
+        m_deviceSetsMutex.unlock();
 
         lastDeviceEngine->stop();
         m_dspEngine->removeLastDeviceSourceEngine();
@@ -374,16 +536,25 @@ void MainCore::removeLastDevice()
                 m_deviceSets.back()->m_deviceSinkAPI->getSampleSink());
         m_deviceSets.back()->m_deviceSinkAPI->clearBuddiesLists(); // clear old API buddies lists
 
+        m_deviceSetsMutex.lock(); // no new stream subscription from now on
+        SpectrumStreamer *spectrumStreamer = m_deviceSets.back()->m_spectrumStreamer;
+        m_deviceSets.back()->m_spectrumStreamer = 0;
+        m_deviceSetsMutex.unlock();
+
+        lastDeviceEngine->removeSpectrumSink(spectrumStreamer);
+        delete spectrumStreamer; // ends the streams to clients
+
         DeviceSinkAPI *sinkAPI = m_deviceSets.back()->m_deviceSinkAPI;
+        m_deviceSetsMutex.lock();
         delete m_deviceSets.back();
+        m_deviceSets.pop_back();
+        m_deviceSetsMutex.unlock();
 
         lastDeviceEngine->stop();
         m_dspEngine->removeLastDeviceSinkEngine();
 
         delete sinkAPI;
     }
-
-    m_deviceSets.pop_back();
 }
 
 void MainCore::changeSampleSource(int deviceSetIndex, int selectedDeviceIndex)
@@ -446,8 +617,10 @@ void MainCore::changeSampleSource(int deviceSetIndex, int selectedDeviceIndex)
         }
 
         // constructs new GUI and input object
+        DeviceEnumerator::HardwareLocker hardwareLocker(deviceSet->m_deviceSourceAPI->getSampleSourceId()); // a rescan may be probing the same hardware
         DeviceSampleSource *source = deviceSet->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceInput(
                 deviceSet->m_deviceSourceAPI->getSampleSourceId(), deviceSet->m_deviceSourceAPI);
+        hardwareLocker.unlock();
         deviceSet->m_deviceSourceAPI->setSampleSource(source);
 
         deviceSet->m_deviceSourceAPI->loadSourceSettings(m_settings.getWorkingPreset()); // load new API settings
@@ -514,8 +687,10 @@ void MainCore::changeSampleSink(int deviceSetIndex, int selectedDeviceIndex)
         }
 
         // constructs new GUI and output object
+        DeviceEnumerator::HardwareLocker hardwareLocker(deviceSet->m_deviceSinkAPI->getSampleSinkId()); // a rescan may be probing the same hardware
         DeviceSampleSink *sink = deviceSet->m_deviceSinkAPI->getPluginInterface()->createSampleSinkPluginInstanceOutput(
                 deviceSet->m_deviceSinkAPI->getSampleSinkId(), deviceSet->m_deviceSinkAPI);
+        hardwareLocker.unlock();
         deviceSet->m_deviceSinkAPI->setSampleSink(sink);
 
         deviceSet->m_deviceSinkAPI->loadSinkSettings(m_settings.getWorkingPreset()); // load new API settings
@@ -22,6 +22,7 @@
 
 #include <QObject>
 #include <QTimer>
+#include <QMutex>
 
 #include "settings/mainsettings.h"
 #include "util/message.h"
@@ -280,7 +281,10 @@ private:
 
     MessageQueue m_inputMessageQueue;
     QTimer m_masterTimer;
+    QTimer m_profileTimer; //!< periodic DSP profile dump in the log
+    int m_offlineDrainedTicks; //!< master timer ticks the offline run has been found finished
     std::vector<DeviceSet*> m_deviceSets;
+    QMutex m_deviceSetsMutex; //!< guards the device sets list and their spectrum streamers against the API stream handler threads
     PluginManager* m_pluginManager;
 
     WebAPIRequestMapper *m_requestMapper;
@@ -290,12 +294,15 @@ private:
 	void loadSettings();
 	void loadPresetSettings(const Preset* preset, int tabIndex);
 	void savePresetSettings(Preset* preset, int tabIndex);
+    void startOffline(const QString& fileName, const QString& presetName);
     void setLoggingOptions();
 
     bool handleMessage(const Message& cmd);
 
 private slots:
     void handleMessages();
+    void logProfiles();
+    void checkOfflineEnd();
 };
 
 
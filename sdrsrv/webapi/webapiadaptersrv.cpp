@@ -17,6 +17,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QMutexLocker>
 #include <QCoreApplication>
 #include <QList>
 #include <QTextStream>
@@ -43,6 +44,7 @@
 #include "SWGErrorResponse.h"
 #include "SWGDeviceState.h"
 #include "SWGDeviceReport.h"
+#include "SWGDeviceSetProfile.h"
 
 #include "maincore.h"
 #include "loggerwithfile.h"
@@ -53,6 +55,9 @@
 #include "dsp/devicesamplesink.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspprofile.h"
+#include "dsp/spectrumstreamer.h"
 #include "channel/channelsourceapi.h"
 #include "channel/channelsinkapi.h"
 #include "plugin/pluginapi.h"
@@ -284,6 +289,7 @@ int WebAPIAdapterSrv::instanceAudioGet(
     outputDevices->back()->setUdpDecimationFactor(outputDeviceInfo.udpDecimationFactor);
     *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
     outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+    outputDevices->back()->setUdpFramesDropped(m_mainCore.m_dspEngine->getAudioDeviceManager()->getOutputUDPNbFramesDropped(-1));
 
     // real output devices
     for (int i = 0; i < nbOutputDevices; i++)
@@ -304,6 +310,7 @@ int WebAPIAdapterSrv::instanceAudioGet(
         outputDevices->back()->setUdpDecimationFactor(outputDeviceInfo.udpDecimationFactor);
         *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
         outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+        outputDevices->back()->setUdpFramesDropped(m_mainCore.m_dspEngine->getAudioDeviceManager()->getOutputUDPNbFramesDropped(i));
     }
 
     return 200;
@@ -1366,6 +1373,98 @@ int WebAPIAdapterSrv::devicesetChannelsReportGet(
     }
 }
 
+int WebAPIAdapterSrv::devicesetSpectrumStreamGet(
+        int deviceSetIndex,
+        bool iq,
+        SpectrumStreamer*& streamer,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    // called from the HTTP connection handler thread: the device set may be removed concurrently
+    QMutexLocker mutexLocker(&m_mainCore.m_deviceSetsMutex);
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        streamer = m_mainCore.m_deviceSets[deviceSetIndex]->m_spectrumStreamer;
+
+        if (streamer && streamer->subscribe(iq)) // once subscribed the streamer waits for the stream to end before being deleted
+        {
+            return 200;
+        }
+        else
+        {
+            streamer = 0;
+            error.init();
+            *error.getMessage() = QString("Spectrum of device set %1 is closing").arg(deviceSetIndex);
+
+            return 503;
+        }
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetProfileGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceSetProfile& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine == 0)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        DSPProfile profile;
+        deviceSet->m_deviceSourceEngine->getProfile(profile);
+        m_mainCore.m_dspEngine->getAudioDeviceManager()->getOutputProfileStages(profile);
+
+        float latencyAvg, latencyMax;
+        profile.estimateLatency(latencyAvg, latencyMax);
+        response.init();
+        response.setLatencyAvg(latencyAvg);
+        response.setLatencyMax(latencyMax);
+        QList<SWGSDRangel::SWGProfileStage*> *stages = response.getStages();
+        const std::vector<DSPProfileStage::Snapshot>& snapshots = profile.getStages();
+
+        for (std::vector<DSPProfileStage::Snapshot>::const_iterator it = snapshots.begin(); it != snapshots.end(); ++it)
+        {
+            stages->append(new SWGSDRangel::SWGProfileStage);
+            stages->back()->init();
+            *stages->back()->getName() = it->m_name;
+            stages->back()->setType(it->m_type);
+            stages->back()->setCalls(it->m_calls);
+            stages->back()->setSamples(it->m_samples);
+            stages->back()->setInterval(it->m_interval);
+            stages->back()->setSamplesPerSecond(it->m_samplesPerSecond);
+            stages->back()->setLoad(it->m_load);
+            stages->back()->setTimeAvg(it->m_timeAvg);
+            stages->back()->setTimeMax(it->m_timeMax);
+            stages->back()->setFillAvg(it->m_fillAvg);
+            stages->back()->setFillHighWater(it->m_fillHighWater);
+            stages->back()->setSampleRate(it->m_sampleRate);
+        }
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
 int WebAPIAdapterSrv::devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
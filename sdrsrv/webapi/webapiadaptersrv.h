@@ -238,6 +238,17 @@ public:
             SWGSDRangel::SWGChannelReport& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetSpectrumStreamGet(
+            int deviceSetIndex,
+            bool iq,
+            SpectrumStreamer*& streamer,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetProfileGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetProfile& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
 private:
     MainCore& m_mainCore;
 
@@ -44,6 +44,8 @@ SWGAirspyHFSettings::SWGAirspyHFSettings() {
     m_band_index_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -90,6 +92,8 @@ SWGAirspyHFSettings::init() {
     m_band_index_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -168,6 +172,8 @@ SWGAirspyHFSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&file_record_format, pJson["fileRecordFormat"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -230,6 +236,9 @@ SWGAirspyHFSettings::asJsonObject() {
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
+    if(m_file_record_format_isSet){
+        obj->insert("fileRecordFormat", QJsonValue(file_record_format));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -347,6 +356,16 @@ SWGAirspyHFSettings::setFileRecordName(QString* file_record_name) {
     this->m_file_record_name_isSet = true;
 }
 
+qint32
+SWGAirspyHFSettings::getFileRecordFormat() {
+    return file_record_format;
+}
+void
+SWGAirspyHFSettings::setFileRecordFormat(qint32 file_record_format) {
+    this->file_record_format = file_record_format;
+    this->m_file_record_format_isSet = true;
+}
+
 qint32
 SWGAirspyHFSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -470,6 +489,7 @@ SWGAirspyHFSettings::isSet(){
         if(m_transverter_delta_frequency_isSet){ isObjectUpdated = true; break;}
         if(m_band_index_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_file_record_format_isSet){ isObjectUpdated = true; break;}
         if(m_use_reverse_api_isSet){ isObjectUpdated = true; break;}
         if(reverse_api_address != nullptr && *reverse_api_address != QString("")){ isObjectUpdated = true; break;}
         if(m_reverse_api_port_isSet){ isObjectUpdated = true; break;}
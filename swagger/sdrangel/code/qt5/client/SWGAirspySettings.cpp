@@ -60,6 +60,8 @@ SWGAirspySettings::SWGAirspySettings() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -108,6 +110,8 @@ SWGAirspySettings::init() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -189,6 +193,8 @@ SWGAirspySettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&file_record_format, pJson["fileRecordFormat"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -261,6 +267,9 @@ SWGAirspySettings::asJsonObject() {
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
+    if(m_file_record_format_isSet){
+        obj->insert("fileRecordFormat", QJsonValue(file_record_format));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -437,6 +446,16 @@ SWGAirspySettings::setFileRecordName(QString* file_record_name) {
     this->m_file_record_name_isSet = true;
 }
 
+qint32
+SWGAirspySettings::getFileRecordFormat() {
+    return file_record_format;
+}
+void
+SWGAirspySettings::setFileRecordFormat(qint32 file_record_format) {
+    this->file_record_format = file_record_format;
+    this->m_file_record_format_isSet = true;
+}
+
 qint32
 SWGAirspySettings::getUseReverseApi() {
     return use_reverse_api;
@@ -498,6 +517,7 @@ SWGAirspySettings::isSet(){
         if(m_transverter_mode_isSet){ isObjectUpdated = true; break;}
         if(m_transverter_delta_frequency_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_file_record_format_isSet){ isObjectUpdated = true; break;}
         if(m_use_reverse_api_isSet){ isObjectUpdated = true; break;}
         if(reverse_api_address != nullptr && *reverse_api_address != QString("")){ isObjectUpdated = true; break;}
         if(m_reverse_api_port_isSet){ isObjectUpdated = true; break;}
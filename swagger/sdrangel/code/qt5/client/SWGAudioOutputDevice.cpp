@@ -52,6 +52,8 @@ SWGAudioOutputDevice::SWGAudioOutputDevice() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    udp_frames_dropped = 0;
+    m_udp_frames_dropped_isSet = false;
 }
 
 SWGAudioOutputDevice::~SWGAudioOutputDevice() {
@@ -84,6 +86,8 @@ SWGAudioOutputDevice::init() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    udp_frames_dropped = 0;
+    m_udp_frames_dropped_isSet = false;
 }
 
 void
@@ -141,6 +145,8 @@ SWGAudioOutputDevice::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&udp_frames_dropped, pJson["udpFramesDropped"], "qint32", "");
+    
 }
 
 QString
@@ -193,6 +199,9 @@ SWGAudioOutputDevice::asJsonObject() {
     if(m_udp_port_isSet){
         obj->insert("udpPort", QJsonValue(udp_port));
     }
+    if(m_udp_frames_dropped_isSet){
+        obj->insert("udpFramesDropped", QJsonValue(udp_frames_dropped));
+    }
 
     return obj;
 }
@@ -317,6 +326,16 @@ SWGAudioOutputDevice::setUdpPort(qint32 udp_port) {
     this->m_udp_port_isSet = true;
 }
 
+qint32
+SWGAudioOutputDevice::getUdpFramesDropped() {
+    return udp_frames_dropped;
+}
+void
+SWGAudioOutputDevice::setUdpFramesDropped(qint32 udp_frames_dropped) {
+    this->udp_frames_dropped = udp_frames_dropped;
+    this->m_udp_frames_dropped_isSet = true;
+}
+
 
 bool
 SWGAudioOutputDevice::isSet(){
@@ -334,6 +353,7 @@ SWGAudioOutputDevice::isSet(){
         if(m_udp_decimation_factor_isSet){ isObjectUpdated = true; break;}
         if(udp_address != nullptr && *udp_address != QString("")){ isObjectUpdated = true; break;}
         if(m_udp_port_isSet){ isObjectUpdated = true; break;}
+        if(m_udp_frames_dropped_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
@@ -78,6 +78,9 @@ public:
     qint32 getUdpPort();
     void setUdpPort(qint32 udp_port);
 
+    qint32 getUdpFramesDropped();
+    void setUdpFramesDropped(qint32 udp_frames_dropped);
+
 
     virtual bool isSet() override;
 
@@ -118,6 +121,9 @@ private:
     qint32 udp_port;
     bool m_udp_port_isSet;
 
+    qint32 udp_frames_dropped;
+    bool m_udp_frames_dropped_isSet;
+
 };
 
 }
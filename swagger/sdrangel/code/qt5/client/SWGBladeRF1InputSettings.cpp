@@ -56,6 +56,8 @@ SWGBladeRF1InputSettings::SWGBladeRF1InputSettings() {
     m_iq_correction_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -100,6 +102,8 @@ SWGBladeRF1InputSettings::init() {
     m_iq_correction_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -175,6 +179,8 @@ SWGBladeRF1InputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&file_record_format, pJson["fileRecordFormat"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -241,6 +247,9 @@ SWGBladeRF1InputSettings::asJsonObject() {
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
+    if(m_file_record_format_isSet){
+        obj->insert("fileRecordFormat", QJsonValue(file_record_format));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -397,6 +406,16 @@ SWGBladeRF1InputSettings::setFileRecordName(QString* file_record_name) {
     this->m_file_record_name_isSet = true;
 }
 
+qint32
+SWGBladeRF1InputSettings::getFileRecordFormat() {
+    return file_record_format;
+}
+void
+SWGBladeRF1InputSettings::setFileRecordFormat(qint32 file_record_format) {
+    this->file_record_format = file_record_format;
+    this->m_file_record_format_isSet = true;
+}
+
 qint32
 SWGBladeRF1InputSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -456,6 +475,7 @@ SWGBladeRF1InputSettings::isSet(){
         if(m_dc_block_isSet){ isObjectUpdated = true; break;}
         if(m_iq_correction_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_file_record_format_isSet){ isObjectUpdated = true; break;}
         if(m_use_reverse_api_isSet){ isObjectUpdated = true; break;}
         if(reverse_api_address != nullptr && *reverse_api_address != QString("")){ isObjectUpdated = true; break;}
         if(m_reverse_api_port_isSet){ isObjectUpdated = true; break;}
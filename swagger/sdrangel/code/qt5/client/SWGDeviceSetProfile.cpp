@@ -0,0 +1,153 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.5.3
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+#include "SWGDeviceSetProfile.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDeviceSetProfile::SWGDeviceSetProfile(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDeviceSetProfile::SWGDeviceSetProfile() {
+    latency_avg = 0.0f;
+    m_latency_avg_isSet = false;
+    latency_max = 0.0f;
+    m_latency_max_isSet = false;
+    stages = nullptr;
+    m_stages_isSet = false;
+}
+
+SWGDeviceSetProfile::~SWGDeviceSetProfile() {
+    this->cleanup();
+}
+
+void
+SWGDeviceSetProfile::init() {
+    latency_avg = 0.0f;
+    m_latency_avg_isSet = false;
+    latency_max = 0.0f;
+    m_latency_max_isSet = false;
+    stages = new QList<SWGProfileStage*>();
+    m_stages_isSet = false;
+}
+
+void
+SWGDeviceSetProfile::cleanup() {
+
+
+    if(stages != nullptr) { 
+        auto arr = stages;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete stages;
+    }
+}
+
+SWGDeviceSetProfile*
+SWGDeviceSetProfile::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDeviceSetProfile::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&latency_avg, pJson["latencyAvg"], "float", "");
+    
+    ::SWGSDRangel::setValue(&latency_max, pJson["latencyMax"], "float", "");
+    
+    
+    ::SWGSDRangel::setValue(&stages, pJson["stages"], "QList", "SWGProfileStage");
+}
+
+QString
+SWGDeviceSetProfile::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDeviceSetProfile::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_latency_avg_isSet){
+        obj->insert("latencyAvg", QJsonValue(latency_avg));
+    }
+    if(m_latency_max_isSet){
+        obj->insert("latencyMax", QJsonValue(latency_max));
+    }
+    if(stages->size() > 0){
+        toJsonArray((QList<void*>*)stages, obj, "stages", "SWGProfileStage");
+    }
+
+    return obj;
+}
+
+float
+SWGDeviceSetProfile::getLatencyAvg() {
+    return latency_avg;
+}
+void
+SWGDeviceSetProfile::setLatencyAvg(float latency_avg) {
+    this->latency_avg = latency_avg;
+    this->m_latency_avg_isSet = true;
+}
+
+float
+SWGDeviceSetProfile::getLatencyMax() {
+    return latency_max;
+}
+void
+SWGDeviceSetProfile::setLatencyMax(float latency_max) {
+    this->latency_max = latency_max;
+    this->m_latency_max_isSet = true;
+}
+
+QList<SWGProfileStage*>*
+SWGDeviceSetProfile::getStages() {
+    return stages;
+}
+void
+SWGDeviceSetProfile::setStages(QList<SWGProfileStage*>* stages) {
+    this->stages = stages;
+    this->m_stages_isSet = true;
+}
+
+
+bool
+SWGDeviceSetProfile::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_latency_max_isSet){ isObjectUpdated = true; break;}
+        if(stages->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
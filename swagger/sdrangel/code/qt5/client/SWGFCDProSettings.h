@@ -117,6 +117,9 @@ public:
     QString* getFileRecordName();
     void setFileRecordName(QString* file_record_name);
 
+    qint32 getFileRecordFormat();
+    void setFileRecordFormat(qint32 file_record_format);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -208,6 +211,9 @@ private:
     QString* file_record_name;
     bool m_file_record_name_isSet;
 
+    qint32 file_record_format;
+    bool m_file_record_format_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
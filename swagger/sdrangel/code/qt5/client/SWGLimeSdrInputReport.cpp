@@ -52,6 +52,12 @@ SWGLimeSdrInputReport::SWGLimeSdrInputReport() {
     m_gpio_dir_isSet = false;
     gpio_pins = 0;
     m_gpio_pins_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 SWGLimeSdrInputReport::~SWGLimeSdrInputReport() {
@@ -84,6 +90,12 @@ SWGLimeSdrInputReport::init() {
     m_gpio_dir_isSet = false;
     gpio_pins = 0;
     m_gpio_pins_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 void
@@ -100,6 +112,9 @@ SWGLimeSdrInputReport::cleanup() {
 
 
 
+
+
+
 }
 
 SWGLimeSdrInputReport*
@@ -137,6 +152,12 @@ SWGLimeSdrInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&gpio_pins, pJson["gpioPins"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&pipeline_overrun_count, pJson["pipelineOverrunCount"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_avg, pJson["pipelineLatencyAvg"], "float", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_max, pJson["pipelineLatencyMax"], "float", "");
+    
 }
 
 QString
@@ -189,6 +210,15 @@ SWGLimeSdrInputReport::asJsonObject() {
     if(m_gpio_pins_isSet){
         obj->insert("gpioPins", QJsonValue(gpio_pins));
     }
+    if(m_pipeline_overrun_count_isSet){
+        obj->insert("pipelineOverrunCount", QJsonValue(pipeline_overrun_count));
+    }
+    if(m_pipeline_latency_avg_isSet){
+        obj->insert("pipelineLatencyAvg", QJsonValue(pipeline_latency_avg));
+    }
+    if(m_pipeline_latency_max_isSet){
+        obj->insert("pipelineLatencyMax", QJsonValue(pipeline_latency_max));
+    }
 
     return obj;
 }
@@ -313,6 +343,36 @@ SWGLimeSdrInputReport::setGpioPins(qint32 gpio_pins) {
     this->m_gpio_pins_isSet = true;
 }
 
+qint32
+SWGLimeSdrInputReport::getPipelineOverrunCount() {
+    return pipeline_overrun_count;
+}
+void
+SWGLimeSdrInputReport::setPipelineOverrunCount(qint32 pipeline_overrun_count) {
+    this->pipeline_overrun_count = pipeline_overrun_count;
+    this->m_pipeline_overrun_count_isSet = true;
+}
+
+float
+SWGLimeSdrInputReport::getPipelineLatencyAvg() {
+    return pipeline_latency_avg;
+}
+void
+SWGLimeSdrInputReport::setPipelineLatencyAvg(float pipeline_latency_avg) {
+    this->pipeline_latency_avg = pipeline_latency_avg;
+    this->m_pipeline_latency_avg_isSet = true;
+}
+
+float
+SWGLimeSdrInputReport::getPipelineLatencyMax() {
+    return pipeline_latency_max;
+}
+void
+SWGLimeSdrInputReport::setPipelineLatencyMax(float pipeline_latency_max) {
+    this->pipeline_latency_max = pipeline_latency_max;
+    this->m_pipeline_latency_max_isSet = true;
+}
+
 
 bool
 SWGLimeSdrInputReport::isSet(){
@@ -330,6 +390,9 @@ SWGLimeSdrInputReport::isSet(){
         if(m_temperature_isSet){ isObjectUpdated = true; break;}
         if(m_gpio_dir_isSet){ isObjectUpdated = true; break;}
         if(m_gpio_pins_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_overrun_count_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_max_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
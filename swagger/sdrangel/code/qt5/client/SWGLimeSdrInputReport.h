@@ -77,6 +77,15 @@ public:
     qint32 getGpioPins();
     void setGpioPins(qint32 gpio_pins);
 
+    qint32 getPipelineOverrunCount();
+    void setPipelineOverrunCount(qint32 pipeline_overrun_count);
+
+    float getPipelineLatencyAvg();
+    void setPipelineLatencyAvg(float pipeline_latency_avg);
+
+    float getPipelineLatencyMax();
+    void setPipelineLatencyMax(float pipeline_latency_max);
+
 
     virtual bool isSet() override;
 
@@ -117,6 +126,15 @@ private:
     qint32 gpio_pins;
     bool m_gpio_pins_isSet;
 
+    qint32 pipeline_overrun_count;
+    bool m_pipeline_overrun_count_isSet;
+
+    float pipeline_latency_avg;
+    bool m_pipeline_latency_avg_isSet;
+
+    float pipeline_latency_max;
+    bool m_pipeline_latency_max_isSet;
+
 };
 
 }
@@ -72,6 +72,8 @@ SWGLimeSdrInputSettings::SWGLimeSdrInputSettings() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     gpio_dir = 0;
     m_gpio_dir_isSet = false;
     gpio_pins = 0;
@@ -136,6 +138,8 @@ SWGLimeSdrInputSettings::init() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     gpio_dir = 0;
     m_gpio_dir_isSet = false;
     gpio_pins = 0;
@@ -241,6 +245,8 @@ SWGLimeSdrInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&file_record_format, pJson["fileRecordFormat"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&gpio_dir, pJson["gpioDir"], "qint32", "");
     
     ::SWGSDRangel::setValue(&gpio_pins, pJson["gpioPins"], "qint32", "");
@@ -335,6 +341,9 @@ SWGLimeSdrInputSettings::asJsonObject() {
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
+    if(m_file_record_format_isSet){
+        obj->insert("fileRecordFormat", QJsonValue(file_record_format));
+    }
     if(m_gpio_dir_isSet){
         obj->insert("gpioDir", QJsonValue(gpio_dir));
     }
@@ -577,6 +586,16 @@ SWGLimeSdrInputSettings::setFileRecordName(QString* file_record_name) {
     this->m_file_record_name_isSet = true;
 }
 
+qint32
+SWGLimeSdrInputSettings::getFileRecordFormat() {
+    return file_record_format;
+}
+void
+SWGLimeSdrInputSettings::setFileRecordFormat(qint32 file_record_format) {
+    this->file_record_format = file_record_format;
+    this->m_file_record_format_isSet = true;
+}
+
 qint32
 SWGLimeSdrInputSettings::getGpioDir() {
     return gpio_dir;
@@ -664,6 +683,7 @@ SWGLimeSdrInputSettings::isSet(){
         if(m_transverter_mode_isSet){ isObjectUpdated = true; break;}
         if(m_transverter_delta_frequency_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_file_record_format_isSet){ isObjectUpdated = true; break;}
         if(m_gpio_dir_isSet){ isObjectUpdated = true; break;}
         if(m_gpio_pins_isSet){ isObjectUpdated = true; break;}
         if(m_use_reverse_api_isSet){ isObjectUpdated = true; break;}
@@ -108,6 +108,9 @@ public:
     QString* getFileRecordName();
     void setFileRecordName(QString* file_record_name);
 
+    qint32 getFileRecordFormat();
+    void setFileRecordFormat(qint32 file_record_format);
+
     qint32 getGpioDir();
     void setGpioDir(qint32 gpio_dir);
 
@@ -196,6 +199,9 @@ private:
     QString* file_record_name;
     bool m_file_record_name_isSet;
 
+    qint32 file_record_format;
+    bool m_file_record_format_isSet;
+
     qint32 gpio_dir;
     bool m_gpio_dir_isSet;
 
@@ -53,6 +53,7 @@
 #include "SWGDeviceReport.h"
 #include "SWGDeviceSet.h"
 #include "SWGDeviceSetList.h"
+#include "SWGDeviceSetProfile.h"
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGErrorResponse.h"
@@ -97,6 +98,7 @@
 #include "SWGPresetItem.h"
 #include "SWGPresetTransfer.h"
 #include "SWGPresets.h"
+#include "SWGProfileStage.h"
 #include "SWGRDSReport.h"
 #include "SWGRDSReport_altFrequencies.h"
 #include "SWGRange.h"
@@ -258,6 +260,9 @@ namespace SWGSDRangel {
     if(QString("SWGDeviceSetList").compare(type) == 0) {
       return new SWGDeviceSetList();
     }
+    if(QString("SWGDeviceSetProfile").compare(type) == 0) {
+      return new SWGDeviceSetProfile();
+    }
     if(QString("SWGDeviceSettings").compare(type) == 0) {
       return new SWGDeviceSettings();
     }
@@ -390,6 +395,9 @@ namespace SWGSDRangel {
     if(QString("SWGPresets").compare(type) == 0) {
       return new SWGPresets();
     }
+    if(QString("SWGProfileStage").compare(type) == 0) {
+      return new SWGProfileStage();
+    }
     if(QString("SWGRDSReport").compare(type) == 0) {
       return new SWGRDSReport();
     }
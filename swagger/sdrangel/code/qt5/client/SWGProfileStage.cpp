@@ -0,0 +1,338 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.5.3
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+#include "SWGProfileStage.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGProfileStage::SWGProfileStage(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGProfileStage::SWGProfileStage() {
+    name = nullptr;
+    m_name_isSet = false;
+    type = 0;
+    m_type_isSet = false;
+    calls = 0L;
+    m_calls_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    interval = 0.0f;
+    m_interval_isSet = false;
+    samples_per_second = 0.0f;
+    m_samples_per_second_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+    time_avg = 0.0f;
+    m_time_avg_isSet = false;
+    time_max = 0.0f;
+    m_time_max_isSet = false;
+    fill_avg = 0;
+    m_fill_avg_isSet = false;
+    fill_high_water = 0;
+    m_fill_high_water_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+}
+
+SWGProfileStage::~SWGProfileStage() {
+    this->cleanup();
+}
+
+void
+SWGProfileStage::init() {
+    name = new QString("");
+    m_name_isSet = false;
+    type = 0;
+    m_type_isSet = false;
+    calls = 0L;
+    m_calls_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    interval = 0.0f;
+    m_interval_isSet = false;
+    samples_per_second = 0.0f;
+    m_samples_per_second_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+    time_avg = 0.0f;
+    m_time_avg_isSet = false;
+    time_max = 0.0f;
+    m_time_max_isSet = false;
+    fill_avg = 0;
+    m_fill_avg_isSet = false;
+    fill_high_water = 0;
+    m_fill_high_water_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+}
+
+void
+SWGProfileStage::cleanup() {
+    if(name != nullptr) { 
+        delete name;
+    }
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGProfileStage*
+SWGProfileStage::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGProfileStage::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&name, pJson["name"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&type, pJson["type"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&calls, pJson["calls"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&samples, pJson["samples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&interval, pJson["interval"], "float", "");
+    
+    ::SWGSDRangel::setValue(&samples_per_second, pJson["samplesPerSecond"], "float", "");
+    
+    ::SWGSDRangel::setValue(&load, pJson["load"], "float", "");
+    
+    ::SWGSDRangel::setValue(&time_avg, pJson["timeAvg"], "float", "");
+    
+    ::SWGSDRangel::setValue(&time_max, pJson["timeMax"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fill_avg, pJson["fillAvg"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fill_high_water, pJson["fillHighWater"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+}
+
+QString
+SWGProfileStage::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGProfileStage::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(name != nullptr && *name != QString("")){
+        toJsonValue(QString("name"), name, obj, QString("QString"));
+    }
+    if(m_type_isSet){
+        obj->insert("type", QJsonValue(type));
+    }
+    if(m_calls_isSet){
+        obj->insert("calls", QJsonValue(calls));
+    }
+    if(m_samples_isSet){
+        obj->insert("samples", QJsonValue(samples));
+    }
+    if(m_interval_isSet){
+        obj->insert("interval", QJsonValue(interval));
+    }
+    if(m_samples_per_second_isSet){
+        obj->insert("samplesPerSecond", QJsonValue(samples_per_second));
+    }
+    if(m_load_isSet){
+        obj->insert("load", QJsonValue(load));
+    }
+    if(m_time_avg_isSet){
+        obj->insert("timeAvg", QJsonValue(time_avg));
+    }
+    if(m_time_max_isSet){
+        obj->insert("timeMax", QJsonValue(time_max));
+    }
+    if(m_fill_avg_isSet){
+        obj->insert("fillAvg", QJsonValue(fill_avg));
+    }
+    if(m_fill_high_water_isSet){
+        obj->insert("fillHighWater", QJsonValue(fill_high_water));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+
+    return obj;
+}
+
+QString*
+SWGProfileStage::getName() {
+    return name;
+}
+void
+SWGProfileStage::setName(QString* name) {
+    this->name = name;
+    this->m_name_isSet = true;
+}
+
+qint32
+SWGProfileStage::getType() {
+    return type;
+}
+void
+SWGProfileStage::setType(qint32 type) {
+    this->type = type;
+    this->m_type_isSet = true;
+}
+
+qint64
+SWGProfileStage::getCalls() {
+    return calls;
+}
+void
+SWGProfileStage::setCalls(qint64 calls) {
+    this->calls = calls;
+    this->m_calls_isSet = true;
+}
+
+qint64
+SWGProfileStage::getSamples() {
+    return samples;
+}
+void
+SWGProfileStage::setSamples(qint64 samples) {
+    this->samples = samples;
+    this->m_samples_isSet = true;
+}
+
+float
+SWGProfileStage::getInterval() {
+    return interval;
+}
+void
+SWGProfileStage::setInterval(float interval) {
+    this->interval = interval;
+    this->m_interval_isSet = true;
+}
+
+float
+SWGProfileStage::getSamplesPerSecond() {
+    return samples_per_second;
+}
+void
+SWGProfileStage::setSamplesPerSecond(float samples_per_second) {
+    this->samples_per_second = samples_per_second;
+    this->m_samples_per_second_isSet = true;
+}
+
+float
+SWGProfileStage::getLoad() {
+    return load;
+}
+void
+SWGProfileStage::setLoad(float load) {
+    this->load = load;
+    this->m_load_isSet = true;
+}
+
+float
+SWGProfileStage::getTimeAvg() {
+    return time_avg;
+}
+void
+SWGProfileStage::setTimeAvg(float time_avg) {
+    this->time_avg = time_avg;
+    this->m_time_avg_isSet = true;
+}
+
+float
+SWGProfileStage::getTimeMax() {
+    return time_max;
+}
+void
+SWGProfileStage::setTimeMax(float time_max) {
+    this->time_max = time_max;
+    this->m_time_max_isSet = true;
+}
+
+qint32
+SWGProfileStage::getFillAvg() {
+    return fill_avg;
+}
+void
+SWGProfileStage::setFillAvg(qint32 fill_avg) {
+    this->fill_avg = fill_avg;
+    this->m_fill_avg_isSet = true;
+}
+
+qint32
+SWGProfileStage::getFillHighWater() {
+    return fill_high_water;
+}
+void
+SWGProfileStage::setFillHighWater(qint32 fill_high_water) {
+    this->fill_high_water = fill_high_water;
+    this->m_fill_high_water_isSet = true;
+}
+
+qint32
+SWGProfileStage::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGProfileStage::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+
+bool
+SWGProfileStage::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(name != nullptr && *name != QString("")){ isObjectUpdated = true; break;}
+        if(m_type_isSet){ isObjectUpdated = true; break;}
+        if(m_calls_isSet){ isObjectUpdated = true; break;}
+        if(m_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_interval_isSet){ isObjectUpdated = true; break;}
+        if(m_samples_per_second_isSet){ isObjectUpdated = true; break;}
+        if(m_load_isSet){ isObjectUpdated = true; break;}
+        if(m_time_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_time_max_isSet){ isObjectUpdated = true; break;}
+        if(m_fill_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_fill_high_water_isSet){ isObjectUpdated = true; break;}
+        if(m_sample_rate_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
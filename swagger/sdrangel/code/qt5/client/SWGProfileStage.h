@@ -0,0 +1,124 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.5.3
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+/*
+ * SWGProfileStage.h
+ *
+ * Processing counters of one stage
+ */
+
+#ifndef SWGProfileStage_H_
+#define SWGProfileStage_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGProfileStage: public SWGObject {
+public:
+    SWGProfileStage();
+    SWGProfileStage(QString* json);
+    virtual ~SWGProfileStage();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGProfileStage* fromJson(QString &jsonString) override;
+
+    QString* getName();
+    void setName(QString* name);
+
+    qint32 getType();
+    void setType(qint32 type);
+
+    qint64 getCalls();
+    void setCalls(qint64 calls);
+
+    qint64 getSamples();
+    void setSamples(qint64 samples);
+
+    float getInterval();
+    void setInterval(float interval);
+
+    float getSamplesPerSecond();
+    void setSamplesPerSecond(float samples_per_second);
+
+    float getLoad();
+    void setLoad(float load);
+
+    float getTimeAvg();
+    void setTimeAvg(float time_avg);
+
+    float getTimeMax();
+    void setTimeMax(float time_max);
+
+    qint32 getFillAvg();
+    void setFillAvg(qint32 fill_avg);
+
+    qint32 getFillHighWater();
+    void setFillHighWater(qint32 fill_high_water);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* name;
+    bool m_name_isSet;
+
+    qint32 type;
+    bool m_type_isSet;
+
+    qint64 calls;
+    bool m_calls_isSet;
+
+    qint64 samples;
+    bool m_samples_isSet;
+
+    float interval;
+    bool m_interval_isSet;
+
+    float samples_per_second;
+    bool m_samples_per_second_isSet;
+
+    float load;
+    bool m_load_isSet;
+
+    float time_avg;
+    bool m_time_avg_isSet;
+
+    float time_max;
+    bool m_time_max_isSet;
+
+    qint32 fill_avg;
+    bool m_fill_avg_isSet;
+
+    qint32 fill_high_water;
+    bool m_fill_high_water_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+};
+
+}
+
+#endif /* SWGProfileStage_H_ */
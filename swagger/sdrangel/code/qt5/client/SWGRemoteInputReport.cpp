@@ -40,6 +40,16 @@ SWGRemoteInputReport::SWGRemoteInputReport() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    nb_packets_received = 0;
+    m_nb_packets_received_isSet = false;
+    nb_packets_dropped = 0;
+    m_nb_packets_dropped_isSet = false;
+    nb_packets_truncated = 0;
+    m_nb_packets_truncated_isSet = false;
+    nb_frames_recovered = 0;
+    m_nb_frames_recovered_isSet = false;
+    nb_frames_lost = 0;
+    m_nb_frames_lost_isSet = false;
 }
 
 SWGRemoteInputReport::~SWGRemoteInputReport() {
@@ -60,6 +70,16 @@ SWGRemoteInputReport::init() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    nb_packets_received = 0;
+    m_nb_packets_received_isSet = false;
+    nb_packets_dropped = 0;
+    m_nb_packets_dropped_isSet = false;
+    nb_packets_truncated = 0;
+    m_nb_packets_truncated_isSet = false;
+    nb_frames_recovered = 0;
+    m_nb_frames_recovered_isSet = false;
+    nb_frames_lost = 0;
+    m_nb_frames_lost_isSet = false;
 }
 
 void
@@ -97,6 +117,16 @@ SWGRemoteInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&max_nb_recovery, pJson["maxNbRecovery"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&nb_packets_received, pJson["nbPacketsReceived"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_packets_dropped, pJson["nbPacketsDropped"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_packets_truncated, pJson["nbPacketsTruncated"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_frames_recovered, pJson["nbFramesRecovered"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_frames_lost, pJson["nbFramesLost"], "qint32", "");
+    
 }
 
 QString
@@ -131,6 +161,21 @@ SWGRemoteInputReport::asJsonObject() {
     if(m_max_nb_recovery_isSet){
         obj->insert("maxNbRecovery", QJsonValue(max_nb_recovery));
     }
+    if(m_nb_packets_received_isSet){
+        obj->insert("nbPacketsReceived", QJsonValue(nb_packets_received));
+    }
+    if(m_nb_packets_dropped_isSet){
+        obj->insert("nbPacketsDropped", QJsonValue(nb_packets_dropped));
+    }
+    if(m_nb_packets_truncated_isSet){
+        obj->insert("nbPacketsTruncated", QJsonValue(nb_packets_truncated));
+    }
+    if(m_nb_frames_recovered_isSet){
+        obj->insert("nbFramesRecovered", QJsonValue(nb_frames_recovered));
+    }
+    if(m_nb_frames_lost_isSet){
+        obj->insert("nbFramesLost", QJsonValue(nb_frames_lost));
+    }
 
     return obj;
 }
@@ -195,6 +240,56 @@ SWGRemoteInputReport::setMaxNbRecovery(qint32 max_nb_recovery) {
     this->m_max_nb_recovery_isSet = true;
 }
 
+qint64
+SWGRemoteInputReport::getNbPacketsReceived() {
+    return nb_packets_received;
+}
+void
+SWGRemoteInputReport::setNbPacketsReceived(qint64 nb_packets_received) {
+    this->nb_packets_received = nb_packets_received;
+    this->m_nb_packets_received_isSet = true;
+}
+
+qint64
+SWGRemoteInputReport::getNbPacketsDropped() {
+    return nb_packets_dropped;
+}
+void
+SWGRemoteInputReport::setNbPacketsDropped(qint64 nb_packets_dropped) {
+    this->nb_packets_dropped = nb_packets_dropped;
+    this->m_nb_packets_dropped_isSet = true;
+}
+
+qint64
+SWGRemoteInputReport::getNbPacketsTruncated() {
+    return nb_packets_truncated;
+}
+void
+SWGRemoteInputReport::setNbPacketsTruncated(qint64 nb_packets_truncated) {
+    this->nb_packets_truncated = nb_packets_truncated;
+    this->m_nb_packets_truncated_isSet = true;
+}
+
+qint32
+SWGRemoteInputReport::getNbFramesRecovered() {
+    return nb_frames_recovered;
+}
+void
+SWGRemoteInputReport::setNbFramesRecovered(qint32 nb_frames_recovered) {
+    this->nb_frames_recovered = nb_frames_recovered;
+    this->m_nb_frames_recovered_isSet = true;
+}
+
+qint32
+SWGRemoteInputReport::getNbFramesLost() {
+    return nb_frames_lost;
+}
+void
+SWGRemoteInputReport::setNbFramesLost(qint32 nb_frames_lost) {
+    this->nb_frames_lost = nb_frames_lost;
+    this->m_nb_frames_lost_isSet = true;
+}
+
 
 bool
 SWGRemoteInputReport::isSet(){
@@ -206,6 +301,11 @@ SWGRemoteInputReport::isSet(){
         if(remote_timestamp != nullptr && *remote_timestamp != QString("")){ isObjectUpdated = true; break;}
         if(m_min_nb_blocks_isSet){ isObjectUpdated = true; break;}
         if(m_max_nb_recovery_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_packets_received_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_packets_dropped_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_packets_truncated_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_frames_recovered_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_frames_lost_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
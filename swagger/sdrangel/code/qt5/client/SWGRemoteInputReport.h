@@ -60,6 +60,21 @@ public:
     qint32 getMaxNbRecovery();
     void setMaxNbRecovery(qint32 max_nb_recovery);
 
+    qint64 getNbPacketsReceived();
+    void setNbPacketsReceived(qint64 nb_packets_received);
+
+    qint64 getNbPacketsDropped();
+    void setNbPacketsDropped(qint64 nb_packets_dropped);
+
+    qint64 getNbPacketsTruncated();
+    void setNbPacketsTruncated(qint64 nb_packets_truncated);
+
+    qint32 getNbFramesRecovered();
+    void setNbFramesRecovered(qint32 nb_frames_recovered);
+
+    qint32 getNbFramesLost();
+    void setNbFramesLost(qint32 nb_frames_lost);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +97,21 @@ private:
     qint32 max_nb_recovery;
     bool m_max_nb_recovery_isSet;
 
+    qint64 nb_packets_received;
+    bool m_nb_packets_received_isSet;
+
+    qint64 nb_packets_dropped;
+    bool m_nb_packets_dropped_isSet;
+
+    qint64 nb_packets_truncated;
+    bool m_nb_packets_truncated_isSet;
+
+    qint32 nb_frames_recovered;
+    bool m_nb_frames_recovered_isSet;
+
+    qint32 nb_frames_lost;
+    bool m_nb_frames_lost_isSet;
+
 };
 
 }
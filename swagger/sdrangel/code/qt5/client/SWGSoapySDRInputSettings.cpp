@@ -48,6 +48,8 @@ SWGSoapySDRInputSettings::SWGSoapySDRInputSettings() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     antenna = nullptr;
     m_antenna_isSet = false;
     bandwidth = 0;
@@ -108,6 +110,8 @@ SWGSoapySDRInputSettings::init() {
     m_transverter_delta_frequency_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
+    file_record_format = 0;
+    m_file_record_format_isSet = false;
     antenna = new QString("");
     m_antenna_isSet = false;
     bandwidth = 0;
@@ -237,6 +241,8 @@ SWGSoapySDRInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&file_record_format, pJson["fileRecordFormat"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&antenna, pJson["antenna"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&bandwidth, pJson["bandwidth"], "qint32", "");
@@ -315,6 +321,9 @@ SWGSoapySDRInputSettings::asJsonObject() {
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
+    if(m_file_record_format_isSet){
+        obj->insert("fileRecordFormat", QJsonValue(file_record_format));
+    }
     if(antenna != nullptr && *antenna != QString("")){
         toJsonValue(QString("antenna"), antenna, obj, QString("QString"));
     }
@@ -467,6 +476,16 @@ SWGSoapySDRInputSettings::setFileRecordName(QString* file_record_name) {
     this->m_file_record_name_isSet = true;
 }
 
+qint32
+SWGSoapySDRInputSettings::getFileRecordFormat() {
+    return file_record_format;
+}
+void
+SWGSoapySDRInputSettings::setFileRecordFormat(qint32 file_record_format) {
+    this->file_record_format = file_record_format;
+    this->m_file_record_format_isSet = true;
+}
+
 QString*
 SWGSoapySDRInputSettings::getAntenna() {
     return antenna;
@@ -642,6 +661,7 @@ SWGSoapySDRInputSettings::isSet(){
         if(m_transverter_mode_isSet){ isObjectUpdated = true; break;}
         if(m_transverter_delta_frequency_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_file_record_format_isSet){ isObjectUpdated = true; break;}
         if(antenna != nullptr && *antenna != QString("")){ isObjectUpdated = true; break;}
         if(m_bandwidth_isSet){ isObjectUpdated = true; break;}
         if(tunable_elements->size() > 0){ isObjectUpdated = true; break;}
@@ -75,6 +75,9 @@ public:
     QString* getFileRecordName();
     void setFileRecordName(QString* file_record_name);
 
+    qint32 getFileRecordFormat();
+    void setFileRecordFormat(qint32 file_record_format);
+
     QString* getAntenna();
     void setAntenna(QString* antenna);
 
@@ -157,6 +160,9 @@ private:
     QString* file_record_name;
     bool m_file_record_name_isSet;
 
+    qint32 file_record_format;
+    bool m_file_record_format_isSet;
+
     QString* antenna;
     bool m_antenna_isSet;
 
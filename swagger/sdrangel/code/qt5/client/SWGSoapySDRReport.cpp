@@ -56,6 +56,12 @@ SWGSoapySDRReport::SWGSoapySDRReport() {
     m_rates_ranges_isSet = false;
     bandwidths_ranges = nullptr;
     m_bandwidths_ranges_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 SWGSoapySDRReport::~SWGSoapySDRReport() {
@@ -92,6 +98,12 @@ SWGSoapySDRReport::init() {
     m_rates_ranges_isSet = false;
     bandwidths_ranges = new QList<SWGRangeFloat*>();
     m_bandwidths_ranges_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 void
@@ -160,6 +172,9 @@ SWGSoapySDRReport::cleanup() {
         }
         delete bandwidths_ranges;
     }
+
+
+
 }
 
 SWGSoapySDRReport*
@@ -201,6 +216,13 @@ SWGSoapySDRReport::fromJsonObject(QJsonObject &pJson) {
     ::SWGSDRangel::setValue(&rates_ranges, pJson["ratesRanges"], "QList", "SWGRangeFloat");
     
     ::SWGSDRangel::setValue(&bandwidths_ranges, pJson["bandwidthsRanges"], "QList", "SWGRangeFloat");
+    
+    ::SWGSDRangel::setValue(&pipeline_overrun_count, pJson["pipelineOverrunCount"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_avg, pJson["pipelineLatencyAvg"], "float", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_max, pJson["pipelineLatencyMax"], "float", "");
+    
 }
 
 QString
@@ -259,6 +281,15 @@ SWGSoapySDRReport::asJsonObject() {
     if(bandwidths_ranges->size() > 0){
         toJsonArray((QList<void*>*)bandwidths_ranges, obj, "bandwidthsRanges", "SWGRangeFloat");
     }
+    if(m_pipeline_overrun_count_isSet){
+        obj->insert("pipelineOverrunCount", QJsonValue(pipeline_overrun_count));
+    }
+    if(m_pipeline_latency_avg_isSet){
+        obj->insert("pipelineLatencyAvg", QJsonValue(pipeline_latency_avg));
+    }
+    if(m_pipeline_latency_max_isSet){
+        obj->insert("pipelineLatencyMax", QJsonValue(pipeline_latency_max));
+    }
 
     return obj;
 }
@@ -403,6 +434,36 @@ SWGSoapySDRReport::setBandwidthsRanges(QList<SWGRangeFloat*>* bandwidths_ranges)
     this->m_bandwidths_ranges_isSet = true;
 }
 
+qint32
+SWGSoapySDRReport::getPipelineOverrunCount() {
+    return pipeline_overrun_count;
+}
+void
+SWGSoapySDRReport::setPipelineOverrunCount(qint32 pipeline_overrun_count) {
+    this->pipeline_overrun_count = pipeline_overrun_count;
+    this->m_pipeline_overrun_count_isSet = true;
+}
+
+float
+SWGSoapySDRReport::getPipelineLatencyAvg() {
+    return pipeline_latency_avg;
+}
+void
+SWGSoapySDRReport::setPipelineLatencyAvg(float pipeline_latency_avg) {
+    this->pipeline_latency_avg = pipeline_latency_avg;
+    this->m_pipeline_latency_avg_isSet = true;
+}
+
+float
+SWGSoapySDRReport::getPipelineLatencyMax() {
+    return pipeline_latency_max;
+}
+void
+SWGSoapySDRReport::setPipelineLatencyMax(float pipeline_latency_max) {
+    this->pipeline_latency_max = pipeline_latency_max;
+    this->m_pipeline_latency_max_isSet = true;
+}
+
 
 bool
 SWGSoapySDRReport::isSet(){
@@ -422,6 +483,9 @@ SWGSoapySDRReport::isSet(){
         if(frequency_settings_args->size() > 0){ isObjectUpdated = true; break;}
         if(rates_ranges->size() > 0){ isObjectUpdated = true; break;}
         if(bandwidths_ranges->size() > 0){ isObjectUpdated = true; break;}
+        if(m_pipeline_overrun_count_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_max_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
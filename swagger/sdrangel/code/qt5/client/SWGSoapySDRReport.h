@@ -89,6 +89,15 @@ public:
     QList<SWGRangeFloat*>* getBandwidthsRanges();
     void setBandwidthsRanges(QList<SWGRangeFloat*>* bandwidths_ranges);
 
+    qint32 getPipelineOverrunCount();
+    void setPipelineOverrunCount(qint32 pipeline_overrun_count);
+
+    float getPipelineLatencyAvg();
+    void setPipelineLatencyAvg(float pipeline_latency_avg);
+
+    float getPipelineLatencyMax();
+    void setPipelineLatencyMax(float pipeline_latency_max);
+
 
     virtual bool isSet() override;
 
@@ -135,6 +144,15 @@ private:
     QList<SWGRangeFloat*>* bandwidths_ranges;
     bool m_bandwidths_ranges_isSet;
 
+    qint32 pipeline_overrun_count;
+    bool m_pipeline_overrun_count_isSet;
+
+    float pipeline_latency_avg;
+    bool m_pipeline_latency_avg_isSet;
+
+    float pipeline_latency_max;
+    bool m_pipeline_latency_max_isSet;
+
 };
 
 }
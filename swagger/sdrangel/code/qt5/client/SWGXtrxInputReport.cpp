@@ -38,6 +38,12 @@ SWGXtrxInputReport::SWGXtrxInputReport() {
     m_temperature_isSet = false;
     gps_lock = 0;
     m_gps_lock_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 SWGXtrxInputReport::~SWGXtrxInputReport() {
@@ -56,6 +62,12 @@ SWGXtrxInputReport::init() {
     m_temperature_isSet = false;
     gps_lock = 0;
     m_gps_lock_isSet = false;
+    pipeline_overrun_count = 0;
+    m_pipeline_overrun_count_isSet = false;
+    pipeline_latency_avg = 0.0f;
+    m_pipeline_latency_avg_isSet = false;
+    pipeline_latency_max = 0.0f;
+    m_pipeline_latency_max_isSet = false;
 }
 
 void
@@ -65,6 +77,9 @@ SWGXtrxInputReport::cleanup() {
 
 
 
+
+
+
 }
 
 SWGXtrxInputReport*
@@ -88,6 +103,12 @@ SWGXtrxInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&gps_lock, pJson["gpsLock"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&pipeline_overrun_count, pJson["pipelineOverrunCount"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_avg, pJson["pipelineLatencyAvg"], "float", "");
+    
+    ::SWGSDRangel::setValue(&pipeline_latency_max, pJson["pipelineLatencyMax"], "float", "");
+    
 }
 
 QString
@@ -119,6 +140,15 @@ SWGXtrxInputReport::asJsonObject() {
     if(m_gps_lock_isSet){
         obj->insert("gpsLock", QJsonValue(gps_lock));
     }
+    if(m_pipeline_overrun_count_isSet){
+        obj->insert("pipelineOverrunCount", QJsonValue(pipeline_overrun_count));
+    }
+    if(m_pipeline_latency_avg_isSet){
+        obj->insert("pipelineLatencyAvg", QJsonValue(pipeline_latency_avg));
+    }
+    if(m_pipeline_latency_max_isSet){
+        obj->insert("pipelineLatencyMax", QJsonValue(pipeline_latency_max));
+    }
 
     return obj;
 }
@@ -173,6 +203,36 @@ SWGXtrxInputReport::setGpsLock(qint32 gps_lock) {
     this->m_gps_lock_isSet = true;
 }
 
+qint32
+SWGXtrxInputReport::getPipelineOverrunCount() {
+    return pipeline_overrun_count;
+}
+void
+SWGXtrxInputReport::setPipelineOverrunCount(qint32 pipeline_overrun_count) {
+    this->pipeline_overrun_count = pipeline_overrun_count;
+    this->m_pipeline_overrun_count_isSet = true;
+}
+
+float
+SWGXtrxInputReport::getPipelineLatencyAvg() {
+    return pipeline_latency_avg;
+}
+void
+SWGXtrxInputReport::setPipelineLatencyAvg(float pipeline_latency_avg) {
+    this->pipeline_latency_avg = pipeline_latency_avg;
+    this->m_pipeline_latency_avg_isSet = true;
+}
+
+float
+SWGXtrxInputReport::getPipelineLatencyMax() {
+    return pipeline_latency_max;
+}
+void
+SWGXtrxInputReport::setPipelineLatencyMax(float pipeline_latency_max) {
+    this->pipeline_latency_max = pipeline_latency_max;
+    this->m_pipeline_latency_max_isSet = true;
+}
+
 
 bool
 SWGXtrxInputReport::isSet(){
@@ -183,6 +243,9 @@ SWGXtrxInputReport::isSet(){
         if(m_fifo_fill_isSet){ isObjectUpdated = true; break;}
         if(m_temperature_isSet){ isObjectUpdated = true; break;}
         if(m_gps_lock_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_overrun_count_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_pipeline_latency_max_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
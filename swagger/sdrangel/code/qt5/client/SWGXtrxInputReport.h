@@ -56,6 +56,15 @@ public:
     qint32 getGpsLock();
     void setGpsLock(qint32 gps_lock);
 
+    qint32 getPipelineOverrunCount();
+    void setPipelineOverrunCount(qint32 pipeline_overrun_count);
+
+    float getPipelineLatencyAvg();
+    void setPipelineLatencyAvg(float pipeline_latency_avg);
+
+    float getPipelineLatencyMax();
+    void setPipelineLatencyMax(float pipeline_latency_max);
+
 
     virtual bool isSet() override;
 
@@ -75,6 +84,15 @@ private:
     qint32 gps_lock;
     bool m_gps_lock_isSet;
 
+    qint32 pipeline_overrun_count;
+    bool m_pipeline_overrun_count_isSet;
+
+    float pipeline_latency_avg;
+    bool m_pipeline_latency_avg_isSet;
+
+    float pipeline_latency_max;
+    bool m_pipeline_latency_max_isSet;
+
 };
 
 }
@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+
+""" Load test of the REST API of a running SDRangel instance (typically sdrangelsrv)
+
+Each thread sends GET requests in a loop on its own keep-alive connection for the given duration.
+At the end the overall rate in requests per second and the latency percentiles are printed.
+Only the Python standard library is used. Works with Python 2.7 and Python 3.
+"""
+
+import sys, time, threading, traceback
+from optparse import OptionParser
+
+try:
+    import httplib as http_client
+except ImportError:
+    import http.client as http_client
+
+# ======================================================================
+def getInputOptions():
+
+    parser = OptionParser(usage="usage: %%prog [-a address] [-p path] [-t threads] [-d duration]\n")
+    parser.add_option("-a", "--address", dest="address", help="address and port. Default: 127.0.0.1:8091", metavar="ADDRESS", type="string")
+    parser.add_option("-p", "--path", dest="path", help="request path. Default: /sdrangel/deviceset/0/channels/report", metavar="PATH", type="string")
+    parser.add_option("-t", "--threads", dest="threads", help="number of concurrent clients. Default: 4", metavar="THREADS", type="int")
+    parser.add_option("-d", "--duration", dest="duration", help="test duration in seconds. Default: 10", metavar="SECONDS", type="float")
+
+    (options, args) = parser.parse_args()
+
+    if options.address == None:
+        options.address = "127.0.0.1:8091"
+    if options.path == None:
+        options.path = "/sdrangel/deviceset/0/channels/report"
+    if options.threads == None:
+        options.threads = 4
+    if options.duration == None:
+        options.duration = 10.0
+
+    return options
+
+# ======================================================================
+class Client(threading.Thread):
+
+    def __init__(self, address, path, stopTime):
+        threading.Thread.__init__(self)
+        self.address = address
+        self.path = path
+        self.stopTime = stopTime
+        self.latencies = []
+        self.errors = 0
+
+    def run(self):
+        connection = http_client.HTTPConnection(self.address)
+
+        while time.time() < self.stopTime:
+            try:
+                start = time.time()
+                connection.request("GET", self.path)
+                response = connection.getresponse()
+                response.read()
+                self.latencies.append(time.time() - start)
+                if response.status // 100 != 2:
+                    self.errors += 1
+            except Exception:
+                self.errors += 1
+                connection.close()
+                connection = http_client.HTTPConnection(self.address)
+
+        connection.close()
+
+# ======================================================================
+def percentile(sortedValues, p):
+    if len(sortedValues) == 0:
+        return 0.0
+    index = int(round((p / 100.0) * (len(sortedValues) - 1)))
+    return sortedValues[index]
+
+# ======================================================================
+def main():
+    try:
+        options = getInputOptions()
+        stopTime = time.time() + options.duration
+        clients = [Client(options.address, options.path, stopTime) for i in range(options.threads)]
+        startTime = time.time()
+
+        for client in clients:
+            client.start()
+        for client in clients:
+            client.join()
+
+        elapsed = time.time() - startTime
+        latencies = sorted([latency for client in clients for latency in client.latencies])
+        errors = sum([client.errors for client in clients])
+
+        print("URL:          http://%s%s" % (options.address, options.path))
+        print("Clients:      %d" % options.threads)
+        print("Requests:     %d (%d errors)" % (len(latencies), errors))
+        print("Rate:         %.1f requests/s" % (len(latencies) / elapsed))
+        print("Latency p50:  %.3f ms" % (percentile(latencies, 50) * 1000.0))
+        print("Latency p99:  %.3f ms" % (percentile(latencies, 99) * 1000.0))
+        print("Latency max:  %.3f ms" % ((latencies[-1] if latencies else 0.0) * 1000.0))
+
+        if errors != 0:
+            sys.exit(1)
+
+    except KeyboardInterrupt:
+        pass
+    except Exception:
+        tb = traceback.format_exc()
+        sys.stderr.write(tb)
+        sys.exit(1)
+
+# ======================================================================
+if __name__ == "__main__":
+    main()